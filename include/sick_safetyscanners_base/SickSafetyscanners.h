@@ -38,10 +38,13 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_SICKSAFETYSCANNERS_H
 #define SICK_SAFETYSCANNERS_BASE_SICKSAFETYSCANNERS_H
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -58,8 +61,11 @@
 #include "sick_safetyscanners_base/data_processing/ParseData.h"
 #include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
 
+#include "sick_safetyscanners_base/cola2/AsyncCola2Session.h"
 #include "sick_safetyscanners_base/cola2/Cola2Session.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
+#include "sick_safetyscanners_base/cola2/ConfigurationCache.h"
+#include "sick_safetyscanners_base/cola2/ConfigurationLoader.h"
 #include "sick_safetyscanners_base/datastructure/Datastructure.h"
 
 
@@ -217,12 +223,20 @@ public:
   void findSensor(uint16_t blink_time);
 
   /*!
-   * \brief Requests data of the protective and warning fields from the sensor.
+   * \brief Requests data of the protective and warning fields from the sensor. The field headers
+   * and geometries are pipelined in one COLA2 session, see requestSensorConfiguration().
    *
    * \param field_data Returned field data.
    */
   void requestFieldData(std::vector<FieldData>& field_data);
 
+  /*!
+   * \brief Requests the names and states of the field sets from the sensor.
+   *
+   * \param field_sets Returned field sets.
+   */
+  void requestFieldSets(datastructure::FieldSets& field_sets);
+
   /*!
    * \brief Requests the name of the device from the sensor.
    *
@@ -238,18 +252,103 @@ public:
   void requestPersistentConfig(ConfigData& config_data);
 
   /*!
-   * \brief Requests the monitoring cases from the sensor.
+   * \brief Requests the monitoring cases from the sensor. The monitoring cases are pipelined in
+   * one COLA2 session, see requestSensorConfiguration().
    *
    * \param monitoring_cases Returned monitoring cases.
    */
   void requestMonitoringCases(std::vector<MonitoringCaseData>& monitoring_cases);
 
+  /*!
+   * \brief Requests the identity strings, config metadata, field sets, current and persistent
+   * configuration, field data and monitoring cases from the sensor in bulk. All commands are
+   * pipelined in one COLA2 session.
+   *
+   * \param configuration Returned sensor configuration.
+   * \return The time and COLA2 traffic spent on loading the configuration.
+   */
+  sick::cola2::ConfigurationLoaderStatistics
+  requestSensorConfiguration(datastructure::SensorConfiguration& configuration);
+
+  /*!
+   * \brief Sets a cache for the configuration of the sensor. If set, requestSensorConfiguration(),
+   * requestFieldData(), requestMonitoringCases() and requestPersistentConfig() only request the
+   * serial number and the config metadata from the sensor and take the requested part of the
+   * configuration from the cache as long as its checksums match. The cache can be shared between
+   * scanners.
+   *
+   * \param cache The configuration cache, or nullptr to always load from the sensor.
+   */
+  void setConfigurationCache(std::shared_ptr<sick::cola2::ConfigurationCache> cache);
+
+  /*!
+   * \brief Sets the bounds for reassembling fragmented sensor data. Incomplete scans exceeding
+   * these bounds are evicted.
+   *
+   * \param limits The reassembly bounds.
+   */
+  void setReassemblyLimits(const sick::data_processing::ReassemblyLimits& limits);
+
+  /*!
+   * \brief Returns the counters of completed and evicted scans of the reassembly.
+   *
+   * \return sick::data_processing::ReassemblyStatistics
+   */
+  sick::data_processing::ReassemblyStatistics getReassemblyStatistics() const;
+
+  /*!
+   * \brief Enables lazy decoding of the sensor data. Only the data header and the derived values
+   * are parsed on reception, all other blocks are decoded on their first access. Consumers which
+   * read a subset of the blocks only pay for this subset.
+   *
+   * \param lazy_decoding If the blocks are decoded on their first access.
+   */
+  void setLazyDecoding(bool lazy_decoding);
+
+  /*!
+   * \brief Selects the blocks of the sensor data to parse. This is independent of the blocks the
+   * sensor streams as configured by CommSettings::features, blocks which are received but not
+   * selected are skipped and marked empty.
+   *
+   * \param parse_mask The blocks to parse as sick::SensorDataFeatures flags.
+   */
+  void setParseMask(sick::types::SensorFeatures parse_mask);
+
+  /*!
+   * \brief Returns the blocks of the sensor data which are parsed.
+   *
+   * \return The blocks to parse as sick::SensorDataFeatures flags.
+   */
+  sick::types::SensorFeatures getParseMask() const;
+
+  /*!
+   * \brief Keeps the COLA2 session open across the COLA2 functions instead of opening and closing
+   * a session for each of them. A session which has been idle for longer than the idle timeout or
+   * has been rejected by the sensor is reopened transparently.
+   *
+   * \param session_reuse If the COLA2 session is kept open.
+   */
+  void setSessionReuse(bool session_reuse);
+
+  /*!
+   * \brief Sets the time after which the sensor closes an idle COLA2 session. It is rounded down
+   * to whole seconds and clamped to the range of 1 to 255 seconds the sensor accepts, so the
+   * client expires a reused session at the same time as the sensor. Applies to sessions opened
+   * afterwards. The timeout is enforced lazily: no timer closes the session, the next command
+   * after the timeout opens a new one.
+   *
+   * \param idle_timeout The idle timeout, 60 seconds by default.
+   */
+  void setSessionIdleTimeout(sick::types::time_duration_t idle_timeout);
+
 private:
   sick::types::ip_address_t m_sensor_ip;
   sick::types::port_t m_sensor_tcp_port;
   CommSettings m_comm_settings;
   bool m_is_initialized;
+  std::atomic<bool> m_lazy_decoding;
   std::unique_ptr<boost::asio::io_service> m_io_service_ptr;
+  std::shared_ptr<sick::cola2::ConfigurationCache> m_configuration_cache;
 
   /*!
    * \brief Helper function to create command objects generically.
@@ -261,17 +360,37 @@ private:
   template <class CommandT, typename... Args>
   void inline createAndExecuteCommand(Args&&... args)
   {
-    m_session.open();
-    auto cmd = new CommandT(std::forward<Args>(args)...);
-    m_session.sendCommand(*cmd);
-    m_session.close();
+    CommandT cmd(std::forward<Args>(args)...);
+    m_session.executeCommand(cmd);
   }
 
+  /*!
+   * \brief Loads the given parts of the sensor configuration pipelined, using the configuration
+   * cache if set.
+   *
+   * \param configuration Returned sensor configuration.
+   * \param content The parts of the configuration to load.
+   * \return The time and COLA2 traffic spent on loading the configuration.
+   */
+  sick::cola2::ConfigurationLoaderStatistics
+  loadConfiguration(datastructure::SensorConfiguration& configuration,
+                    sick::cola2::ConfigurationLoader::Content content);
+
 protected:
   boost::asio::io_service& m_io_service;
   sick::communication::UDPClient m_udp_client;
   sick::cola2::Cola2Session m_session;
   sick::data_processing::UDPPacketMerger m_packet_merger;
+  sick::data_processing::ParseData m_data_parser;
+
+  /*!
+   * \brief Parses a reassembled scan, either completely or lazily as configured.
+   *
+   * \param buffer The reassembled packet buffer. When parsing lazily, the data object takes it over
+   * and leaves the cleared buffer of its previous scan, either can be released to the merger.
+   * \param data The data object to overwrite.
+   */
+  void parseData(sick::datastructure::PacketBuffer& buffer, sick::datastructure::Data& data);
 };
 
 /*!
@@ -321,6 +440,73 @@ public:
                          sick::types::ScanDataCb callback,
                          boost::asio::io_service& io_service);
 
+  /*!
+   * \brief Constructor of the AsyncSickSafetyScanner class. The callback takes shared ownership of
+   * the parsed data. The data objects are taken from an internal pool and are recycled once the
+   * callback and all copies of the passed pointer released them, so keeping the data beyond the
+   * callback is possible without copying it.
+   *
+   * \param sensor_ip The IP4 address of the sensor.
+   * \param sensor_tcp_port The TCP port of the sensor (COLA2).
+   * \param comm_settings A CommSettings object containing parameters to be sent to the sensor. The
+   * host (client) UDP port, if not available for allocation, might be overwritten by an
+   * automatically choosen one.
+   * \param callback A callback to process incomming sensor data.
+   */
+  AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                         sick::types::port_t sensor_tcp_port,
+                         CommSettings comm_settings,
+                         sick::types::ScanDataPtrCb callback);
+
+  /*!
+   * \brief Constructor of the AsyncSickSafetyScanner class. The callback takes shared ownership of
+   * the pooled data objects, see above. This constructor variant relies on the caller to perform
+   * run-calls on the given io_service and keep it alive.
+   *
+   * \param sensor_ip The IP4 address of the sensor.
+   * \param sensor_tcp_port The TCP port of the sensor (COLA2).
+   * \param comm_settings A CommSettings object containing parameters to be sent to the sensor.
+   * \param callback A callback to process incomming sensor data.
+   * \param io_service A boost::asio io_service instance used internally to manage sockets.
+   */
+  AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                         sick::types::port_t sensor_tcp_port,
+                         CommSettings comm_settings,
+                         sick::types::ScanDataPtrCb callback,
+                         boost::asio::io_service& io_service);
+
+  /*!
+   * \brief Constructor of the AsyncSickSafetyScanner class. The callback receives a zero-copy view
+   * onto each reassembled scan, no data object is parsed. Fields are read from the received bytes
+   * when they are accessed through the view.
+   *
+   * \param sensor_ip The IP4 address of the sensor.
+   * \param sensor_tcp_port The TCP port of the sensor (COLA2).
+   * \param comm_settings A CommSettings object containing parameters to be sent to the sensor.
+   * \param callback A callback to process incomming sensor data.
+   */
+  AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                         sick::types::port_t sensor_tcp_port,
+                         CommSettings comm_settings,
+                         sick::types::ScanDataViewCb callback);
+
+  /*!
+   * \brief Constructor of the AsyncSickSafetyScanner class. The callback receives a zero-copy view
+   * onto each reassembled scan, see above. This constructor variant relies on the caller to perform
+   * run-calls on the given io_service and keep it alive.
+   *
+   * \param sensor_ip The IP4 address of the sensor.
+   * \param sensor_tcp_port The TCP port of the sensor (COLA2).
+   * \param comm_settings A CommSettings object containing parameters to be sent to the sensor.
+   * \param callback A callback to process incomming sensor data.
+   * \param io_service A boost::asio io_service instance used internally to manage sockets.
+   */
+  AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                         sick::types::port_t sensor_tcp_port,
+                         CommSettings comm_settings,
+                         sick::types::ScanDataViewCb callback,
+                         boost::asio::io_service& io_service);
+
   /*!
    * \brief Destructor of the AsyncSickSafetyScanner object
    *
@@ -340,6 +526,295 @@ public:
    */
   void stop();
 
+  /*!
+   * \brief Returns the counters of the underlying UDP receive path, e.g. to verify how many
+   * datagrams are drained per receive system call.
+   *
+   * \return sick::communication::UDPClientStatistics
+   */
+  sick::communication::UDPClientStatistics getReceiveStatistics() const;
+
+  /*!
+   * \brief Requests the config metadata from the sensor without blocking. The request is executed
+   * on the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the config metadata or the error.
+   */
+  void requestConfigMetadataAsync(
+    sick::types::AsyncResultCb<datastructure::ConfigMetadata> callback);
+
+  /*!
+   * \brief Requests the config metadata from the sensor without blocking.
+   *
+   * \return A future holding the config metadata or the error.
+   */
+  std::future<datastructure::ConfigMetadata> requestConfigMetadataAsync();
+
+  /*!
+   * \brief Requests a status overview from the sensor without blocking. The request is executed on
+   * the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the status overview or the error.
+   */
+  void requestStatusOverviewAsync(
+    sick::types::AsyncResultCb<datastructure::StatusOverview> callback);
+
+  /*!
+   * \brief Requests a status overview from the sensor without blocking.
+   *
+   * \return A future holding the status overview or the error.
+   */
+  std::future<datastructure::StatusOverview> requestStatusOverviewAsync();
+
+  /*!
+   * \brief Requests the device status from the sensor without blocking. The request is executed on
+   * the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the device status or the error.
+   */
+  void requestDeviceStatusAsync(sick::types::AsyncResultCb<datastructure::DeviceStatus> callback);
+
+  /*!
+   * \brief Requests the device status from the sensor without blocking.
+   *
+   * \return A future holding the device status or the error.
+   */
+  std::future<datastructure::DeviceStatus> requestDeviceStatusAsync();
+
+  /*!
+   * \brief Requests the 'required user action' from the sensor without blocking. The request is
+   * executed on the io_service of the scanner and the callback is called from it once the reply has
+   * arrived.
+   *
+   * \param callback Callback receiving the required user action or the error.
+   */
+  void requestRequiredUserActionAsync(
+    sick::types::AsyncResultCb<datastructure::RequiredUserAction> callback);
+
+  /*!
+   * \brief Requests the 'required user action' from the sensor without blocking.
+   *
+   * \return A future holding the required user action or the error.
+   */
+  std::future<datastructure::RequiredUserAction> requestRequiredUserActionAsync();
+
+  /*!
+   * \brief Requests the serial number from the sensor without blocking. The request is executed on
+   * the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the serial number or the error.
+   */
+  void requestSerialNumberAsync(sick::types::AsyncResultCb<datastructure::SerialNumber> callback);
+
+  /*!
+   * \brief Requests the serial number from the sensor without blocking.
+   *
+   * \return A future holding the serial number or the error.
+   */
+  std::future<datastructure::SerialNumber> requestSerialNumberAsync();
+
+  /*!
+   * \brief Requests the type code from the sensor without blocking. The request is executed on the
+   * io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the type code or the error.
+   */
+  void requestTypeCodeAsync(sick::types::AsyncResultCb<datastructure::TypeCode> callback);
+
+  /*!
+   * \brief Requests the type code from the sensor without blocking.
+   *
+   * \return A future holding the type code or the error.
+   */
+  std::future<datastructure::TypeCode> requestTypeCodeAsync();
+
+  /*!
+   * \brief Requests the firmware version from the sensor without blocking. The request is executed
+   * on the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the firmware version or the error.
+   */
+  void requestFirmwareVersionAsync(
+    sick::types::AsyncResultCb<datastructure::FirmwareVersion> callback);
+
+  /*!
+   * \brief Requests the firmware version from the sensor without blocking.
+   *
+   * \return A future holding the firmware version or the error.
+   */
+  std::future<datastructure::FirmwareVersion> requestFirmwareVersionAsync();
+
+  /*!
+   * \brief Requests the order number from the sensor without blocking. The request is executed on
+   * the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the order number or the error.
+   */
+  void requestOrderNumberAsync(sick::types::AsyncResultCb<datastructure::OrderNumber> callback);
+
+  /*!
+   * \brief Requests the order number from the sensor without blocking.
+   *
+   * \return A future holding the order number or the error.
+   */
+  std::future<datastructure::OrderNumber> requestOrderNumberAsync();
+
+  /*!
+   * \brief Requests the name of the device from the sensor without blocking. The request is
+   * executed on the io_service of the scanner and the callback is called from it once the reply has
+   * arrived.
+   *
+   * \param callback Callback receiving the device name or the error.
+   */
+  void requestDeviceNameAsync(sick::types::AsyncResultCb<datastructure::DeviceName> callback);
+
+  /*!
+   * \brief Requests the name of the device from the sensor without blocking.
+   *
+   * \return A future holding the device name or the error.
+   */
+  std::future<datastructure::DeviceName> requestDeviceNameAsync();
+
+  /*!
+   * \brief Requests the name of the project from the sensor without blocking. The request is
+   * executed on the io_service of the scanner and the callback is called from it once the reply has
+   * arrived.
+   *
+   * \param callback Callback receiving the project name or the error.
+   */
+  void requestProjectNameAsync(sick::types::AsyncResultCb<datastructure::ProjectName> callback);
+
+  /*!
+   * \brief Requests the name of the project from the sensor without blocking.
+   *
+   * \return A future holding the project name or the error.
+   */
+  std::future<datastructure::ProjectName> requestProjectNameAsync();
+
+  /*!
+   * \brief Requests the name of the user from the sensor without blocking. The request is executed
+   * on the io_service of the scanner and the callback is called from it once the reply has arrived.
+   *
+   * \param callback Callback receiving the user name or the error.
+   */
+  void requestUserNameAsync(sick::types::AsyncResultCb<datastructure::UserName> callback);
+
+  /*!
+   * \brief Requests the name of the user from the sensor without blocking.
+   *
+   * \return A future holding the user name or the error.
+   */
+  std::future<datastructure::UserName> requestUserNameAsync();
+
+  /*!
+   * \brief Requests the name of the application from the sensor without blocking. The request is
+   * executed on the io_service of the scanner and the callback is called from it once the reply has
+   * arrived.
+   *
+   * \param callback Callback receiving the application name or the error.
+   */
+  void requestApplicationNameAsync(
+    sick::types::AsyncResultCb<datastructure::ApplicationName> callback);
+
+  /*!
+   * \brief Requests the name of the application from the sensor without blocking.
+   *
+   * \return A future holding the application name or the error.
+   */
+  std::future<datastructure::ApplicationName> requestApplicationNameAsync();
+
+  /*!
+   * \brief Requests the names and states of the field sets from the sensor without blocking. The
+   * request is executed on the io_service of the scanner and the callback is called from it once
+   * the reply has arrived.
+   *
+   * \param callback Callback receiving the field sets or the error.
+   */
+  void requestFieldSetsAsync(sick::types::AsyncResultCb<datastructure::FieldSets> callback);
+
+  /*!
+   * \brief Requests the names and states of the field sets from the sensor without blocking.
+   *
+   * \return A future holding the field sets or the error.
+   */
+  std::future<datastructure::FieldSets> requestFieldSetsAsync();
+
+  /*!
+   * \brief Requests the current measurement configuration from the sensor without blocking. The
+   * request is executed on the io_service of the scanner and the callback is called from it once
+   * the reply has arrived.
+   *
+   * \param callback Callback receiving the current configuration or the error.
+   */
+  void requestCurrentConfigAsync(sick::types::AsyncResultCb<datastructure::ConfigData> callback);
+
+  /*!
+   * \brief Requests the current measurement configuration from the sensor without blocking.
+   *
+   * \return A future holding the current configuration or the error.
+   */
+  std::future<datastructure::ConfigData> requestCurrentConfigAsync();
+
+  /*!
+   * \brief Requests the persistent configuration from the sensor without blocking. The request is
+   * executed on the io_service of the scanner and the callback is called from it once the reply has
+   * arrived. Unlike requestPersistentConfig() the configuration cache is not consulted.
+   *
+   * \param callback Callback receiving the persistent configuration or the error.
+   */
+  void requestPersistentConfigAsync(sick::types::AsyncResultCb<datastructure::ConfigData> callback);
+
+  /*!
+   * \brief Requests the persistent configuration from the sensor without blocking.
+   *
+   * \return A future holding the persistent configuration or the error.
+   */
+  std::future<datastructure::ConfigData> requestPersistentConfigAsync();
+
+  /*!
+   * \brief Requests the latest telegram of a channel from the sensor without blocking. The request
+   * is executed on the io_service of the scanner and the callback is called from it once the reply
+   * has arrived.
+   *
+   * \param callback Callback receiving the latest telegram or the error.
+   * \param channel_index The channel of the telegram, 0 to 3. Other values request channel 0.
+   */
+  void requestLatestTelegramAsync(sick::types::AsyncResultCb<datastructure::Data> callback,
+                                  int8_t channel_index = 0);
+
+  /*!
+   * \brief Requests the latest telegram of a channel from the sensor without blocking.
+   *
+   * \param channel_index The channel of the telegram, 0 to 3. Other values request channel 0.
+   * \return A future holding the latest telegram or the error.
+   */
+  std::future<datastructure::Data> requestLatestTelegramAsync(int8_t channel_index = 0);
+
+  /*!
+   * \brief Returns the number of scans which were dropped because the consumer still referenced
+   * all data objects of the pool.
+   *
+   * \return Number of dropped scans.
+   */
+  uint64_t getNumDroppedScans() const;
+
+  /*!
+   * \brief Number of preallocated data objects parsed scans are written to.
+   */
+  static const std::size_t DATA_POOL_SIZE = 4;
+
+  /*!
+   * \brief Maximum number of data objects the pool grows to if the consumer retains scans. Further
+   * scans are dropped until data objects are released.
+   */
+  static const std::size_t DATA_POOL_MAX_SIZE = 64;
+
+  /*!
+   * \brief Time the destructor waits for the request closing the COLA2 session to be sent before
+   * the io_service is stopped, in milliseconds.
+   */
+  static const long CLOSE_SESSION_TIMEOUT_MS = 500;
+
 private:
   /*!
    * \brief Merges incomming UDP packets and calls the callback function as passed via the
@@ -349,10 +824,81 @@ private:
    */
   void processUDPPacket(const sick::datastructure::PacketBuffer& buffer);
 
-  sick::types::ScanDataCb m_scan_data_cb;
+  /*!
+   * \brief Periodically evicts data packets which exceed the maximum age of the reassembly while
+   * running, so the fragments of a stalled data stream are released although no udp packet arrives.
+   */
+  void scheduleEviction();
+
+  /*!
+   * \brief Returns the angle table for the configuration of a scan. The table is shared by all
+   * views until the derived values or the number of beams change.
+   *
+   * \param view The view onto the scan.
+   */
+  const std::shared_ptr<const sick::datastructure::AngleTable>&
+  getAngleTable(const sick::data_processing::DataView& view);
+
+  /*!
+   * \brief Helper function to queue command objects generically on the asynchronous session.
+   *
+   * 	param CommandT The command-object type.
+   * 	param ResultT The type of the datastructure the reply is written to.
+   * 	param ArgsT Types of further arguments of the command constructor.
+   * \param callback The callback receiving the result or the error.
+   * \param args Further arguments passed to the command constructor.
+   */
+  template <class CommandT, class ResultT, typename... ArgsT>
+  void createAndExecuteCommandAsync(sick::types::AsyncResultCb<ResultT> callback, ArgsT... args)
+  {
+    auto result = std::make_shared<ResultT>();
+    m_async_session->executeCommand(
+      [result, args...](
+        sick::cola2::Cola2SessionState& session) -> std::shared_ptr<sick::cola2::Command> {
+        return std::make_shared<CommandT>(session, *result, args...);
+      },
+      [result, callback](std::exception_ptr error) { callback(error, *result); });
+  }
+
+  /*!
+   * \brief Helper function to queue command objects generically on the asynchronous session.
+   *
+   * 	param CommandT The command-object type.
+   * 	param ResultT The type of the datastructure the reply is written to.
+   * 	param ArgsT Types of further arguments of the command constructor.
+   * \param args Further arguments passed to the command constructor.
+   * \return A future holding the result or the error.
+   */
+  template <class CommandT, class ResultT, typename... ArgsT>
+  std::future<ResultT> createAndExecuteCommandAsync(ArgsT... args)
+  {
+    auto promise = std::make_shared<std::promise<ResultT> >();
+    createAndExecuteCommandAsync<CommandT>(
+      sick::types::AsyncResultCb<ResultT>(
+        [promise](std::exception_ptr error, const ResultT& result) {
+          if (error)
+          {
+            promise->set_exception(error);
+            return;
+          }
+          promise->set_value(result);
+        }),
+      args...);
+    return promise->get_future();
+  }
+
+  sick::types::ScanDataPtrCb m_scan_data_cb;
+  sick::types::ScanDataViewCb m_scan_data_view_cb;
+  sick::datastructure::DataPool m_data_pool;
+  std::atomic<uint64_t> m_num_dropped_scans;
+  std::shared_ptr<const sick::datastructure::AngleTable> m_angle_table_ptr;
   std::unique_ptr<boost::asio::io_service> m_io_service_ptr;
   boost::thread m_service_thread;
   std::unique_ptr<boost::asio::io_service::work> m_work;
+  std::shared_ptr<sick::cola2::AsyncCola2Session> m_async_session;
+  boost::asio::deadline_timer m_eviction_timer;
+  bool m_is_running;
+  std::mutex m_eviction_mutex;
 };
 
 /*!
@@ -388,6 +934,16 @@ public:
    * \return const Data Returned sensor data.
    */
   const Data receive(sick::types::time_duration_t timeout = boost::posix_time::pos_infin);
+
+  /*!
+   * \brief Blocking call to receive one sensor data message into an existing data object. Calling
+   * this repeatedly with the same object reuses its storage. Throws an exception if the timeout is
+   * exceeded.
+   *
+   * \param data The data object to overwrite with the received sensor data.
+   * \param timeout Timeout in [seconds].
+   */
+  void receive(Data& data, sick::types::time_duration_t timeout = boost::posix_time::pos_infin);
 };
 } // namespace sick
 
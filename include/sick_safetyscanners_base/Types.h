@@ -35,11 +35,14 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_TYPES_H
 #define SICK_SAFETYSCANNERS_BASE_TYPES_H
 
+#include "sick_safetyscanners_base/data_processing/DataView.h"
 #include "sick_safetyscanners_base/datastructure/Data.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 #include <boost/asio/ip/address_v4.hpp>
+#include <exception>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace sick {
 namespace types {
@@ -50,12 +53,42 @@ namespace types {
  */
 using ScanDataCb = std::function<void(const sick::datastructure::Data&)>;
 
+/*!
+ * \brief Type definition for scan data callbacks taking shared ownership of the data. The data
+ * object is recycled by the scanner as soon as the callee dropped all references to it.
+ *
+ */
+using ScanDataPtrCb = std::function<void(const std::shared_ptr<const sick::datastructure::Data>&)>;
+
+/*!
+ * \brief Type definition for scan data callbacks receiving a zero-copy view onto the reassembled
+ * scan instead of the parsed data. The view is only valid during the callback.
+ *
+ */
+using ScanDataViewCb = std::function<void(const sick::data_processing::DataView&)>;
+
+/*!
+ * \brief Type definition for callbacks of asynchronous COLA2 requests. The exception pointer is
+ * empty on success, otherwise it holds the error and the result is left default constructed.
+ *
+ */
+template <typename ResultT>
+using AsyncResultCb = std::function<void(std::exception_ptr, const ResultT&)>;
+
 /*!
  * \brief Type definition for packet handler callbacks.
  *
  */
 using PacketHandler = std::function<void(const sick::datastructure::PacketBuffer&)>;
 
+/*!
+ * \brief Type definition for packet handler callbacks receiving all datagrams drained from the
+ * socket in one wakeup.
+ *
+ */
+using PacketBatchHandler =
+  std::function<void(const std::vector<sick::datastructure::PacketBuffer>&)>;
+
 /*!
  * \brief Type alias for the currently used IP4 address type.
  *
@@ -61,7 +61,7 @@ public:
    * \param application_name Reference to the application name variable, which will be written on
    * execution.
    */
-  ApplicationNameVariableCommand(Cola2Session& session,
+  ApplicationNameVariableCommand(Cola2SessionState& session,
                                  datastructure::ApplicationName& application_name);
 
   /*!
@@ -0,0 +1,265 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file AsyncCola2Session.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COLA2_ASYNCCOLA2SESSION_H
+#define SICK_SAFETYSCANNERS_BASE_COLA2_ASYNCCOLA2SESSION_H
+
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/Types.h"
+
+#include "sick_safetyscanners_base/communication/AsyncTCPClient.h"
+
+#include "sick_safetyscanners_base/cola2/Cola2Session.h"
+#include "sick_safetyscanners_base/cola2/Cola2SessionState.h"
+#include "sick_safetyscanners_base/cola2/Command.h"
+#include "sick_safetyscanners_base/cola2/CreateSession.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseTCPPacket.h"
+
+#include <boost/asio.hpp>
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace sick {
+namespace cola2 {
+
+/*!
+ * \brief Type definition for factories creating a command for the given session state. Commands
+ * are created right before they are sent, so they pick up the request and session ID of the
+ * session.
+ */
+using CommandFactory = std::function<std::shared_ptr<Command>(Cola2SessionState&)>;
+
+/*!
+ * \brief Type definition for handlers called once a command has completed. The exception pointer
+ * is empty if the reply has been processed and holds a sick::timeout_error or sick::runtime_error
+ * otherwise.
+ */
+using CommandCompletionHandler = std::function<void(std::exception_ptr)>;
+
+/*!
+ * \brief A class representing a COLA2 session which executes commands asynchronously on a shared
+ * io_service. Commands are queued and complete through a handler, so no thread is blocked for a
+ * round trip and a single thread can drive the COLA2 traffic of many sensors.
+ *
+ * The session is opened on demand and kept open for the following commands until it has been idle
+ * for longer than the idle timeout. Up to a window of commands is pipelined and every reply is
+ * routed to its command by request ID. If the connection fails or the sensor rejects a command
+ * because it does not know the session anymore, the commands awaiting their reply in a session
+ * which had already been open are repeated once in a new session, all others complete with the
+ * error.
+ *
+ * All members may be called from any thread, the state of the session is only accessed through a
+ * strand. The object has to be owned by a std::shared_ptr, as it is kept alive by its outstanding
+ * operations.
+ */
+class AsyncCola2Session : public std::enable_shared_from_this<AsyncCola2Session>
+{
+public:
+  /*!
+   * \brief Constructor of the asynchronous COLA2 session object.
+   *
+   * \param io_service The io_service the socket operations and handlers are run on.
+   * \param server_ip The IP address of the sensor.
+   * \param server_port The TCP port of the sensor (COLA2).
+   * \param window The maximum number of commands awaiting their reply at the same time.
+   * \param timeout The timeout on a single connect/receive socket operation.
+   */
+  AsyncCola2Session(boost::asio::io_service& io_service,
+                    sick::types::ip_address_t server_ip,
+                    sick::types::port_t server_port,
+                    std::size_t window                   = Cola2Session::DEFAULT_PIPELINE_WINDOW,
+                    sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
+
+  // Deleted default, copy and copy-assignment constructors.
+  AsyncCola2Session()                         = delete;
+  AsyncCola2Session(const AsyncCola2Session&) = delete;
+  AsyncCola2Session& operator=(const AsyncCola2Session&) = delete;
+
+  /*!
+   * \brief Queues a command for execution and returns immediately. The handler is called through
+   * the strand of the session once the reply has been processed or the command has failed. It must
+   * not block, as it delays the traffic of all sessions on the io_service.
+   *
+   * \param factory The factory creating the command. It is called again if the command is repeated
+   * in a new session.
+   * \param handler The handler called on completion.
+   */
+  void executeCommand(CommandFactory factory, CommandCompletionHandler handler);
+
+  /*!
+   * \brief Sets the time after which an idle session is closed by the sensor. It is clamped to
+   * whole seconds in the range the sensor accepts, see Cola2SessionState::setIdleTimeout(), and
+   * applied to sessions opened afterwards.
+   *
+   * \param idle_timeout The idle timeout.
+   */
+  void setIdleTimeout(sick::types::time_duration_t idle_timeout);
+
+  /*!
+   * \brief Closes the session and the connection. Queued commands and commands awaiting their reply
+   * complete with a sick::runtime_error, as do all commands executed afterwards.
+   *
+   * \return A future which becomes ready once the request to close the session has been sent and
+   * the connection has been dropped. It never becomes ready if the io_service is stopped before.
+   */
+  std::future<void> close();
+
+private:
+  /*!
+   * \brief States of the connection and the COLA2 session.
+   */
+  enum class State
+  {
+    CLOSED,
+    CONNECTING,
+    OPENING,
+    OPEN
+  };
+
+  /*!
+   * \brief A queued command, the command object is only created once it is sent.
+   */
+  struct QueuedCommand
+  {
+    CommandFactory factory;
+    CommandCompletionHandler handler;
+    std::shared_ptr<Command> cmd;
+    bool is_repeated;
+    uint64_t send_sequence;
+  };
+
+  boost::asio::io_service::strand m_strand;
+  sick::communication::AsyncTCPClient m_tcp_client;
+  Cola2SessionState m_session_state;
+  std::size_t m_window;
+  sick::types::time_duration_t m_timeout;
+  State m_state;
+  bool m_is_closed;
+  bool m_is_receiving;
+  uint64_t m_connection_id;
+  uint64_t m_send_sequence;
+  std::deque<QueuedCommand> m_queued_commands;
+  std::map<uint16_t, QueuedCommand> m_pending_commands;
+  std::shared_ptr<CreateSession> m_create_session;
+  sick::data_processing::ParseTCPPacket m_tcp_packet_parser;
+  std::vector<uint8_t> m_receive_buffer;
+
+  /*!
+   * \brief Opens the session or sends queued commands, depending on the state of the session.
+   *
+   */
+  void process();
+
+  /*!
+   * \brief Starts to connect to the sensor.
+   *
+   */
+  void connect();
+
+  /*!
+   * \brief Sends the request to open a COLA2 session once the connection is established.
+   *
+   * \param connection_id The connection the handler belongs to.
+   * \param ec A boost::system error code.
+   */
+  void handleConnect(uint64_t connection_id, const boost::system::error_code& ec);
+
+  /*!
+   * \brief Creates a telegram in COLA2 format and starts to send it to the sensor.
+   *
+   * \param cmd The command to be sent.
+   */
+  void sendTelegram(Command& cmd);
+
+  /*!
+   * \brief Starts to receive replies, if not done yet.
+   *
+   */
+  void beginReceive();
+
+  /*!
+   * \brief Splits the TCP stream into telegrams, processes them and continues to send and receive.
+   *
+   * \param connection_id The connection the handler belongs to.
+   * \param ec A boost::system error code.
+   * \param packet The received bytes.
+   */
+  void handleReceive(uint64_t connection_id,
+                     const boost::system::error_code& ec,
+                     const sick::datastructure::PacketBuffer& packet);
+
+  /*!
+   * \brief Routes a reply telegram to the command with the same request ID.
+   *
+   * \param telegram The reply telegram.
+   */
+  void processTelegram(const sick::datastructure::PacketBuffer& telegram);
+
+  /*!
+   * \brief Drops the connection after a socket operation has failed and reconnects if commands are
+   * left to be sent.
+   *
+   * \param ec The error code of the failed operation.
+   */
+  void handleError(const boost::system::error_code& ec);
+
+  /*!
+   * \brief Drops the connection without closing the session. Commands awaiting their reply in a
+   * session which had been open are queued to be repeated once in the order they have been sent,
+   * all others complete with the error.
+   * If the session could not be opened, all queued commands complete with the error as well.
+   *
+   * \param error The error the failing commands complete with.
+   */
+  void reset(std::exception_ptr error);
+
+  /*!
+   * \brief Calls the completion handler of a command.
+   *
+   * \param command The completed command.
+   * \param error The error the command completes with, empty on success.
+   */
+  void complete(QueuedCommand& command, std::exception_ptr error) const;
+};
+
+} // namespace cola2
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COLA2_ASYNCCOLA2SESSION_H
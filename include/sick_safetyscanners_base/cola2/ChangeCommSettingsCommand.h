@@ -64,7 +64,7 @@ public:
    * \param settings The new settings for the sensor. While the command will be executed in the
    * session, these parameters will be set in the sensor.
    */
-  ChangeCommSettingsCommand(Cola2Session& session, const datastructure::CommSettings& settings);
+  ChangeCommSettingsCommand(Cola2SessionState& session, const datastructure::CommSettings& settings);
 
 
   /*!
@@ -97,16 +97,16 @@ public:
 private:
   sick::datastructure::CommSettings m_settings;
 
-  void writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeChannelToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeEnabledToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeEInterfaceTypeToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeIPAddresstoDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writePortToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeFrequencyToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeStartAngleToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeEndAngleToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeFeaturesToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
+  void writeDataToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeChannelToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeEnabledToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeEInterfaceTypeToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeIPAddresstoDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writePortToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeFrequencyToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeStartAngleToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeEndAngleToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeFeaturesToDataPtr(read_write_helper::ByteSpan data_ptr) const;
 };
 
 } // namespace cola2
@@ -52,7 +52,7 @@ public:
    *
    * \param session The currents cola2 session, which will be closed on executing the command.
    */
-  explicit CloseSession(Cola2Session& session);
+  explicit CloseSession(Cola2SessionState& session);
 
   /*!
    * \brief Adds data to the telegram. The close cola2 session command does not carry any extra data
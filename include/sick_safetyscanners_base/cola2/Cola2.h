@@ -35,10 +35,13 @@
 #include "sick_safetyscanners_base/cola2/Cola2Session.h"
 
 #include "sick_safetyscanners_base/cola2/ApplicationNameVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/AsyncCola2Session.h"
 #include "sick_safetyscanners_base/cola2/ChangeCommSettingsCommand.h"
 #include "sick_safetyscanners_base/cola2/CloseSession.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
 #include "sick_safetyscanners_base/cola2/ConfigMetadataVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/ConfigurationCache.h"
+#include "sick_safetyscanners_base/cola2/ConfigurationLoader.h"
 #include "sick_safetyscanners_base/cola2/CreateSession.h"
 #include "sick_safetyscanners_base/cola2/DeviceNameVariableCommand.h"
 #include "sick_safetyscanners_base/cola2/DeviceStatusVariableCommand.h"
@@ -43,13 +43,13 @@
 #include "sick_safetyscanners_base/communication/TCPClient.h"
 
 #include "sick_safetyscanners_base/cola2/CloseSession.h"
+#include "sick_safetyscanners_base/cola2/Cola2SessionState.h"
 #include "sick_safetyscanners_base/cola2/Command.h"
 #include "sick_safetyscanners_base/cola2/CreateSession.h"
 
 #include "sick_safetyscanners_base/data_processing/ParseTCPPacket.h"
-#include "sick_safetyscanners_base/data_processing/TCPPacketMerger.h"
 
-#include <boost/optional.hpp>
+#include <vector>
 
 namespace sick {
 namespace cola2 {
@@ -57,13 +57,36 @@ namespace cola2 {
 class Command;
 class CreateSession;
 
+/*!
+ * \brief Counters of the COLA2 traffic of a session. A round trip is counted for every command sent
+ * stop-and-wait and for every window of pipelined commands, as this is the number of round-trip
+ * latencies the traffic is bounded by.
+ */
+struct Cola2SessionStatistics
+{
+  uint64_t sessions{0};
+  uint64_t commands{0};
+  uint64_t round_trips{0};
+};
+
 /*!
  * \brief A class representing a COLA2 session to handle send, receive and process telegrams
  * synchronously in the format as specified by the SICK Cola2 protocol. This class is not
- * thread-safe and works strictly sequential (one command after another).
+ * thread-safe.
+ *
+ * Commands are either executed in a session of their own or, if session reuse is enabled, in a
+ * session which is kept open across commands. The idle timeout is passed to the sensor as
+ * heartbeat timeout, so the sensor closes a reused session which has been idle for longer.
+ *
+ * Single commands are sent stop-and-wait. A batch of commands can be pipelined, i.e. up to a window
+ * of requests is in flight at the same time and every reply is routed to its command by request
+ * ID, so bulk reads are bounded by bandwidth instead of the round-trip time.
+ *
+ * The request IDs, the session ID and the idle timeout are kept in the session state, which the
+ * commands are created for.
  *
  */
-class Cola2Session
+class Cola2Session : public Cola2SessionState
 {
 public:
   /*!
@@ -78,6 +101,46 @@ public:
   Cola2Session(const Cola2Session&) = delete;
   Cola2Session& operator=(const Cola2Session&) = delete;
 
+  /*!
+   * \brief Destructor of the Cola 2 Session object. Closes a session kept open for reuse.
+   *
+   */
+  ~Cola2Session();
+
+  /*!
+   * \brief A blocking operation executing a COLA2 command. Without session reuse a session is
+   * opened for the command and closed afterwards. With session reuse the command is sent in the
+   * open session, which is opened first if required. If the session has been idle for longer than
+   * the idle timeout, the session which was already open fails or the sensor does not know it
+   * anymore, the session is reopened and the command is repeated once. Other error replies of the
+   * sensor are passed to the command. Throws an exception if the timeout is exceeded.
+   *
+   * \param cmd The command to send via COLA2 to the sensor.
+   * \param timeout The timeout on a single send/receive socket operation. This is not the overall
+   * timeout limit but guarantees the synchronous send/receive operations not to wait forever.
+   */
+  void executeCommand(Command& cmd,
+                      sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
+
+  /*!
+   * \brief A blocking operation executing a batch of COLA2 commands pipelined in one session. Up to
+   * window commands are sent back to back before the first reply is awaited, further commands are
+   * sent as replies arrive. The replies are matched to the commands by request ID, so they are
+   * processed in the order they are received. Sessions are handled as in executeCommand(), a
+   * reused session is reopened once if it fails or the sensor does not know it anymore. Only the
+   * commands without a reply and the ones rejected because of the session are repeated, commands
+   * the sensor already answered are never sent twice. Throws an exception if the timeout is
+   * exceeded.
+   *
+   * \param commands The commands to send via COLA2 to the sensor.
+   * \param window The maximum number of commands awaiting their reply at the same time.
+   * \param timeout The timeout on a single send/receive socket operation. This is not the overall
+   * timeout limit but guarantees the synchronous send/receive operations not to wait forever.
+   */
+  void executeCommands(const std::vector<Command*>& commands,
+                       std::size_t window                   = DEFAULT_PIPELINE_WINDOW,
+                       sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
+
   /*!
    * \brief A blocking operation sends a COLA2 command as telegram to the connected sensor. Throws
    * an exception if the timeout is exceeded.
@@ -90,25 +153,26 @@ public:
                    sick::types::time_duration_t timeout = boost::posix_time::seconds(5));
 
   /*!
-   * \brief Get the current session ID, if available.
+   * \brief Enables or disables keeping the session open across commands executed by
+   * executeCommand(). Disabling closes a session kept open for reuse.
    *
-   * \return boost::optional<uint32_t> Returns the sessionID wrapped as optional value.
+   * \param reuse_session If the session is kept open across commands.
    */
-  boost::optional<uint32_t> getSessionID() const;
+  void setSessionReuse(bool reuse_session);
 
   /*!
-   * \brief Get the next possible requestID. This increments the internal counter by one.
+   * \brief Returns if the session is kept open across commands.
    *
-   * \return uint16_t Returns an incremented request ID.
+   * \return If the session is kept open across commands.
    */
-  uint16_t getNextRequestID();
+  bool getSessionReuse() const;
 
   /*!
-   * \brief Set the Session I D object
+   * \brief Returns the counters of the COLA2 traffic, including opening and closing sessions.
    *
-   * \param session_id
+   * \return The number of opened sessions, sent commands and round trips.
    */
-  void setSessionID(uint32_t session_id);
+  Cola2SessionStatistics getStatistics() const;
 
   /*!
    * \brief Opens a COLA2 session.
@@ -123,11 +187,29 @@ public:
    */
   void close();
 
+  /*!
+   * \brief Default number of pipelined commands awaiting their reply at the same time.
+   */
+  static const std::size_t DEFAULT_PIPELINE_WINDOW = 8;
+
+  /*!
+   * \brief Indicates whether the sensor rejected the command because of the session, e.g. since
+   * it does not know the session anymore. Other error replies concern the command itself.
+   *
+   * \param cmd The processed command.
+   * \param reply The reply telegram the command has been processed with.
+   * \return true The reply is an error reply with a session related error code.
+   * \return false The reply is a regular reply or concerns the command.
+   */
+  static bool isSessionErrorReply(const Command& cmd,
+                                  const sick::datastructure::PacketBuffer& reply);
+
 private:
-  uint16_t m_request_id;
-  boost::optional<uint32_t> m_session_id;
   communication::TCPClientPtr m_tcp_client_ptr;
-
+  bool m_reuse_session;
+  sick::data_processing::ParseTCPPacket m_tcp_packet_parser;
+  std::vector<uint8_t> m_receive_buffer;
+  Cola2SessionStatistics m_statistics;
 
   /*!
    * \brief Creates and transmits a telegram in COLA2 format to the sensor.
@@ -145,16 +227,45 @@ private:
   bool isOpen() const;
 
   /*!
-   * \brief Assembles a packetBuffer object by merging TCP packets from one or multiple response
-   * telegrams of the sensor.
+   * \brief Drops the connection without closing the session, used when the session is known to
+   * be invalid.
+   *
+   */
+  void reset();
+
+  /*!
+   * \brief Closes a session kept open for reuse without raising an exception. A session which has
+   * already been closed by the sensor is only dropped.
+   *
+   */
+  void closeReusedSession();
+
+  /*!
+   * \brief Sends the commands pipelined in the open session and processes the replies.
+   *
+   * \param commands The commands to be processed.
+   * \param window The maximum number of commands awaiting their reply at the same time.
+   * \param timeout The timeout on a single send/receive socket operation.
+   * \param repeated_commands Set to all commands first. A command is removed once its reply has
+   * been processed, unless the sensor rejected it because of the session. When returning or
+   * throwing it holds the commands which can be repeated in a new session, in their original
+   * order.
+   */
+  void sendCommands(const std::vector<Command*>& commands,
+                    std::size_t window,
+                    sick::types::time_duration_t timeout,
+                    std::vector<Command*>& repeated_commands);
+
+  /*!
+   * \brief Assembles a packetBuffer object containing exactly one response telegram of the
+   * sensor. The TCP stream is split at the telegram boundaries, bytes of following telegrams
+   * received in the same TCP packet are kept for the next call.
    *
-   * \param cmd The command to be processed.
    * \param timeout The timeout on a single send/receive socket operation. This is not the overall
    * timeout limit but guarantees the synchronous send/receive operations not to wait forever.
-   * \return sick::datastructure::PacketBuffer The merged reply telegrams of the sensor.
+   * \return sick::datastructure::PacketBuffer The reply telegram of the sensor.
    */
-  sick::datastructure::PacketBuffer receiveAndProcessResponse(Command& cmd,
-                                                              sick::types::time_duration_t timeout);
+  sick::datastructure::PacketBuffer receiveTelegram(sick::types::time_duration_t timeout);
 };
 
 } // namespace cola2
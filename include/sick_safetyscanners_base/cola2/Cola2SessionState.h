@@ -0,0 +1,140 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file Cola2SessionState.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COLA2_COLA2SESSIONSTATE_H
+#define SICK_SAFETYSCANNERS_BASE_COLA2_COLA2SESSIONSTATE_H
+
+#include "sick_safetyscanners_base/Types.h"
+
+#include <boost/optional.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace sick {
+namespace cola2 {
+
+/*!
+ * \brief The bookkeeping of a COLA2 session independent of the transport, i.e. the request ID
+ * counter, the session ID handed out by the sensor and the idle timeout. Commands are created for
+ * a session state, so the synchronous and the asynchronous session share it.
+ */
+class Cola2SessionState
+{
+public:
+  /*!
+   * \brief Constructor of the session state, without a session ID and with an idle timeout of 60
+   * seconds.
+   */
+  Cola2SessionState();
+
+  /*!
+   * \brief Get the current session ID, if available.
+   *
+   * \return boost::optional<uint32_t> Returns the sessionID wrapped as optional value.
+   */
+  boost::optional<uint32_t> getSessionID() const;
+
+  /*!
+   * \brief Get the next possible requestID. This increments the internal counter by one.
+   *
+   * \return uint16_t Returns an incremented request ID.
+   */
+  uint16_t getNextRequestID();
+
+  /*!
+   * \brief Set the Session I D object
+   *
+   * \param session_id
+   */
+  void setSessionID(uint32_t session_id);
+
+  /*!
+   * \brief Forgets the session ID, used when the session is known to be invalid.
+   *
+   */
+  void resetSessionID();
+
+  /*!
+   * \brief Sets the time after which an idle session is closed by the sensor. It is rounded down
+   * to whole seconds and clamped to the range of MIN_IDLE_TIMEOUT_SECONDS to
+   * MAX_IDLE_TIMEOUT_SECONDS the sensor accepts, so the client expires sessions at the same time as
+   * the sensor. It is applied to sessions opened afterwards.
+   *
+   * \param idle_timeout The idle timeout.
+   */
+  void setIdleTimeout(sick::types::time_duration_t idle_timeout);
+
+  /*!
+   * \brief Returns the time after which an idle session is closed by the sensor, as clamped by
+   * setIdleTimeout().
+   *
+   * \return The idle timeout.
+   */
+  sick::types::time_duration_t getIdleTimeout() const;
+
+  /*!
+   * \brief Restarts the idle time, called whenever the sensor has answered in the session.
+   *
+   */
+  void updateLastActivity();
+
+  /*!
+   * \brief Indicates whether the session has been idle for longer than the idle timeout since the
+   * last activity.
+   *
+   * \return true The sensor has to be expected to have closed the session.
+   * \return false The session is still valid.
+   */
+  bool isIdleTimeoutExceeded() const;
+
+  /*!
+   * \brief Shortest idle timeout the sensor accepts, in seconds.
+   */
+  static const long MIN_IDLE_TIMEOUT_SECONDS = 1;
+
+  /*!
+   * \brief Longest idle timeout the sensor accepts, in seconds.
+   */
+  static const long MAX_IDLE_TIMEOUT_SECONDS = 255;
+
+private:
+  uint16_t m_request_id;
+  boost::optional<uint32_t> m_session_id;
+  sick::types::time_duration_t m_idle_timeout;
+  std::chrono::steady_clock::time_point m_last_activity;
+};
+
+} // namespace cola2
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COLA2_COLA2SESSIONSTATE_H
@@ -51,7 +51,7 @@ namespace cola2 {
 /*!
  * \brief Forward declaration of the cola2session class.
  */
-class Cola2Session;
+class Cola2SessionState;
 
 /*!
  * \brief Base class for commands. Defines the base interface and does the common tasks.
@@ -67,7 +67,7 @@ public:
    * Invoking a method).
    * \param command_mode Specifies the mode of the command. If the request is by index or name.
    */
-  Command(sick::cola2::Cola2Session& session, uint16_t command_type, uint16_t command_mode);
+  Command(sick::cola2::Cola2SessionState& session, uint16_t command_type, uint16_t command_mode);
 
   /*!
    * \brief We have virtual member functions, so a virtual destructor is needed.
@@ -96,6 +96,18 @@ public:
    */
   void processReplyBase(const std::vector<uint8_t>& packet);
 
+  /*!
+   * \brief Processes a reply which was received before, e.g. restored from a cache, instead of a
+   * telegram received from the sensor.
+   *
+   * \param command_type The command type of the reply.
+   * \param command_mode The command mode of the reply.
+   * \param data The data of the reply.
+   */
+  void processReplyData(const uint8_t& command_type,
+                        const uint8_t& command_mode,
+                        const std::vector<uint8_t>& data);
+
   /*!
    * \brief Scooped call to the mutex, which will block until the reply was processed.
    */
@@ -179,7 +191,7 @@ public:
   void setDataVector(const std::vector<uint8_t>& data);
 
 protected:
-  sick::cola2::Cola2Session& m_session;
+  sick::cola2::Cola2SessionState& m_session;
 
   std::vector<uint8_t> expandTelegram(const std::vector<uint8_t>& telegram,
                                       size_t additional_bytes) const;
@@ -204,16 +216,16 @@ private:
 
   std::vector<uint8_t> addTelegramHeader(const std::vector<uint8_t>& telegram) const;
   std::vector<uint8_t> prepareHeader() const;
-  void writeCola2StxToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeLengthToDataPtr(std::vector<uint8_t>::iterator data_ptr,
+  void writeCola2StxToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeLengthToDataPtr(read_write_helper::ByteSpan data_ptr,
                             const std::vector<uint8_t>& telegram) const;
-  void writeCola2HubCntrToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeCola2NoCToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeSessionIdToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeRequestIdToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeCommandTypeToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeCommandModeToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
-  void writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr,
+  void writeCola2HubCntrToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeCola2NoCToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeSessionIdToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeRequestIdToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeCommandTypeToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeCommandModeToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeDataToDataPtr(read_write_helper::ByteSpan data_ptr,
                           const std::vector<uint8_t>& telegram) const;
 };
 
@@ -61,7 +61,7 @@ public:
    * \param config_metadata Reference to the config metadata variable, which will be written on
    * execution.
    */
-  ConfigMetadataVariableCommand(Cola2Session& session,
+  ConfigMetadataVariableCommand(Cola2SessionState& session,
                                 datastructure::ConfigMetadata& config_metadata);
 
   /*!
@@ -0,0 +1,140 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationCache.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONCACHE_H
+#define SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONCACHE_H
+
+#include "sick_safetyscanners_base/datastructure/ConfigMetadata.h"
+#include "sick_safetyscanners_base/datastructure/SerialNumber.h"
+
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace sick {
+namespace cola2 {
+
+/*!
+ * \brief A reply of the sensor to a variable command as kept in the configuration cache.
+ */
+struct CachedReply
+{
+  uint8_t command_type{0};
+  uint8_t command_mode{0};
+  std::vector<uint8_t> data;
+};
+
+/*!
+ * \brief The replies of the sensor recorded while loading its configuration, by variable index.
+ */
+struct CachedConfiguration
+{
+  std::string key;
+  uint32_t window{0};
+  std::map<uint16_t, CachedReply> replies;
+};
+
+/*!
+ * \brief Caches the configuration of sensors in memory and optionally on disk, one entry per
+ * serial number. An entry is only valid as long as its key matches the key of the sensor, which is
+ * built from the checksums and the integrity hash of the configuration. Instead of parsed
+ * datastructures the raw replies of the sensor are cached, they are processed again on a cache hit.
+ * The cache is thread-safe and can be shared between several scanners.
+ */
+class ConfigurationCache
+{
+public:
+  /*!
+   * \brief Constructor of the configuration cache.
+   *
+   * \param directory Directory to persist the cached configurations in, one file per serial
+   * number. If empty, the configurations are kept in memory only.
+   */
+  explicit ConfigurationCache(const std::string& directory = "");
+
+  ConfigurationCache(const ConfigurationCache&) = delete;
+  ConfigurationCache& operator=(const ConfigurationCache&) = delete;
+
+  /*!
+   * \brief Looks up the configuration of a sensor, in memory first and on disk second.
+   *
+   * \param serial_number The serial number of the sensor.
+   * \param key The key of the current configuration of the sensor, see makeKey().
+   * \param configuration Returned cached configuration.
+   * \return true A configuration with a matching key has been found.
+   * \return false The configuration is not cached or has changed.
+   */
+  bool lookup(const std::string& serial_number,
+              const std::string& key,
+              CachedConfiguration& configuration);
+
+  /*!
+   * \brief Stores the configuration of a sensor in memory and on disk, replacing an older one.
+   * Failing to write the file is logged but not raised, the configuration is kept in memory then.
+   *
+   * \param serial_number The serial number of the sensor.
+   * \param configuration The configuration to cache.
+   */
+  void store(const std::string& serial_number, const CachedConfiguration& configuration);
+
+  /*!
+   * \brief Drops all configurations kept in memory. Persisted configurations are kept.
+   */
+  void clear();
+
+  /*!
+   * \brief Builds the key of a configuration from the serial number and the checksums and
+   * integrity hash of the config metadata.
+   *
+   * \param serial_number The serial number of the sensor.
+   * \param config_metadata The config metadata of the current configuration.
+   * \return The key of the configuration.
+   */
+  static std::string makeKey(const datastructure::SerialNumber& serial_number,
+                             const datastructure::ConfigMetadata& config_metadata);
+
+private:
+  std::string m_directory;
+  std::mutex m_mutex;
+  std::map<std::string, CachedConfiguration> m_configurations;
+
+  std::string getFilePath(const std::string& serial_number) const;
+  bool readFile(const std::string& serial_number, CachedConfiguration& configuration) const;
+  void writeFile(const std::string& serial_number, const CachedConfiguration& configuration) const;
+};
+
+} // namespace cola2
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONCACHE_H
@@ -0,0 +1,165 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationLoader.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONLOADER_H
+#define SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONLOADER_H
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/cola2/Cola2Session.h"
+#include "sick_safetyscanners_base/cola2/ConfigurationCache.h"
+#include "sick_safetyscanners_base/cola2/VariableCommand.h"
+#include "sick_safetyscanners_base/datastructure/SensorConfiguration.h"
+
+#include <memory>
+#include <vector>
+
+namespace sick {
+namespace cola2 {
+
+/*!
+ * \brief Time and COLA2 traffic spent on loading a sensor configuration.
+ */
+struct ConfigurationLoaderStatistics
+{
+  sick::types::time_duration_t duration;
+  uint64_t commands{0};
+  uint64_t round_trips{0};
+  bool from_cache{false};
+};
+
+/*!
+ * \brief Loads the configuration of a sensor in bulk. All commands are pipelined in one COLA2
+ * session. Since the sensor does not report the number of fields and monitoring cases, they are
+ * probed in rounds of one pipeline window each, until the first invalid entry is returned. The
+ * geometries of the fields found valid are fetched along with the next round.
+ *
+ * If a configuration cache is set, only the serial number and the config metadata are requested
+ * first. If the cache holds the configuration for this key, the recorded replies are processed
+ * instead of requesting them again. Otherwise the configuration is loaded from the sensor and the
+ * replies are stored in the cache, merged with the replies already cached for this key.
+ *
+ * Instead of the whole configuration only the fields or only the monitoring cases can be loaded,
+ * along with the serial number and the config metadata.
+ */
+class ConfigurationLoader
+{
+public:
+  /*!
+   * \brief The parts of the configuration to load.
+   */
+  enum Content
+  {
+    FIELDS           = 1 << 0,
+    MONITORING_CASES = 1 << 1,
+    ALL              = 0xFF
+  };
+
+  /*!
+   * \brief Constructor of the configuration loader.
+   *
+   * \param session The COLA2 session to load the configuration with.
+   * \param window The maximum number of commands awaiting their reply at the same time.
+   */
+  explicit ConfigurationLoader(Cola2Session& session,
+                               std::size_t window = Cola2Session::DEFAULT_PIPELINE_WINDOW);
+
+  /*!
+   * \brief Loads the configuration from the sensor. The session is kept open during loading and
+   * the session reuse setting is restored afterwards.
+   *
+   * \param configuration Returned sensor configuration.
+   * \param content The parts of the configuration to load. Without ALL, only the fields and the
+   * current config they depend on or only the monitoring cases are set in the configuration.
+   */
+  void load(datastructure::SensorConfiguration& configuration, Content content = ALL);
+
+  /*!
+   * \brief Sets the cache to look up the configuration in before loading it from the sensor.
+   *
+   * \param cache The configuration cache, or nullptr to always load from the sensor.
+   */
+  void setCache(std::shared_ptr<ConfigurationCache> cache);
+
+  /*!
+   * \brief Returns the time and COLA2 traffic spent on the last load.
+   *
+   * \return The duration, number of commands and round trips of the last load.
+   */
+  ConfigurationLoaderStatistics getStatistics() const;
+
+  /*!
+   * \brief Maximum number of fields, index 0 is reserved for contour data.
+   */
+  static const uint16_t MAX_NUM_FIELDS = 128;
+
+  /*!
+   * \brief Maximum number of monitoring cases.
+   */
+  static const uint16_t MAX_NUM_MONITORING_CASES = 254;
+
+private:
+  Cola2Session& m_session;
+  std::size_t m_window;
+  std::shared_ptr<ConfigurationCache> m_cache;
+  ConfigurationLoaderStatistics m_statistics;
+  CachedConfiguration m_replies;
+  bool m_replay;
+  Content m_content;
+
+  /*!
+   * \brief Loads the configuration from the cache if its key matches, from the sensor otherwise.
+   *
+   * \param configuration Returned sensor configuration.
+   */
+  void loadCached(datastructure::SensorConfiguration& configuration);
+
+  /*!
+   * \brief Sends the probing rounds of the selected content and moves the results into the
+   * configuration.
+   *
+   * \param configuration Returned sensor configuration.
+   */
+  void loadPipelined(datastructure::SensorConfiguration& configuration);
+
+  /*!
+   * \brief Executes a batch of commands pipelined and clears it afterwards. The replies are
+   * recorded, or taken from the recorded replies when replaying.
+   *
+   * \param commands The commands to execute.
+   */
+  void execute(std::vector<std::unique_ptr<VariableCommand> >& commands);
+};
+
+} // namespace cola2
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COLA2_CONFIGURATIONLOADER_H
@@ -52,7 +52,7 @@ public:
    *
    * \param session The new session which will be setup.
    */
-  explicit CreateSession(Cola2Session& session);
+  explicit CreateSession(Cola2SessionState& session);
 
   /*!
    * \brief Adds the data to the telegram.
@@ -79,8 +79,8 @@ public:
 private:
   /*std::vector<uint8_t>
   prepareTelegramAndGetDataPtr(const std::vector<uint8_t>& telegram) const;*/
-  void writeHeartbeatTimeoutToDataPtr(std::vector<uint8_t>::iterator it) const;
-  void writeClientIdToDataPtr(std::vector<uint8_t>::iterator it) const;
+  void writeHeartbeatTimeoutToDataPtr(read_write_helper::ByteSpan data_ptr) const;
+  void writeClientIdToDataPtr(read_write_helper::ByteSpan data_ptr) const;
 };
 
 } // namespace cola2
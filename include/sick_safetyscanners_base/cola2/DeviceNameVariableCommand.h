@@ -59,7 +59,7 @@ public:
    * \param session The current cola2 session.
    * \param device_name The variable to which the device name will be written on execution.
    */
-  DeviceNameVariableCommand(Cola2Session& session, datastructure::DeviceName& device_name);
+  DeviceNameVariableCommand(Cola2SessionState& session, datastructure::DeviceName& device_name);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
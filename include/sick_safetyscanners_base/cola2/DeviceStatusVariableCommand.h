@@ -61,7 +61,7 @@ public:
    * \param device_status Reference to the device status variable, which will be written on
    * execution.
    */
-  DeviceStatusVariableCommand(Cola2Session& session, datastructure::DeviceStatus& device_status);
+  DeviceStatusVariableCommand(Cola2SessionState& session, datastructure::DeviceStatus& device_status);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
@@ -65,7 +65,7 @@ public:
    * \param field_data The field data reference which will be modified on execution.
    * \param index The variable index in a range of [0, 127].
    */
-  FieldGeometryVariableCommand(Cola2Session& session,
+  FieldGeometryVariableCommand(Cola2SessionState& session,
                                datastructure::FieldData& field_data,
                                const uint16_t& index);
 
@@ -65,7 +65,7 @@ public:
    * \param field_data Reference to field data, which will be modified on execution.
    * \param index Index of the variable. Can range from [0, 127].
    */
-  FieldHeaderVariableCommand(Cola2Session& session,
+  FieldHeaderVariableCommand(Cola2SessionState& session,
                              datastructure::FieldData& field_data,
                              const uint16_t& index);
 
@@ -61,7 +61,7 @@ public:
    * \param field_sets Reference to the user name variable, which will be written on
    * execution.
    */
-  FieldSetsVariableCommand(Cola2Session& session, datastructure::FieldSets& field_sets);
+  FieldSetsVariableCommand(Cola2SessionState& session, datastructure::FieldSets& field_sets);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
@@ -61,7 +61,7 @@ public:
    * \param session The current Cola2 session, in which the parameters should be transferred.
    * \param blink_time Time to flash for.
    */
-  FindMeCommand(Cola2Session& session, uint16_t blink_time);
+  FindMeCommand(Cola2SessionState& session, uint16_t blink_time);
 
 
   /*!
@@ -94,7 +94,7 @@ public:
 private:
   uint16_t m_blink_time;
 
-  void writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr) const;
+  void writeDataToDataPtr(read_write_helper::ByteSpan data_ptr) const;
 };
 
 } // namespace cola2
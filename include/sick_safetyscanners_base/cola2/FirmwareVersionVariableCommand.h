@@ -61,7 +61,7 @@ public:
    * \param firmware_version The variable to which the firmware version will be written on
    * execution.
    */
-  FirmwareVersionVariableCommand(Cola2Session& session,
+  FirmwareVersionVariableCommand(Cola2SessionState& session,
                                  datastructure::FirmwareVersion& firmware_version);
 
   /*!
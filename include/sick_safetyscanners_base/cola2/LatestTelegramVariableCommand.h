@@ -60,7 +60,7 @@ public:
    * \param data The variable to which the  Measurement Data  will be written on execution.
    * \param index Index of the Channel, up to 4 channels can be supported by the cola protocol
    */
-  LatestTelegramVariableCommand(Cola2Session& session,
+  LatestTelegramVariableCommand(Cola2SessionState& session,
                                 datastructure::Data& data,
                                 const int8_t index = 0);
 
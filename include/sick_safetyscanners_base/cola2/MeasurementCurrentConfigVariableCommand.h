@@ -63,7 +63,7 @@ public:
    * \param session The current cola2 session.
    * \param config_data The config data reference which will be modified on execution.
    */
-  MeasurementCurrentConfigVariableCommand(Cola2Session& session,
+  MeasurementCurrentConfigVariableCommand(Cola2SessionState& session,
                                           datastructure::ConfigData& config_data);
 
   /*!
@@ -64,7 +64,7 @@ public:
    * \param session The current cola2 session.
    * \param config_data The config data reference which will be modified on execution.
    */
-  MeasurementPersistentConfigVariableCommand(Cola2Session& session,
+  MeasurementPersistentConfigVariableCommand(Cola2SessionState& session,
                                              datastructure::ConfigData& config_data);
 
   /*!
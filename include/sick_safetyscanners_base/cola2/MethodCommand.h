@@ -52,7 +52,7 @@ public:
    * \param session The current cola2 session.
    * \param method_index The index of the method to call in the sensor.
    */
-  MethodCommand(Cola2Session& session, const uint16_t& method_index);
+  MethodCommand(Cola2SessionState& session, const uint16_t& method_index);
 
   /*!
    * \brief Adds the data to the telegram.
@@ -63,7 +63,7 @@ public:
    *
    * TODO
    */
-  MonitoringCaseTableHeaderVariableCommand(Cola2Session& session,
+  MonitoringCaseTableHeaderVariableCommand(Cola2SessionState& session,
                                            datastructure::FieldData& field_data);
 
   /*!
@@ -63,7 +63,7 @@ public:
    * \param index Index of the variable to ask from the sensor, in range [0-254]
    *
    */
-  MonitoringCaseVariableCommand(Cola2Session& session,
+  MonitoringCaseVariableCommand(Cola2SessionState& session,
                                 datastructure::MonitoringCaseData& monitoring_case_data,
                                 const uint16_t& index);
 
@@ -60,7 +60,7 @@ public:
    * \param session The current cola2 session.
    * \param order_number The variable to which the order number will be written on execution.
    */
-  OrderNumberVariableCommand(Cola2Session& session, datastructure::OrderNumber& order_number);
+  OrderNumberVariableCommand(Cola2SessionState& session, datastructure::OrderNumber& order_number);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
@@ -60,7 +60,7 @@ public:
    * \param session The current cola2 session.
    * \param project_name The variable to which the project name will be written on execution.
    */
-  ProjectNameVariableCommand(Cola2Session& session, datastructure::ProjectName& project_name);
+  ProjectNameVariableCommand(Cola2SessionState& session, datastructure::ProjectName& project_name);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
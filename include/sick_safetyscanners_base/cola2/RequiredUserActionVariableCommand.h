@@ -61,7 +61,7 @@ public:
    * \param required_user_action Reference to the required user action variable, which will be
    * written on execution.
    */
-  RequiredUserActionVariableCommand(Cola2Session& session,
+  RequiredUserActionVariableCommand(Cola2SessionState& session,
                                     datastructure::RequiredUserAction& required_user_action);
 
   /*!
@@ -60,7 +60,7 @@ public:
    * \param session The current cola2 session.
    * \param serial_number The variable to which the serial number will be written on execution.
    */
-  SerialNumberVariableCommand(Cola2Session& session, datastructure::SerialNumber& serial_number);
+  SerialNumberVariableCommand(Cola2SessionState& session, datastructure::SerialNumber& serial_number);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
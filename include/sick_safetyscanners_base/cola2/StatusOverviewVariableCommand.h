@@ -61,7 +61,7 @@ public:
    * \param status_overview Reference to the status overview variable, which will be written on
    * execution.
    */
-  StatusOverviewVariableCommand(Cola2Session& session,
+  StatusOverviewVariableCommand(Cola2SessionState& session,
                                 datastructure::StatusOverview& status_overview);
 
   /*!
@@ -60,7 +60,7 @@ public:
    * \param session The current cola2 session.
    * \param type_code Reference to the type code variable, which will be written on execution.
    */
-  TypeCodeVariableCommand(Cola2Session& session, datastructure::TypeCode& type_code);
+  TypeCodeVariableCommand(Cola2SessionState& session, datastructure::TypeCode& type_code);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
@@ -61,7 +61,7 @@ public:
    * \param user_name Reference to the user name variable, which will be written on
    * execution.
    */
-  UserNameVariableCommand(Cola2Session& session, datastructure::UserName& user_name);
+  UserNameVariableCommand(Cola2SessionState& session, datastructure::UserName& user_name);
 
   /*!
    * \brief Returns if the command can be executed without a session ID. Will return false for most
@@ -0,0 +1,164 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file AsyncTCPClient.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCTCPCLIENT_H
+#define SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCTCPCLIENT_H
+
+#include <boost/asio.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "sick_safetyscanners_base/Types.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+namespace sick {
+namespace communication {
+
+/*!
+ * \brief An asynchronous TCPClient running on a shared io_service. All operations complete through
+ * handlers which are invoked through the strand passed to the constructor, so the operations and
+ * their handlers do not need further synchronization. Only one operation of each kind may be
+ * outstanding at a time.
+ *
+ */
+class AsyncTCPClient
+{
+public:
+  /*!
+   * \brief Type definition for handlers of connect and send operations.
+   */
+  using Handler = std::function<void(const boost::system::error_code&)>;
+
+  /*!
+   * \brief Type definition for handlers of receive operations.
+   */
+  using ReceiveHandler =
+    std::function<void(const boost::system::error_code&, const sick::datastructure::PacketBuffer&)>;
+
+  /*!
+   * \brief Constructor of an AsyncTCPClient object.
+   *
+   * \param strand The strand of the io_service all handlers are invoked through.
+   * \param server_ip The IP address of the server to connect to.
+   * \param server_port The target port on the server to connect to.
+   */
+  AsyncTCPClient(boost::asio::io_service::strand& strand,
+                 sick::types::ip_address_t server_ip,
+                 sick::types::port_t server_port);
+
+  AsyncTCPClient()                      = delete;
+  AsyncTCPClient(const AsyncTCPClient&) = delete;
+  AsyncTCPClient& operator=(const AsyncTCPClient&) = delete;
+
+  /*!
+   * \brief Starts to establish a connection to the sensor. The handler receives
+   * boost::asio::error::timed_out if the timeout is exceeded.
+   *
+   * \param timeout A timeout limit to establish a new connection.
+   * \param handler The handler called once the connection is established or has failed.
+   */
+  void connect(sick::types::time_duration_t timeout, Handler handler);
+
+  /*!
+   * \brief Disconnects this client from the sensor. Outstanding operations complete with
+   * boost::asio::error::operation_aborted.
+   *
+   */
+  void disconnect();
+
+  /*!
+   * \brief Starts to send a COLA2 telegram to the sensor. Does not wait for a reply.
+   *
+   * \param buffer A buffer which is required to contain a valid COLA 2 telegram. It is kept alive
+   * until the send operation has completed.
+   * \param handler The handler called once the buffer has been sent or sending has failed.
+   */
+  void send(std::shared_ptr<const std::vector<uint8_t>> buffer, Handler handler);
+
+  /*!
+   * \brief Starts to receive the next bytes of the TCP stream. The handler receives
+   * boost::asio::error::timed_out if the timeout is exceeded.
+   *
+   * \param timeout A timeout limit on the receive operation.
+   * \param handler The handler called with the received bytes.
+   */
+  void receive(sick::types::time_duration_t timeout, ReceiveHandler handler);
+
+  /*!
+   * \brief Indicates whether the TCP socket is currently opened.
+   *
+   * \return true The socket is open.
+   * \return false The socket is closed.
+   */
+  bool isConnected() const;
+
+private:
+  boost::asio::io_service::strand& m_strand;
+  boost::asio::ip::tcp::socket m_socket;
+  sick::types::ip_address_t m_server_ip;
+  sick::types::port_t m_server_port;
+  boost::asio::deadline_timer m_deadline;
+  bool m_is_deadline_exceeded;
+  sick::datastructure::PacketBuffer::ArrayBuffer m_recv_buffer;
+
+  /*!
+   * \brief Arms the deadline of a connect or receive operation. The socket is closed once the
+   * deadline expires, which aborts the outstanding operations.
+   *
+   * \param timeout The timeout of the operation.
+   */
+  void startDeadline(sick::types::time_duration_t timeout);
+
+  /*!
+   * \brief Disarms the deadline once the operation has completed and translates an operation
+   * aborted by the deadline into boost::asio::error::timed_out.
+   *
+   * \param ec The error code of the completed operation.
+   * \return The error code to pass to the handler.
+   */
+  boost::system::error_code stopDeadline(const boost::system::error_code& ec);
+
+  /*!
+   * \brief Internal callback of the deadline timer.
+   *
+   * \param ec A boost::system error code.
+   */
+  void handleDeadline(const boost::system::error_code& ec);
+};
+
+} // namespace communication
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCTCPCLIENT_H
@@ -37,16 +37,32 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCUDPCLIENT_H
 #define SICK_SAFETYSCANNERS_BASE_COMMUNICATION_ASYNCUDPCLIENT_H
 
+#include <atomic>
 #include <iostream>
+#include <vector>
 
 #include <boost/asio.hpp>
 
 #include "sick_safetyscanners_base/Types.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/PacketBufferPool.h"
 
 namespace sick {
 namespace communication {
 
+/*!
+ * \brief Counters of the asynchronous receive path. They allow to compare the number of receive
+ * system calls and handler dispatches against the number of received datagrams. Datagrams are
+ * dropped if the consumer still references all receive slots.
+ */
+struct UDPClientStatistics
+{
+  uint64_t datagrams{0};
+  uint64_t receive_syscalls{0};
+  uint64_t handler_dispatches{0};
+  uint64_t dropped_datagrams{0};
+};
+
 /*!
  * \brief A UDP client allowing for synchronous and asynchronous receiving of sensor data.
  *
@@ -86,6 +102,23 @@ public:
     beginReceive();
   }
 
+  /*!
+   * \brief Asynchronous function to subscribe to the sensor data stream in batched mode. On every
+   * wakeup of the socket all pending datagrams are drained at once (via recvmmsg on Linux) and
+   * handed over to the callback as one batch.
+   *
+   * 	param Callable
+   * \param callback A callback of variable templated type Callable to support various formats like
+   * std::function, which is called with a std::vector of packet buffers.
+   */
+  template <typename Callable>
+  void runBatched(Callable&& callback)
+  {
+    m_packet_batch_handler = callback;
+    prepareBatchSlots();
+    beginBatchReceive();
+  }
+
   /*!
    * \brief Stops the currently running asynchronous sensor data stream subscribers.
    *
@@ -124,14 +157,49 @@ public:
    */
   sick::datastructure::PacketBuffer receive(sick::types::time_duration_t timeout);
 
+  /*!
+   * \brief Returns the counters of the asynchronous receive path.
+   *
+   * \return The number of received datagrams, issued receive system calls and dispatched handlers.
+   */
+  UDPClientStatistics getStatistics() const;
+
+  /*!
+   * \brief Maximum number of datagrams drained with a single receive system call in batched mode.
+   */
+  static const std::size_t MAX_BATCH_SIZE = 16;
+
+  /*!
+   * \brief Number of preallocated receive slots. Received packet buffers reference these slots
+   * until they are released by the consumer. Reassembled scans keep referencing the slots of their
+   * fragments.
+   */
+  static const std::size_t PACKET_POOL_SIZE = 128;
+
+  /*!
+   * \brief Maximum number of receive slots the pool grows to if the consumer retains packet
+   * buffers. Further datagrams are dropped until slots are released.
+   */
+  static const std::size_t PACKET_POOL_MAX_SIZE = 1024;
+
 private:
   boost::asio::io_service& m_io_service;
   boost::asio::ip::udp::endpoint m_remote_endpoint;
   boost::asio::ip::udp::socket m_socket;
   types::PacketHandler m_packet_handler;
-  datastructure::PacketBuffer::ArrayBuffer m_recv_buffer;
+  types::PacketBatchHandler m_packet_batch_handler;
+  datastructure::PacketBufferPool m_packet_pool;
+  datastructure::PacketBufferPool::Slot m_recv_slot;
+  datastructure::PacketBuffer::ArrayBuffer m_discard_buffer;
+  std::vector<datastructure::PacketBufferPool::Slot> m_batch_slots;
+  std::vector<datastructure::PacketBuffer> m_batch;
   boost::asio::deadline_timer m_deadline;
 
+  std::atomic<uint64_t> m_num_datagrams;
+  std::atomic<uint64_t> m_num_receive_syscalls;
+  std::atomic<uint64_t> m_num_handler_dispatches;
+  std::atomic<uint64_t> m_num_dropped_datagrams;
+
   /*!
    * \brief A function to check internal deadline constraints on connect, receive and send
    * opterations of boost::asio.
@@ -154,6 +222,34 @@ private:
    */
   void beginReceive();
 
+  /*!
+   * \brief Sizes the receive slots and reserves the bookkeeping containers used in batched mode.
+   * The slots are kept across wakeups and only replaced once they have been handed out.
+   *
+   */
+  void prepareBatchSlots();
+
+  /*!
+   * \brief Internal function to wait for the socket to become readable in batched mode.
+   *
+   */
+  void beginBatchReceive();
+
+  /*!
+   * \brief Internal callback function in batched mode. Drains all pending datagrams into the
+   * receive slots, passes them to the batch handler and begins a new receive-cycle.
+   *
+   * \param ec A boost::system error code.
+   */
+  void handleBatchReceive(boost::system::error_code ec);
+
+  /*!
+   * \brief Reads as many pending datagrams as fit into the receive slots without blocking.
+   *
+   * \return The number of datagrams written to the receive slots.
+   */
+  std::size_t receivePendingDatagrams();
+
   /*!
    * \brief Helper function to set error_codes if an internal deadline has been exceeded.
    *
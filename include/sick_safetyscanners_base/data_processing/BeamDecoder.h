@@ -0,0 +1,130 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file BeamDecoder.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BEAMDECODER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BEAMDECODER_H
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Decodes the beam records of the measurement data block into separate columns.
+ *
+ * Each beam record consists of 4 bytes: a little endian uint16 distance, a uint8 reflectivity and a
+ * uint8 status byte. All kernels produce identical results. The SIMD kernels are selected at
+ * runtime depending on the capabilities of the CPU and can be disabled at build time by defining
+ * SICK_DISABLE_SIMD.
+ */
+class BeamDecoder
+{
+public:
+  /*!
+   * \brief The instruction sets a decoding kernel is available for.
+   */
+  enum InstructionSet
+  {
+    SCALAR,
+    SSE2,
+    AVX2
+  };
+
+  /*!
+   * \brief Size of a single beam record in bytes.
+   */
+  static const std::size_t BEAM_SIZE = 4;
+
+  /*!
+   * \brief Decodes the beam records with the best kernel supported by the CPU.
+   *
+   * \param beams Pointer to the first beam record.
+   * \param num_beams Number of beam records to decode.
+   * \param distances Output column for the distances, has to hold num_beams values.
+   * \param reflectivities Output column for the reflectivities, has to hold num_beams values.
+   * \param status_bytes Output column for the status bytes, has to hold num_beams values.
+   */
+  static void decode(const uint8_t* beams,
+                     std::size_t num_beams,
+                     uint16_t* distances,
+                     uint8_t* reflectivities,
+                     uint8_t* status_bytes);
+
+  /*!
+   * \brief Decodes the beam records with the kernel of the given instruction set. Falls back to
+   * the scalar kernel if the instruction set is not available.
+   */
+  static void decode(InstructionSet instruction_set,
+                     const uint8_t* beams,
+                     std::size_t num_beams,
+                     uint16_t* distances,
+                     uint8_t* reflectivities,
+                     uint8_t* status_bytes);
+
+  /*!
+   * \brief Returns the best instruction set supported by the build and the CPU.
+   *
+   * \returns The instruction set used by decode().
+   */
+  static InstructionSet getInstructionSet();
+
+  /*!
+   * \brief Returns if the kernel of the given instruction set can be used on this machine.
+   *
+   * \param instruction_set The instruction set to check.
+   * \returns If the instruction set is supported by the build and the CPU.
+   */
+  static bool isSupported(InstructionSet instruction_set);
+
+private:
+  static void decodeScalar(const uint8_t* beams,
+                           std::size_t num_beams,
+                           uint16_t* distances,
+                           uint8_t* reflectivities,
+                           uint8_t* status_bytes);
+  static void decodeSse2(const uint8_t* beams,
+                         std::size_t num_beams,
+                         uint16_t* distances,
+                         uint8_t* reflectivities,
+                         uint8_t* status_bytes);
+  static void decodeAvx2(const uint8_t* beams,
+                         std::size_t num_beams,
+                         uint16_t* distances,
+                         uint8_t* reflectivities,
+                         uint8_t* status_bytes);
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_BEAMDECODER_H
@@ -0,0 +1,96 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataBlockParser.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATABLOCKPARSER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATABLOCKPARSER_H
+
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/DataBlockDecoder.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
+#include "sick_safetyscanners_base/data_processing/ParseGeneralSystemState.h"
+#include "sick_safetyscanners_base/data_processing/ParseIntrusionData.h"
+#include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
+
+#include <memory>
+#include <mutex>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Decodes the blocks left pending in a data object on their first access.
+ *
+ * The measurement and intrusion data parsers keep state between scans, calls to them are
+ * serialized.
+ */
+class DataBlockParser : public sick::datastructure::DataBlockDecoder
+{
+public:
+  /*!
+   * \brief Constructor of the parser.
+   */
+  DataBlockParser();
+
+  void decodeGeneralSystemState(
+    const sick::datastructure::PacketBuffer& buffer,
+    const sick::datastructure::Data& data,
+    sick::datastructure::GeneralSystemState& general_system_state) const override;
+
+  void decodeMeasurementData(const sick::datastructure::PacketBuffer& buffer,
+                             const sick::datastructure::Data& data,
+                             sick::datastructure::MeasurementData& measurement_data) const override;
+
+  void decodeIntrusionData(const sick::datastructure::PacketBuffer& buffer,
+                           const sick::datastructure::Data& data,
+                           sick::datastructure::IntrusionData& intrusion_data) const override;
+
+  void decodeApplicationData(const sick::datastructure::PacketBuffer& buffer,
+                             const sick::datastructure::Data& data,
+                             sick::datastructure::ApplicationData& application_data) const override;
+
+private:
+  std::shared_ptr<sick::data_processing::ParseGeneralSystemState> m_general_system_state_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseMeasurementData> m_measurement_data_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseIntrusionData> m_intrusion_data_parser_ptr;
+  std::shared_ptr<sick::data_processing::ParseApplicationData> m_application_data_parser_ptr;
+
+  mutable std::mutex m_measurement_data_mutex;
+  mutable std::mutex m_intrusion_data_mutex;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATABLOCKPARSER_H
@@ -0,0 +1,374 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataLayout.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATALAYOUT_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATALAYOUT_H
+
+#include "sick_safetyscanners_base/data_processing/FieldLayout.h"
+#include "sick_safetyscanners_base/datastructure/DataHeader.h"
+#include "sick_safetyscanners_base/datastructure/DerivedValues.h"
+#include "sick_safetyscanners_base/datastructure/GeneralSystemState.h"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Layouts of the blocks of a scan as sent by the sensor. The offsets are relative to the
+ * start of the respective block. They are shared by the parsers and the DataView, so both read the
+ * same bytes.
+ */
+namespace data_layout {
+
+namespace data_header {
+
+using datastructure::DataHeader;
+
+typedef Field<DataHeader, uint8_t, 0, Endianness::LITTLE, &DataHeader::setVersionIndicator>
+  VersionIndicator;
+typedef Field<DataHeader, uint8_t, 1, Endianness::LITTLE, &DataHeader::setVersionMajorVersion>
+  VersionMajorVersion;
+typedef Field<DataHeader, uint8_t, 2, Endianness::LITTLE, &DataHeader::setVersionMinorVersion>
+  VersionMinorVersion;
+typedef Field<DataHeader, uint8_t, 3, Endianness::LITTLE, &DataHeader::setVersionRelease>
+  VersionRelease;
+typedef Field<DataHeader, uint32_t, 4, Endianness::LITTLE, &DataHeader::setSerialNumberOfDevice>
+  SerialNumberOfDevice;
+typedef Field<DataHeader, uint32_t, 8, Endianness::LITTLE, &DataHeader::setSerialNumberOfSystemPlug>
+  SerialNumberOfSystemPlug;
+typedef Field<DataHeader, uint8_t, 12, Endianness::LITTLE, &DataHeader::setChannelNumber>
+  ChannelNumber;
+typedef Field<DataHeader, uint32_t, 16, Endianness::LITTLE, &DataHeader::setSequenceNumber>
+  SequenceNumber;
+typedef Field<DataHeader, uint32_t, 20, Endianness::LITTLE, &DataHeader::setScanNumber>
+  ScanNumber;
+typedef Field<DataHeader, uint16_t, 24, Endianness::LITTLE, &DataHeader::setTimestampDate>
+  TimestampDate;
+typedef Field<DataHeader, uint32_t, 28, Endianness::LITTLE, &DataHeader::setTimestampTime>
+  TimestampTime;
+typedef Field<DataHeader,
+              uint16_t,
+              32,
+              Endianness::LITTLE,
+              &DataHeader::setGeneralSystemStateBlockOffset>
+  GeneralSystemStateBlockOffset;
+typedef Field<DataHeader,
+              uint16_t,
+              34,
+              Endianness::LITTLE,
+              &DataHeader::setGeneralSystemStateBlockSize>
+  GeneralSystemStateBlockSize;
+typedef Field<DataHeader,
+              uint16_t,
+              36,
+              Endianness::LITTLE,
+              &DataHeader::setDerivedValuesBlockOffset>
+  DerivedValuesBlockOffset;
+typedef Field<DataHeader, uint16_t, 38, Endianness::LITTLE, &DataHeader::setDerivedValuesBlockSize>
+  DerivedValuesBlockSize;
+typedef Field<DataHeader,
+              uint16_t,
+              40,
+              Endianness::LITTLE,
+              &DataHeader::setMeasurementDataBlockOffset>
+  MeasurementDataBlockOffset;
+typedef Field<DataHeader,
+              uint16_t,
+              42,
+              Endianness::LITTLE,
+              &DataHeader::setMeasurementDataBlockSize>
+  MeasurementDataBlockSize;
+typedef Field<DataHeader,
+              uint16_t,
+              44,
+              Endianness::LITTLE,
+              &DataHeader::setIntrusionDataBlockOffset>
+  IntrusionDataBlockOffset;
+typedef Field<DataHeader, uint16_t, 46, Endianness::LITTLE, &DataHeader::setIntrusionDataBlockSize>
+  IntrusionDataBlockSize;
+typedef Field<DataHeader,
+              uint16_t,
+              48,
+              Endianness::LITTLE,
+              &DataHeader::setApplicationDataBlockOffset>
+  ApplicationDataBlockOffset;
+typedef Field<DataHeader,
+              uint16_t,
+              50,
+              Endianness::LITTLE,
+              &DataHeader::setApplicationDataBlockSize>
+  ApplicationDataBlockSize;
+
+typedef FieldLayout<VersionIndicator,
+                    VersionMajorVersion,
+                    VersionMinorVersion,
+                    VersionRelease,
+                    SerialNumberOfDevice,
+                    SerialNumberOfSystemPlug,
+                    ChannelNumber,
+                    SequenceNumber,
+                    ScanNumber,
+                    TimestampDate,
+                    TimestampTime,
+                    GeneralSystemStateBlockOffset,
+                    GeneralSystemStateBlockSize,
+                    DerivedValuesBlockOffset,
+                    DerivedValuesBlockSize,
+                    MeasurementDataBlockOffset,
+                    MeasurementDataBlockSize,
+                    IntrusionDataBlockOffset,
+                    IntrusionDataBlockSize,
+                    ApplicationDataBlockOffset,
+                    ApplicationDataBlockSize>
+  Layout;
+
+} // namespace data_header
+
+namespace general_system_state {
+
+using datastructure::GeneralSystemState;
+
+/*!
+ * \brief Status bits, bit 6 and 7 are reserved.
+ */
+typedef FieldPosition<uint8_t, 0> StatusBits;
+constexpr uint8_t RUN_MODE_ACTIVE_BIT          = 0;
+constexpr uint8_t STANDBY_MODE_ACTIVE_BIT      = 1;
+constexpr uint8_t CONTAMINATION_WARNING_BIT    = 2;
+constexpr uint8_t CONTAMINATION_ERROR_BIT      = 3;
+constexpr uint8_t REFERENCE_CONTOUR_STATUS_BIT = 4;
+constexpr uint8_t MANIPULATION_STATUS_BIT      = 5;
+
+/*!
+ * \brief The cut-off paths are transmitted as 24 bit little endian words, only 20 of the bits are
+ * used.
+ */
+typedef FieldPosition<uint32_t, 1, Endianness::LITTLE, 3> SafeCutOffPath;
+typedef FieldPosition<uint32_t, 4, Endianness::LITTLE, 3> NonSafeCutOffPath;
+typedef FieldPosition<uint32_t, 7, Endianness::LITTLE, 3> ResetRequiredCutOffPath;
+
+typedef Field<GeneralSystemState,
+              uint8_t,
+              10,
+              Endianness::LITTLE,
+              &GeneralSystemState::setCurrentMonitoringCaseNoTable1>
+  CurrentMonitoringCaseNoTable1;
+typedef Field<GeneralSystemState,
+              uint8_t,
+              11,
+              Endianness::LITTLE,
+              &GeneralSystemState::setCurrentMonitoringCaseNoTable2>
+  CurrentMonitoringCaseNoTable2;
+typedef Field<GeneralSystemState,
+              uint8_t,
+              12,
+              Endianness::LITTLE,
+              &GeneralSystemState::setCurrentMonitoringCaseNoTable3>
+  CurrentMonitoringCaseNoTable3;
+typedef Field<GeneralSystemState,
+              uint8_t,
+              13,
+              Endianness::LITTLE,
+              &GeneralSystemState::setCurrentMonitoringCaseNoTable4>
+  CurrentMonitoringCaseNoTable4;
+
+/*!
+ * \brief Error bits, the remaining bits are reserved.
+ */
+typedef FieldPosition<uint8_t, 15> ErrorBits;
+constexpr uint8_t APPLICATION_ERROR_BIT = 0;
+constexpr uint8_t DEVICE_ERROR_BIT      = 1;
+
+} // namespace general_system_state
+
+namespace derived_values {
+
+using datastructure::DerivedValues;
+
+typedef Field<DerivedValues,
+              uint16_t,
+              0,
+              Endianness::LITTLE,
+              &DerivedValues::setMultiplicationFactor>
+  MultiplicationFactor;
+typedef Field<DerivedValues, uint16_t, 2, Endianness::LITTLE, &DerivedValues::setNumberOfBeams>
+  NumberOfBeams;
+typedef Field<DerivedValues, uint16_t, 4, Endianness::LITTLE, &DerivedValues::setScanTime>
+  ScanTime;
+typedef Field<DerivedValues, int32_t, 8, Endianness::LITTLE, &DerivedValues::setStartAngle>
+  StartAngle;
+typedef Field<DerivedValues,
+              int32_t,
+              12,
+              Endianness::LITTLE,
+              &DerivedValues::setAngularBeamResolution>
+  AngularBeamResolution;
+typedef Field<DerivedValues, uint32_t, 16, Endianness::LITTLE, &DerivedValues::setInterbeamPeriod>
+  InterbeamPeriod;
+
+typedef FieldLayout<MultiplicationFactor,
+                    NumberOfBeams,
+                    ScanTime,
+                    StartAngle,
+                    AngularBeamResolution,
+                    InterbeamPeriod>
+  Layout;
+
+/*!
+ * \brief Resolution of the transmitted fixed point angles, see datastructure::DerivedValues.
+ */
+constexpr double ANGLE_RESOLUTION = 4194304.0;
+
+} // namespace derived_values
+
+namespace measurement_data {
+
+typedef FieldPosition<uint32_t, 0> NumberOfBeams;
+
+/*!
+ * \brief Offset of the first beam, the beams follow each other without gaps.
+ */
+constexpr std::size_t BEAMS_OFFSET = NumberOfBeams::END;
+
+/*!
+ * \brief Fields of a single beam, relative to the start of the beam.
+ */
+namespace beam {
+
+typedef FieldPosition<uint16_t, 0> Distance;
+typedef FieldPosition<uint8_t, 2> Reflectivity;
+typedef FieldPosition<uint8_t, 3> StatusByte;
+
+constexpr std::size_t SIZE = StatusByte::END;
+
+} // namespace beam
+
+} // namespace measurement_data
+
+namespace intrusion_data {
+
+/*!
+ * \brief Number of intrusion datums, one per cut-off path.
+ */
+constexpr std::size_t NUMBER_OF_DATUMS = 24;
+
+/*!
+ * \brief Fields of a single intrusion datum, relative to the start of the datum.
+ */
+namespace datum {
+
+typedef FieldPosition<uint32_t, 0> Size;
+
+/*!
+ * \brief Offset of the packed flags, which are Size bytes long.
+ */
+constexpr std::size_t FLAGS_OFFSET = Size::END;
+
+} // namespace datum
+
+} // namespace intrusion_data
+
+namespace application_data {
+
+/*!
+ * \brief Bits of the velocity flags of the inputs and the outputs, the remaining bits are reserved.
+ */
+constexpr uint8_t VELOCITY_0_VALID_BIT              = 0;
+constexpr uint8_t VELOCITY_1_VALID_BIT              = 1;
+constexpr uint8_t VELOCITY_0_TRANSMITTED_SAFELY_BIT = 4;
+constexpr uint8_t VELOCITY_1_TRANSMITTED_SAFELY_BIT = 5;
+
+/*!
+ * \brief Fields of the application inputs. Arrays are described by their first element, the
+ * elements follow each other without gaps.
+ */
+namespace inputs {
+
+typedef FieldPosition<uint32_t, 0> UnsafeInputsInputSources;
+typedef FieldPosition<uint32_t, 4> UnsafeInputsFlags;
+typedef FieldPosition<uint16_t, 12> MonitoringCases;
+typedef FieldPosition<uint32_t, 52> MonitoringCaseFlags;
+typedef FieldPosition<int16_t, 56> Velocity0;
+typedef FieldPosition<int16_t, 58> Velocity1;
+typedef FieldPosition<uint8_t, 60> VelocityFlags;
+typedef FieldPosition<int8_t, 74> SleepModeInput;
+
+} // namespace inputs
+
+/*!
+ * \brief Fields of the application outputs, relative to the start of the application data.
+ */
+namespace outputs {
+
+typedef FieldPosition<uint32_t, 140> EvalOut;
+typedef FieldPosition<uint32_t, 144> EvalOutIsSafe;
+typedef FieldPosition<uint32_t, 148> EvalOutIsValid;
+typedef FieldPosition<uint16_t, 152> MonitoringCases;
+typedef FieldPosition<uint32_t, 192> MonitoringCaseFlags;
+typedef FieldPosition<int8_t, 193> SleepModeOutput;
+
+/*!
+ * \brief Host error flags, bit 6 and 7 are reserved.
+ */
+typedef FieldPosition<uint8_t, 194> HostErrorFlags;
+constexpr uint8_t CONTAMINATION_WARNING_BIT      = 0;
+constexpr uint8_t CONTAMINATION_ERROR_BIT        = 1;
+constexpr uint8_t MANIPULATION_ERROR_BIT         = 2;
+constexpr uint8_t GLARE_BIT                      = 3;
+constexpr uint8_t REFERENCE_CONTOUR_INTRUDED_BIT = 4;
+constexpr uint8_t CRITICAL_ERROR_BIT             = 5;
+
+typedef FieldPosition<int16_t, 200> Velocity0;
+typedef FieldPosition<int16_t, 202> Velocity1;
+typedef FieldPosition<uint8_t, 204> VelocityFlags;
+typedef FieldPosition<int16_t, 208> ResultingVelocities;
+typedef FieldPosition<uint32_t, 248> ResultingVelocityFlags;
+
+/*!
+ * \brief Validity flags of the outputs, the remaining bits are reserved.
+ */
+typedef FieldPosition<uint8_t, 259> OutputFlags;
+constexpr uint8_t SLEEP_MODE_OUTPUT_IS_VALID_BIT = 0;
+constexpr uint8_t HOST_ERROR_FLAGS_ARE_VALID_BIT = 1;
+
+} // namespace outputs
+
+} // namespace application_data
+
+} // namespace data_layout
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATALAYOUT_H
@@ -0,0 +1,482 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataView.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATAVIEW_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATAVIEW_H
+
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/datastructure/ApplicationInputs.h"
+#include "sick_safetyscanners_base/datastructure/AngleTable.h"
+#include "sick_safetyscanners_base/datastructure/ApplicationOutputs.h"
+#include "sick_safetyscanners_base/datastructure/GeneralSystemState.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+#include "sick_safetyscanners_base/datastructure/ScanPoint.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+class DataView;
+
+/*!
+ * \brief Non-owning view onto one block of a scan. Fields are read from the bytes of the packet
+ * buffer on every access, which works for contiguous and fragmented buffers alike. A view of a
+ * block which is not published is empty, reading from it throws.
+ */
+class BlockView
+{
+public:
+  /*!
+   * \brief Constructs an empty view.
+   */
+  BlockView();
+
+  /*!
+   * \brief Returns if the block is not published in the scan.
+   *
+   * \returns True if the view does not cover any bytes.
+   */
+  bool isEmpty() const;
+
+  /*!
+   * \brief Returns the size of the block.
+   *
+   * \returns The size in bytes.
+   */
+  std::size_t getSize() const;
+
+protected:
+  /*!
+   * \brief Reads a little endian value at a position within the block.
+   *
+   * \param position Offset from the start of the block.
+   * \returns The value in host byte order.
+   */
+  template <typename ValueT>
+  ValueT read(std::size_t position) const
+  {
+    if (position > m_size || sizeof(ValueT) > m_size - position)
+    {
+      throw sick::runtime_error("Read beyond the end of the data block");
+    }
+    if (m_contiguous)
+    {
+      return read_write_helper::readLittleEndian<ValueT>(m_contiguous + m_offset + position);
+    }
+    uint8_t bytes[sizeof(ValueT)];
+    copyFromFragments(m_offset + position, sizeof(ValueT), bytes);
+    return read_write_helper::readLittleEndian<ValueT>(bytes);
+  }
+
+  /*!
+   * \brief Reads a field described by the data layout, see data_layout.
+   *
+   * \param position Offset of the record holding the field from the start of the block.
+   * \returns The value in host byte order.
+   */
+  template <typename FieldT>
+  typename FieldT::ValueType readField(std::size_t position = 0) const
+  {
+    static_assert(FieldT::ENDIANNESS == Endianness::LITTLE &&
+                    FieldT::SIZE == sizeof(typename FieldT::ValueType),
+                  "The data blocks only contain little endian fields of the width of their type");
+    return read<typename FieldT::ValueType>(position + FieldT::OFFSET);
+  }
+
+  /*!
+   * \brief Returns a view onto a part of the block.
+   *
+   * \param position Offset of the part from the start of the block.
+   * \param size Size of the part in bytes.
+   * \returns The view onto the part.
+   */
+  BlockView slice(std::size_t position, std::size_t size) const;
+
+private:
+  friend class DataView;
+
+  BlockView(const uint8_t* contiguous,
+            const datastructure::PacketBuffer::FragmentVector* fragments,
+            std::size_t offset,
+            std::size_t size);
+
+  void copyFromFragments(std::size_t offset, std::size_t length, uint8_t* destination) const;
+
+  const uint8_t* m_contiguous;
+  const datastructure::PacketBuffer::FragmentVector* m_fragments;
+  std::size_t m_offset;
+  std::size_t m_size;
+};
+
+/*!
+ * \brief View onto the data header, the getters mirror datastructure::DataHeader.
+ */
+class DataHeaderView : public BlockView
+{
+public:
+  DataHeaderView() = default;
+  explicit DataHeaderView(const BlockView& block);
+
+  uint8_t getVersionIndicator() const;
+  uint8_t getVersionMajorVersion() const;
+  uint8_t getVersionMinorVersion() const;
+  uint8_t getVersionRelease() const;
+  uint32_t getSerialNumberOfDevice() const;
+  uint32_t getSerialNumberOfSystemPlug() const;
+  uint8_t getChannelNumber() const;
+  uint32_t getSequenceNumber() const;
+  uint32_t getScanNumber() const;
+  uint16_t getTimestampDate() const;
+  uint32_t getTimestampTime() const;
+  uint16_t getGeneralSystemStateBlockOffset() const;
+  uint16_t getGeneralSystemStateBlockSize() const;
+  uint16_t getDerivedValuesBlockOffset() const;
+  uint16_t getDerivedValuesBlockSize() const;
+  uint16_t getMeasurementDataBlockOffset() const;
+  uint16_t getMeasurementDataBlockSize() const;
+  uint16_t getIntrusionDataBlockOffset() const;
+  uint16_t getIntrusionDataBlockSize() const;
+  uint16_t getApplicationDataBlockOffset() const;
+  uint16_t getApplicationDataBlockSize() const;
+
+  /*!
+   * \brief Size of the data header in bytes.
+   */
+  static const std::size_t SIZE = data_layout::data_header::Layout::SIZE;
+};
+
+/*!
+ * \brief View onto the general system state, the getters mirror
+ * datastructure::GeneralSystemState.
+ */
+class GeneralSystemStateView : public BlockView
+{
+public:
+  GeneralSystemStateView() = default;
+  explicit GeneralSystemStateView(const BlockView& block);
+
+  bool getRunModeActive() const;
+  bool getStandbyModeActive() const;
+  bool getContaminationWarning() const;
+  bool getContaminationError() const;
+  bool getReferenceContourStatus() const;
+  bool getManipulationStatus() const;
+  datastructure::GeneralSystemState::CutOffPathWord getSafeCutOffPath() const;
+  datastructure::GeneralSystemState::CutOffPathWord getNonSafeCutOffPath() const;
+  datastructure::GeneralSystemState::CutOffPathWord getResetRequiredCutOffPath() const;
+  uint8_t getCurrentMonitoringCaseNoTable1() const;
+  uint8_t getCurrentMonitoringCaseNoTable2() const;
+  uint8_t getCurrentMonitoringCaseNoTable3() const;
+  uint8_t getCurrentMonitoringCaseNoTable4() const;
+  bool getApplicationError() const;
+  bool getDeviceError() const;
+
+private:
+  template <typename FieldT>
+  datastructure::GeneralSystemState::CutOffPathWord readCutOffPath() const;
+  bool getStatusBit(uint8_t bit) const;
+  bool getErrorBit(uint8_t bit) const;
+};
+
+/*!
+ * \brief View onto the derived values, the getters mirror datastructure::DerivedValues.
+ */
+class DerivedValuesView : public BlockView
+{
+public:
+  DerivedValuesView() = default;
+  explicit DerivedValuesView(const BlockView& block);
+
+  uint16_t getMultiplicationFactor() const;
+  uint16_t getNumberOfBeams() const;
+  uint16_t getScanTime() const;
+  float getStartAngle() const;
+  float getAngularBeamResolution() const;
+  uint32_t getInterbeamPeriod() const;
+};
+
+/*!
+ * \brief View onto the measurement data. Single beams are decoded on access, the angles are looked
+ * up in the angle table of the configuration if one is given and computed from the derived values
+ * in the same way as by datastructure::AngleTable otherwise.
+ */
+class MeasurementDataView : public BlockView
+{
+public:
+  MeasurementDataView();
+  MeasurementDataView(const BlockView& block,
+                      float start_angle,
+                      float angular_beam_resolution,
+                      const std::shared_ptr<const datastructure::AngleTable>& angle_table_ptr =
+                        std::shared_ptr<const datastructure::AngleTable>());
+
+  uint32_t getNumberOfBeams() const;
+  std::size_t getNumberOfScanPoints() const;
+
+  float getAngle(std::size_t index) const;
+  uint16_t getDistance(std::size_t index) const;
+  uint8_t getReflectivity(std::size_t index) const;
+
+  /*!
+   * \brief Returns the status byte of a beam, the bits are defined by the STATUS_* constants of
+   * datastructure::MeasurementData.
+   */
+  uint8_t getStatusByte(std::size_t index) const;
+
+  datastructure::ScanPoint getScanPoint(std::size_t index) const;
+
+private:
+  float m_start_angle;
+  float m_angular_beam_resolution;
+  std::shared_ptr<const datastructure::AngleTable> m_angle_table_ptr;
+
+  std::size_t getBeamPosition(std::size_t index) const;
+};
+
+/*!
+ * \brief View onto one intrusion datum, i.e. the intrusion flags of one cut-off path.
+ */
+class IntrusionDatumView : public BlockView
+{
+public:
+  IntrusionDatumView();
+  IntrusionDatumView(const BlockView& block, std::size_t num_scan_points);
+
+  /*!
+   * \brief Returns the number of bytes the flags are transmitted in.
+   */
+  uint32_t getSize() const;
+
+  /*!
+   * \brief Returns the number of flags, one per beam at most.
+   */
+  std::size_t getNumberOfFlags() const;
+
+  bool getFlag(std::size_t index) const;
+
+private:
+  std::size_t m_num_scan_points;
+};
+
+/*!
+ * \brief View onto the intrusion data. The datums are of variable size, so their offsets are
+ * indexed once when the view is constructed. Throws if a datum exceeds the block.
+ */
+class IntrusionDataView : public BlockView
+{
+public:
+  IntrusionDataView();
+  IntrusionDataView(const BlockView& block, std::size_t num_scan_points);
+
+  /*!
+   * \brief Number of intrusion datums, one per cut-off path.
+   */
+  static const std::size_t NUM_INTRUSION_DATUMS = data_layout::intrusion_data::NUMBER_OF_DATUMS;
+
+  IntrusionDatumView getIntrusionDatum(std::size_t index) const;
+
+private:
+  std::size_t m_num_scan_points;
+  std::array<uint32_t, NUM_INTRUSION_DATUMS> m_datum_offsets;
+
+  void indexIntrusionDatums();
+};
+
+/*!
+ * \brief View onto the application inputs, the getters mirror datastructure::ApplicationInputs.
+ */
+class ApplicationInputsView : public BlockView
+{
+public:
+  ApplicationInputsView() = default;
+  explicit ApplicationInputsView(const BlockView& block);
+
+  datastructure::ApplicationInputs::UnsafeInputsWord getUnsafeInputsInputSources() const;
+  datastructure::ApplicationInputs::UnsafeInputsWord getUnsafeInputsFlags() const;
+  uint16_t getMonitoringCase(std::size_t index) const;
+  datastructure::ApplicationInputs::MonitoringCaseFlagsWord getMonitoringCaseFlags() const;
+  int16_t getVelocity0() const;
+  int16_t getVelocity1() const;
+  bool getVelocity0Valid() const;
+  bool getVelocity1Valid() const;
+  bool getVelocity0TransmittedSafely() const;
+  bool getVelocity1TransmittedSafely() const;
+  int8_t getSleepModeInput() const;
+
+private:
+  bool getVelocityFlag(uint8_t bit) const;
+};
+
+/*!
+ * \brief View onto the application outputs, the getters mirror datastructure::ApplicationOutputs.
+ */
+class ApplicationOutputsView : public BlockView
+{
+public:
+  ApplicationOutputsView() = default;
+  explicit ApplicationOutputsView(const BlockView& block);
+
+  datastructure::ApplicationOutputs::EvalOutWord getEvalOut() const;
+  datastructure::ApplicationOutputs::EvalOutWord getEvalOutIsSafe() const;
+  datastructure::ApplicationOutputs::EvalOutWord getEvalOutIsValid() const;
+  uint16_t getMonitoringCase(std::size_t index) const;
+  datastructure::ApplicationOutputs::MonitoringCaseFlagsWord getMonitoringCaseFlags() const;
+  int8_t getSleepModeOutput() const;
+  bool getHostErrorFlagContaminationWarning() const;
+  bool getHostErrorFlagContaminationError() const;
+  bool getHostErrorFlagManipulationError() const;
+  bool getHostErrorFlagGlare() const;
+  bool getHostErrorFlagReferenceContourIntruded() const;
+  bool getHostErrorFlagCriticalError() const;
+  int16_t getVelocity0() const;
+  int16_t getVelocity1() const;
+  bool getVelocity0Valid() const;
+  bool getVelocity1Valid() const;
+  bool getVelocity0TransmittedSafely() const;
+  bool getVelocity1TransmittedSafely() const;
+  int16_t getResultingVelocity(std::size_t index) const;
+  datastructure::ApplicationOutputs::ResultingVelocityFlagsWord getResultingVelocityIsValid() const;
+  bool getFlagsSleepModeOutputIsValid() const;
+  bool getFlagsHostErrorFlagsAreValid() const;
+
+private:
+  bool getHostErrorFlag(uint8_t bit) const;
+  bool getVelocityFlag(uint8_t bit) const;
+};
+
+/*!
+ * \brief View onto the application data, the getters mirror datastructure::ApplicationData.
+ */
+class ApplicationDataView : public BlockView
+{
+public:
+  ApplicationDataView() = default;
+  explicit ApplicationDataView(const BlockView& block);
+
+  ApplicationInputsView getInputs() const;
+  ApplicationOutputsView getOutputs() const;
+};
+
+/*!
+ * \brief Zero-copy access to a reassembled scan. The view validates the data header and the block
+ * table of the deployed packet buffer once. All other fields are read from the bytes when they are
+ * accessed, nothing is decoded in advance and nothing is allocated. The getters mirror the ones of
+ * datastructure::Data, returning views instead of decoded blocks.
+ *
+ * The packet buffer has to outlive the view and all block views taken from it.
+ */
+class DataView
+{
+public:
+  /*!
+   * \brief Constructs a view onto a reassembled scan. Throws if the buffer is shorter than the data
+   * header, a published block lies beyond the end of the buffer or an intrusion datum lies beyond
+   * the end of the intrusion data.
+   *
+   * \param buffer The deployed packet buffer of the scan.
+   */
+  explicit DataView(const datastructure::PacketBuffer& buffer);
+
+  /*!
+   * \brief Sets the angle table the angles of the measurement data are looked up in. It is only
+   * used if it matches the derived values and the number of beams of the scan.
+   *
+   * \param angle_table_ptr The angle table shared by the scans of a configuration.
+   */
+  void setAngleTablePtr(const std::shared_ptr<const datastructure::AngleTable>& angle_table_ptr);
+
+  bool hasDataHeader() const;
+  DataHeaderView getDataHeader() const;
+
+  bool hasGeneralSystemState() const;
+  GeneralSystemStateView getGeneralSystemState() const;
+
+  bool hasDerivedValues() const;
+  DerivedValuesView getDerivedValues() const;
+
+  /*!
+   * \brief Returns if the measurement data is published. Like the parser the view requires the
+   * derived values for the angles of the beams.
+   */
+  bool hasMeasurementData() const;
+  MeasurementDataView getMeasurementData() const;
+
+  /*!
+   * \brief Returns if the intrusion data is published. Like the parser the view requires the
+   * derived values for the number of beams.
+   */
+  bool hasIntrusionData() const;
+  IntrusionDataView getIntrusionData() const;
+
+  bool hasApplicationData() const;
+  ApplicationDataView getApplicationData() const;
+
+private:
+  enum Block
+  {
+    GENERAL_SYSTEM_STATE,
+    DERIVED_VALUES,
+    MEASUREMENT_DATA,
+    INTRUSION_DATA,
+    APPLICATION_DATA,
+    NUM_BLOCKS
+  };
+
+  struct BlockEntry
+  {
+    uint16_t offset;
+    uint16_t size;
+  };
+
+  const uint8_t* m_contiguous;
+  const datastructure::PacketBuffer::FragmentVector* m_fragments;
+  std::size_t m_length;
+  BlockEntry m_blocks[NUM_BLOCKS];
+  IntrusionDataView m_intrusion_data;
+  std::shared_ptr<const datastructure::AngleTable> m_angle_table_ptr;
+
+  BlockView getBlock(std::size_t offset, std::size_t size) const;
+  BlockView getBlock(Block block) const;
+  bool isPublished(Block block) const;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_DATAVIEW_H
@@ -0,0 +1,194 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file FieldLayout.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDLAYOUT_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDLAYOUT_H
+
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Byte order of a field in a telegram.
+ */
+enum class Endianness
+{
+  LITTLE,
+  BIG
+};
+
+namespace field_layout {
+
+/*!
+ * \brief Reads a value of the given byte order from an unaligned position.
+ *
+ * \param data Position of the first byte of the value.
+ * \returns The value in host byte order.
+ */
+template <typename ValueT, Endianness ByteOrder>
+inline ValueT readValue(const uint8_t* data)
+{
+  return ByteOrder == Endianness::BIG ? read_write_helper::readBigEndian<ValueT>(data)
+                                      : read_write_helper::readLittleEndian<ValueT>(data);
+}
+
+} // namespace field_layout
+
+/*!
+ * \brief Describes the position of a single field within a telegram. Fields which are not decoded
+ * through a setter, e.g. bit fields, are described by their position only.
+ *
+ * \tparam ValueT Integer type of the field.
+ * \tparam Offset Offset of the field from the start of the telegram in bytes.
+ * \tparam ByteOrder Byte order of the field in the telegram.
+ * \tparam Size Number of bytes the field is transmitted in, e.g. 3 for a 24 bit word.
+ */
+template <typename ValueT,
+          std::size_t Offset,
+          Endianness ByteOrder = Endianness::LITTLE,
+          std::size_t Size     = sizeof(ValueT)>
+struct FieldPosition
+{
+  typedef ValueT ValueType;
+
+  static constexpr std::size_t OFFSET    = Offset;
+  static constexpr std::size_t SIZE      = Size;
+  static constexpr std::size_t END       = Offset + Size;
+  static constexpr Endianness ENDIANNESS = ByteOrder;
+
+  static ValueT read(const uint8_t* data)
+  {
+    static_assert(Size == sizeof(ValueT), "Only fields of the width of their type can be read");
+    return field_layout::readValue<ValueT, ByteOrder>(data + Offset);
+  }
+};
+
+template <typename ValueT, std::size_t Offset, Endianness ByteOrder, std::size_t Size>
+constexpr std::size_t FieldPosition<ValueT, Offset, ByteOrder, Size>::OFFSET;
+template <typename ValueT, std::size_t Offset, Endianness ByteOrder, std::size_t Size>
+constexpr std::size_t FieldPosition<ValueT, Offset, ByteOrder, Size>::SIZE;
+template <typename ValueT, std::size_t Offset, Endianness ByteOrder, std::size_t Size>
+constexpr std::size_t FieldPosition<ValueT, Offset, ByteOrder, Size>::END;
+template <typename ValueT, std::size_t Offset, Endianness ByteOrder, std::size_t Size>
+constexpr Endianness FieldPosition<ValueT, Offset, ByteOrder, Size>::ENDIANNESS;
+
+/*!
+ * \brief Describes a single field of a telegram and the setter of the target it is decoded into.
+ *
+ * \tparam TargetT Type of the datastructure the field is decoded into.
+ * \tparam ValueT Integer type of the field, defines its width.
+ * \tparam Offset Offset of the field from the start of the telegram in bytes.
+ * \tparam ByteOrder Byte order of the field in the telegram.
+ * \tparam Setter Setter of the target receiving the decoded value.
+ */
+template <typename TargetT,
+          typename ValueT,
+          std::size_t Offset,
+          Endianness ByteOrder,
+          void (TargetT::*Setter)(const ValueT&)>
+struct Field : FieldPosition<ValueT, Offset, ByteOrder>
+{
+  static void decode(const uint8_t* data, TargetT& target)
+  {
+    (target.*Setter)(FieldPosition<ValueT, Offset, ByteOrder>::read(data));
+  }
+};
+
+/*!
+ * \brief A list of field descriptors which is decoded in one straight-line pass. The recursion is
+ * resolved at compile time, so no per-field calls or loops are left after inlining.
+ *
+ * \tparam Fields The field descriptors, see Field.
+ */
+template <typename... Fields>
+struct FieldLayout;
+
+template <>
+struct FieldLayout<>
+{
+  /*!
+   * \brief Number of bytes covered by the fields.
+   */
+  static constexpr std::size_t SIZE = 0;
+
+  template <typename TargetT>
+  static void decode(const uint8_t*, TargetT&)
+  {
+  }
+};
+
+template <typename First, typename... Rest>
+struct FieldLayout<First, Rest...>
+{
+  /*!
+   * \brief Number of bytes covered by the fields.
+   */
+  static constexpr std::size_t SIZE =
+    First::END > FieldLayout<Rest...>::SIZE ? First::END : FieldLayout<Rest...>::SIZE;
+
+  /*!
+   * \brief Decodes all fields into the target.
+   *
+   * \param data Start of the telegram, at least SIZE bytes have to be readable.
+   * \param target The datastructure to write the fields to.
+   */
+  template <typename TargetT>
+  static void decode(const uint8_t* data, TargetT& target)
+  {
+    First::decode(data, target);
+    FieldLayout<Rest...>::decode(data, target);
+  }
+
+  /*!
+   * \brief Decodes all fields of a telegram given as span into the target. The length of the span
+   * is checked if bounds checking is enabled.
+   *
+   * \param data Span of the telegram.
+   * \param target The datastructure to write the fields to.
+   */
+  template <typename TargetT>
+  static void decode(read_write_helper::ConstByteSpan data, TargetT& target)
+  {
+    read_write_helper::checkBounds(data.size(), 0, SIZE);
+    decode(data.data(), target);
+  }
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_FIELDLAYOUT_H
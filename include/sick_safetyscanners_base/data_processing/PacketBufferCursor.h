@@ -0,0 +1,111 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PacketBufferCursor.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PACKETBUFFERCURSOR_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PACKETBUFFERCURSOR_H
+
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include <memory>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Gives the parsers contiguous access to ranges of a possibly fragmented PacketBuffer.
+ *
+ * Ranges lying within a single fragment are returned in place. Only ranges straddling a fragment
+ * boundary are copied into an internal scratch buffer. The PacketBuffer has to outlive the cursor.
+ */
+class PacketBufferCursor
+{
+public:
+  /*!
+   * \brief Constructor of the cursor.
+   *
+   * \param buffer The packet buffer to read from.
+   */
+  explicit PacketBufferCursor(const sick::datastructure::PacketBuffer& buffer);
+
+  /*!
+   * \brief Returns the length of the underlying packet buffer.
+   *
+   * \returns The length in bytes.
+   */
+  std::size_t getLength() const;
+
+  /*!
+   * \brief Returns a span of a contiguous range of the packet buffer. The span stays valid until
+   * the next call.
+   *
+   * \param offset Start of the range within the packet buffer.
+   * \param length Length of the range.
+   *
+   * \returns Span covering the range.
+   */
+  read_write_helper::ConstByteSpan getContiguous(std::size_t offset, std::size_t length);
+
+  /*!
+   * \brief Returns the number of bytes which can be accessed in place starting at the given
+   * offset, i.e. up to the end of the fragment containing the offset.
+   *
+   * \param offset Start of the range within the packet buffer.
+   *
+   * \returns The number of bytes, 0 if the offset is at or beyond the end of the packet buffer.
+   */
+  std::size_t getContiguousLength(std::size_t offset);
+
+  /*!
+   * \brief Returns how many ranges straddled a fragment boundary and had to be copied.
+   *
+   * \returns The number of copied ranges.
+   */
+  std::size_t getNumCopies() const;
+
+private:
+  std::shared_ptr<std::vector<uint8_t> const> m_contiguous_buffer;
+  const sick::datastructure::PacketBuffer::FragmentVector& m_fragments;
+  std::size_t m_length;
+  std::size_t m_fragment_index;
+  std::vector<uint8_t> m_scratch;
+  std::size_t m_num_copies;
+
+  void seekFragment(std::size_t offset);
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PACKETBUFFERCURSOR_H
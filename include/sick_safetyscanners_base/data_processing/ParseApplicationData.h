@@ -39,6 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
 #include <vector>
@@ -67,85 +68,85 @@ public:
    * \returns The parsed application data.
    */
   datastructure::ApplicationData parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
-                                                  datastructure::Data& data) const;
+                                                  const datastructure::Data& data) const;
 
 private:
-  void setDataInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInApplicationData(read_write_helper::ConstByteSpan data_ptr,
                                 datastructure::ApplicationData& application_data) const;
   void
-  setApplicationInputsInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
+  setApplicationInputsInApplicationData(read_write_helper::ConstByteSpan data_ptr,
                                         datastructure::ApplicationData& application_data) const;
   void
-  setApplicationOutputsInApplicationData(std::vector<uint8_t>::const_iterator data_ptr,
+  setApplicationOutputsInApplicationData(read_write_helper::ConstByteSpan data_ptr,
                                          datastructure::ApplicationData& application_data) const;
-  void setDataInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                   datastructure::ApplicationInputs& inputs) const;
-  void setDataInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                    datastructure::ApplicationOutputs& outputs) const;
-  void setUnsafeInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setUnsafeInputsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                           datastructure::ApplicationInputs& inputs) const;
-  void setUnsafeInputsSourcesInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setUnsafeInputsSourcesInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                  datastructure::ApplicationInputs& inputs) const;
-  void setUnsafeInputsFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setUnsafeInputsFlagsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setMonitoringCaseInputsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                   datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseNumbersInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setMonitoringCaseNumbersInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                    datastructure::ApplicationInputs& inputs) const;
-  void setMonitoringCaseFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setMonitoringCaseFlagsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                  datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocityInputsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocityInputsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                   datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocity0InApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocity0InApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                              datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocity1InApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocity1InApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                              datastructure::ApplicationInputs& inputs) const;
-  void setLinearVelocityFlagsInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocityFlagsInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                                  datastructure::ApplicationInputs& inputs) const;
-  void setSleepModeInputInApplicationInputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setSleepModeInputInApplicationInputs(read_write_helper::ConstByteSpan data_ptr,
                                             datastructure::ApplicationInputs& inputs) const;
   void
-  setEvalutaionPathsOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setEvalutaionPathsOutputsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                 datastructure::ApplicationOutputs& outputs) const;
   void setEvaluationPathsOutputsEvalOutInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::ApplicationOutputs& outputs) const;
   void setEvaluationPathsOutputsIsSafeInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::ApplicationOutputs& outputs) const;
   void setEvaluationPathsOutputsValidFlagsInApplicationOutputs(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::ApplicationOutputs& outputs) const;
   void
-  setMonitoringCaseOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setMonitoringCaseOutputsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                datastructure::ApplicationOutputs& outputs) const;
   void
-  setMonitoringCaseNumbersInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setMonitoringCaseNumbersInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                datastructure::ApplicationOutputs& outputs) const;
-  void setMonitoringCaseFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setMonitoringCaseFlagsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                   datastructure::ApplicationOutputs& outputs) const;
-  void setSleepModeOutputInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setSleepModeOutputInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                               datastructure::ApplicationOutputs& outputs) const;
-  void setErrorFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setErrorFlagsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                          datastructure::ApplicationOutputs& outputs) const;
   void
-  setLinearVelocityOutoutsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setLinearVelocityOutoutsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocity0InApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocity0InApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                               datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocity1InApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocity1InApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                               datastructure::ApplicationOutputs& outputs) const;
-  void setLinearVelocityFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setLinearVelocityFlagsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                   datastructure::ApplicationOutputs& outputs) const;
   void
-  setResultingVelocityOutputsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setResultingVelocityOutputsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                   datastructure::ApplicationOutputs& outputs) const;
-  void setResultingVelocityInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  void setResultingVelocityInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                 datastructure::ApplicationOutputs& outputs) const;
   void
-  setResultingVelocityFlagsInApplicationOutputs(std::vector<uint8_t>::const_iterator data_ptr,
+  setResultingVelocityFlagsInApplicationOutputs(read_write_helper::ConstByteSpan data_ptr,
                                                 datastructure::ApplicationOutputs& outputs) const;
-  void setOutputFlagsinApplicationOutput(std::vector<uint8_t>::const_iterator data_ptr,
+  void setOutputFlagsinApplicationOutput(read_write_helper::ConstByteSpan data_ptr,
                                          datastructure::ApplicationOutputs& outputs) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfApplicationDataIsPublished(const datastructure::Data& data) const;
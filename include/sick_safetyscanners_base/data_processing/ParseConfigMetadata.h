@@ -69,17 +69,17 @@ public:
                         datastructure::ConfigMetadata& config_metadata) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readModificationTimeDate(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readModificationTimeTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readTransferTimeDate(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readTransferTimeTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readAppChecksum(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readOverallChecksum(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::vector<uint32_t> readIntegrityHash(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readModificationTimeDate(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readModificationTimeTime(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readTransferTimeDate(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readTransferTimeTime(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readAppChecksum(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readOverallChecksum(read_write_helper::ConstByteSpan data_ptr) const;
+  std::vector<uint32_t> readIntegrityHash(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
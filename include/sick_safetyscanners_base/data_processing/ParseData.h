@@ -35,9 +35,11 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PARSEDATA_H
 #define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_PARSEDATA_H
 
+#include "sick_safetyscanners_base/Types.h"
 #include "sick_safetyscanners_base/datastructure/Data.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/DataBlockParser.h"
 #include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
 #include "sick_safetyscanners_base/data_processing/ParseDataHeader.h"
 #include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
@@ -46,6 +48,8 @@
 #include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
+#include <atomic>
+
 
 namespace sick {
 namespace data_processing {
@@ -70,9 +74,49 @@ public:
    * \returns Parsed data
    */
   sick::datastructure::Data parseUDPSequence(const sick::datastructure::PacketBuffer& buffer) const;
+
+  /*!
+   * \brief Parses the udp data transferred in the packet buffer into an existing data object.
+   *
+   * The blocks are parsed into the storage of the data object, so it keeps its capacity and a
+   * recycled data object is parsed without allocations.
+   *
+   * \param buffer The incoming data buffer.
+   * \param data The data object to overwrite.
+   */
+  void parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
+                        sick::datastructure::Data& data) const;
   bool parseTCPSequence(const datastructure::PacketBuffer& buffer,
                         sick::datastructure::Data& data) const;
 
+  /*!
+   * \brief Parses the data header and the derived values of the packet buffer into an existing
+   * data object. The other blocks are left pending and are decoded from the kept packet buffer on
+   * their first access, so consumers only pay for the blocks they read.
+   *
+   * \param buffer The incoming data buffer. It is moved into the data object if any block is left
+   * pending, in exchange for the cleared buffer of the previous scan.
+   * \param data The data object to overwrite.
+   */
+  void parseUDPSequenceLazily(sick::datastructure::PacketBuffer&& buffer,
+                              sick::datastructure::Data& data) const;
+
+  /*!
+   * \brief Selects the blocks to parse, independent of the blocks streamed by the sensor. Blocks
+   * which are not selected are skipped and marked empty. The derived values are parsed as well if
+   * the measurement or intrusion data is selected, since these depend on them.
+   *
+   * \param parse_mask The blocks to parse as sick::SensorDataFeatures flags.
+   */
+  void setParseMask(sick::types::SensorFeatures parse_mask);
+
+  /*!
+   * \brief Returns the blocks which are parsed.
+   *
+   * \returns The blocks to parse as sick::SensorDataFeatures flags.
+   */
+  sick::types::SensorFeatures getParseMask() const;
+
 private:
   std::shared_ptr<sick::data_processing::ParseDataHeader> m_data_header_parser_ptr;
   std::shared_ptr<sick::data_processing::ParseDerivedValues> m_derived_values_parser_ptr;
@@ -80,7 +124,33 @@ private:
   std::shared_ptr<sick::data_processing::ParseGeneralSystemState> m_general_system_state_parser_ptr;
   std::shared_ptr<sick::data_processing::ParseIntrusionData> m_intrusion_data_parser_ptr;
   std::shared_ptr<sick::data_processing::ParseApplicationData> m_application_data_parser_ptr;
+  std::shared_ptr<const sick::data_processing::DataBlockParser> m_data_block_parser_ptr;
+  std::atomic<sick::types::SensorFeatures> m_parse_mask;
+
+  /*!
+   * \brief Resets a block in place and marks it empty.
+   */
+  template <typename BlockT>
+  static void setBlockEmpty(BlockT& block)
+  {
+    block = BlockT();
+    block.setIsEmpty(true);
+  }
 
+  /*!
+   * \brief Clears the scan points in place, so the block keeps its capacity for the next scan.
+   */
+  static void setBlockEmpty(datastructure::MeasurementData& block);
+
+  /*!
+   * \brief Clears the intrusion data in place, so the block keeps its capacity for the next scan.
+   */
+  static void setBlockEmpty(datastructure::IntrusionData& block);
+
+  static bool isDerivedValuesRequired(sick::types::SensorFeatures parse_mask);
+  static uint8_t getPendingBlocks(sick::types::SensorFeatures parse_mask);
+  void setUnselectedBlocksEmpty(sick::types::SensorFeatures parse_mask,
+                                datastructure::Data& data) const;
 
   void setDataBlocksInData(const datastructure::PacketBuffer& buffer,
                            datastructure::Data& data) const;
@@ -71,23 +71,8 @@ public:
                         sick::datastructure::DatagramHeader& header) const;
 
 private:
-  void setDataInHeader(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInHeader(read_write_helper::ConstByteSpan data_ptr,
                        datastructure::DatagramHeader& header) const;
-
-  void setDatagramMarkerInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                                 datastructure::DatagramHeader& header) const;
-  void setProtocolInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                           datastructure::DatagramHeader& header) const;
-  void setMajorVersionInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                               datastructure::DatagramHeader& header) const;
-  void setMinorVersionInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                               datastructure::DatagramHeader& header) const;
-  void setTotalLengthInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                              datastructure::DatagramHeader& header) const;
-  void setIdentificationInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                                 datastructure::DatagramHeader& header) const;
-  void setFragmentOffsetInHeader(std::vector<uint8_t>::const_iterator data_ptr,
-                                 datastructure::DatagramHeader& header) const;
 };
 
 } // namespace data_processing
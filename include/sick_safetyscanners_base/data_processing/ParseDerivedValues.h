@@ -39,6 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
 namespace sick {
@@ -67,20 +68,8 @@ public:
                                                 datastructure::Data& data) const;
 
 private:
-  void setDataInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInDerivedValues(read_write_helper::ConstByteSpan data_ptr,
                               datastructure::DerivedValues& derived_values) const;
-  void setMultiplicationFactorInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                              datastructure::DerivedValues& derived_values) const;
-  void setNumberOfBeamsInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                       datastructure::DerivedValues& derived_values) const;
-  void setScanTimeInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                  datastructure::DerivedValues& derived_values) const;
-  void setStartAngleInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                    datastructure::DerivedValues& derived_values) const;
-  void setAngularBeamResolutionInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                               datastructure::DerivedValues& derived_values) const;
-  void setInterbeamPeriodInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
-                                         datastructure::DerivedValues& derived_values) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfDerivedValuesIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
@@ -71,7 +71,7 @@ public:
                         datastructure::DeviceName& device_name) const;
 
 private:
-  std::string readDeviceName(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readDeviceName(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
@@ -69,7 +69,7 @@ public:
                         datastructure::DeviceStatus& device_status) const;
 
 private:
-  uint8_t readDeviceStatus(std::vector<uint8_t>::const_iterator data_ptr) const;
+  uint8_t readDeviceStatus(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
@@ -72,8 +72,8 @@ public:
                         datastructure::FieldData& field_data) const;
 
 private:
-  uint32_t readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readArrayElement(std::vector<uint8_t>::const_iterator data_ptr,
+  uint32_t readArrayLength(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readArrayElement(read_write_helper::ConstByteSpan data_ptr,
                             uint32_t elem_number) const;
 };
 
@@ -69,21 +69,21 @@ public:
                         datastructure::FieldData& field_data) const;
 
 private:
-  bool isValid(std::vector<uint8_t>::const_iterator data_ptr) const;
-  void setFieldType(std::vector<uint8_t>::const_iterator data_ptr,
+  bool isValid(read_write_helper::ConstByteSpan data_ptr) const;
+  void setFieldType(read_write_helper::ConstByteSpan data_ptr,
                     datastructure::FieldData& field_data) const;
-  uint8_t readFieldType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  bool readIsDefined(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readEvalMethod(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readMultiSampling(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readObjectResolution(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readSetIndex(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::string readFieldName(std::vector<uint8_t>::const_iterator data_ptr) const;
+  uint8_t readFieldType(read_write_helper::ConstByteSpan data_ptr) const;
+  std::string readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  bool readIsDefined(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readEvalMethod(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readMultiSampling(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readObjectResolution(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readSetIndex(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readNameLength(read_write_helper::ConstByteSpan data_ptr) const;
+  std::string readFieldName(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
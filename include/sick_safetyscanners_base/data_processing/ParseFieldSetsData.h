@@ -69,16 +69,16 @@ public:
                         datastructure::FieldSets& field_sets) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  std::vector<uint32_t> readNameLength(std::vector<uint8_t>::const_iterator data_ptr,
+  std::string readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readArrayLength(read_write_helper::ConstByteSpan data_ptr) const;
+  std::vector<uint32_t> readNameLength(read_write_helper::ConstByteSpan data_ptr,
                                        uint32_t array_length) const;
-  std::vector<std::string> readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
+  std::vector<std::string> readFieldName(read_write_helper::ConstByteSpan data_ptr,
                                          uint32_t array_length) const;
-  std::vector<bool> readIsDefined(std::vector<uint8_t>::const_iterator data_ptr,
+  std::vector<bool> readIsDefined(read_write_helper::ConstByteSpan data_ptr,
                                   uint32_t array_length) const;
 };
 
@@ -39,6 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
 #include <vector>
@@ -67,27 +68,29 @@ public:
    */
   datastructure::GeneralSystemState
   parseUDPSequence(const sick::datastructure::PacketBuffer& buffer,
-                   datastructure::Data& data) const;
+                   const datastructure::Data& data) const;
 
 private:
-  void setDataInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
+  void setDataInGeneralSystemState(read_write_helper::ConstByteSpan data_ptr,
                                    datastructure::GeneralSystemState& general_system_state) const;
   void
-  setStatusBitsInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
+  setStatusBitsInGeneralSystemState(read_write_helper::ConstByteSpan data_ptr,
                                     datastructure::GeneralSystemState& general_system_state) const;
   void setSafeCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::GeneralSystemState& general_system_state) const;
   void setNonSafeCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::GeneralSystemState& general_system_state) const;
   void setResetRequiredCutOffPathInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::GeneralSystemState& general_system_state) const;
+  datastructure::GeneralSystemState::CutOffPathWord
+  readCutOffPathWord(read_write_helper::ConstByteSpan data_ptr) const;
   void setCurrentMonitoringCasesInGeneralSystemState(
-    std::vector<uint8_t>::const_iterator data_ptr,
+    read_write_helper::ConstByteSpan data_ptr,
     datastructure::GeneralSystemState& general_system_state) const;
-  void setErrorsInGeneralSystemState(std::vector<uint8_t>::const_iterator data_ptr,
+  void setErrorsInGeneralSystemState(read_write_helper::ConstByteSpan data_ptr,
                                      datastructure::GeneralSystemState& general_system_state) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfGeneralSystemStateIsPublished(const datastructure::Data& data) const;
@@ -39,6 +39,7 @@
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
 #include <vector>
@@ -66,24 +67,36 @@ public:
    * \returns The parsed intrusion data.
    */
   datastructure::IntrusionData parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                                datastructure::Data& data);
+                                                const datastructure::Data& data);
+
+  /*!
+   * \brief Parse a udp sequence into existing intrusion data. The storage of the intrusion data
+   * keeps its capacity, so no allocations are needed for subsequent scans of the same size.
+   *
+   * \param buffer The incoming sequence.
+   * \param data The already parsed data to check if intrusion data is enabled.
+   * \param intrusion_data The intrusion data to overwrite.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        const datastructure::Data& data,
+                        datastructure::IntrusionData& intrusion_data);
   uint16_t getNumScanPoints() const;
   void setNumScanPoints(const uint16_t& num_scan_points);
 
 private:
   uint16_t m_num_scan_points;
 
-  void setDataInIntrusionData(std::vector<uint8_t>::const_iterator data_ptr,
-                              datastructure::IntrusionData& intrusion_data) const;
+  void setDataInIntrusionData(PacketBufferCursor& cursor,
+                              std::size_t block_offset,
+                              datastructure::IntrusionData& intrusion_data);
   void setDataInIntrusionDatums(
-    std::vector<uint8_t>::const_iterator data_ptr,
-    std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums) const;
-  uint16_t setSizeInIntrusionDatum(const uint16_t& offset,
-                                   std::vector<uint8_t>::const_iterator data_ptr,
-                                   sick::datastructure::IntrusionDatum& datum) const;
-  uint16_t setFlagsInIntrusionDatum(const uint16_t& offset,
-                                    std::vector<uint8_t>::const_iterator data_ptr,
-                                    sick::datastructure::IntrusionDatum& datum) const;
+    PacketBufferCursor& cursor,
+    std::size_t block_offset,
+    std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums);
+  void setSizeInIntrusionDatum(read_write_helper::ConstByteSpan data_ptr,
+                               sick::datastructure::IntrusionDatum& datum) const;
+  void setFlagsInIntrusionDatum(read_write_helper::ConstByteSpan data_ptr,
+                                sick::datastructure::IntrusionDatum& datum) const;
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfIntrusionDataIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
@@ -39,8 +39,11 @@
 #include "sick_safetyscanners_base/datastructure/MeasurementData.h"
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include "sick_safetyscanners_base/data_processing/BeamDecoder.h"
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
 #include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -67,21 +70,37 @@ public:
    * \returns The parsed measurement data.
    */
   datastructure::MeasurementData parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                                  datastructure::Data& data);
+                                                  const datastructure::Data& data);
+
+  /*!
+   * \brief Parses the measurement data into an existing object if it is enabled. The scan points
+   * keep their capacity, so no allocations are needed for subsequent scans of the same size. The
+   * angles are provided by an angle table which is reused as long as the derived values and the
+   * number of beams do not change.
+   *
+   * \param buffer The incoming udp sequence.
+   * \param data The already parsed data to check if it is enabled.
+   * \param measurement_data The measurement data to overwrite.
+   */
+  void parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                        const datastructure::Data& data,
+                        datastructure::MeasurementData& measurement_data);
 
 private:
-  float m_angle;
+  float m_start_angle;
   float m_angle_delta;
-  void setDataInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
+  std::shared_ptr<const datastructure::AngleTable> m_angle_table_ptr;
+  void setDataInMeasurementData(PacketBufferCursor& cursor,
+                                std::size_t block_offset,
                                 datastructure::MeasurementData& measurement_data);
-  void setNumberOfBeamsInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
+  void setNumberOfBeamsInMeasurementData(PacketBufferCursor& cursor,
+                                         std::size_t block_offset,
                                          datastructure::MeasurementData& measurement_data) const;
   void setStartAngleAndDelta(const datastructure::Data& data);
-  void setScanPointsInMeasurementData(std::vector<uint8_t>::const_iterator data_ptr,
+  void setScanPointsInMeasurementData(PacketBufferCursor& cursor,
+                                      std::size_t block_offset,
                                       datastructure::MeasurementData& measurement_data);
-  void addScanPointToMeasurementData(uint16_t offset,
-                                     std::vector<uint8_t>::const_iterator data_ptr,
-                                     datastructure::MeasurementData& measurement_data) const;
+  void setAngleTableInMeasurementData(datastructure::MeasurementData& measurement_data);
   bool checkIfPreconditionsAreMet(const datastructure::Data& data) const;
   bool checkIfMeasurementDataIsPublished(const datastructure::Data& data) const;
   bool checkIfDataContainsNeededParsedBlocks(const datastructure::Data& data) const;
@@ -70,18 +70,18 @@ public:
                         datastructure::ConfigData& config_data) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  bool readEnabled(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readInterfaceType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  boost::asio::ip::address_v4 readHostIp(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readHostPort(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readPublishingFreq(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readEndAngle(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readStartAngle(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readFeatures(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  bool readEnabled(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readInterfaceType(read_write_helper::ConstByteSpan data_ptr) const;
+  boost::asio::ip::address_v4 readHostIp(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readHostPort(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readPublishingFreq(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readEndAngle(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readStartAngle(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readFeatures(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
@@ -71,11 +71,11 @@ public:
                         datastructure::MonitoringCaseData& monitoring_case_data) const;
 
 private:
-  bool isValid(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readMonitoringCaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readFieldIndex(std::vector<uint8_t>::const_iterator data_ptr,
+  bool isValid(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readMonitoringCaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readFieldIndex(read_write_helper::ConstByteSpan data_ptr,
                           const uint8_t& index) const;
-  bool readFieldValid(std::vector<uint8_t>::const_iterator data_ptr, const uint8_t& index) const;
+  bool readFieldValid(read_write_helper::ConstByteSpan data_ptr, const uint8_t& index) const;
 };
 
 } // namespace data_processing
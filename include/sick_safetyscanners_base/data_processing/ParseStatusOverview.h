@@ -69,19 +69,19 @@ public:
                         datastructure::StatusOverview& status_overview) const;
 
 private:
-  std::string readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readDeviceState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readConfigState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readApplicationState(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readPowerOnCount(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readCurrentTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readCurrentDate(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readErrorInfoCode(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readErrorInfoTime(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readErrorInfoDate(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readDeviceState(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readConfigState(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readApplicationState(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readPowerOnCount(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readCurrentTime(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readCurrentDate(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readErrorInfoCode(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readErrorInfoTime(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readErrorInfoDate(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
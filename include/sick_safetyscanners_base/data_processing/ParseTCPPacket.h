@@ -84,6 +84,17 @@ public:
    */
   uint32_t getExpectedPacketLength(const datastructure::PacketBuffer& buffer);
 
+  /*!
+   * \brief Gets the expected packet length of a telegram starting at the beginning of the span.
+   * Throws if the length lies outside of MIN_TELEGRAM_LENGTH and MAX_TELEGRAM_LENGTH, i.e. the
+   * received stream is corrupted.
+   *
+   * \param data The received bytes, at least the STX and length fields have to be contained.
+   *
+   * \returns Expected length of the telegram including STX and length fields.
+   */
+  uint32_t getExpectedPacketLength(read_write_helper::ConstByteSpan data) const;
+
   /*!
    * \brief Gets the request ID of the incoming tcp packet.
    *
@@ -93,16 +104,35 @@ public:
    */
   uint16_t getRequestID(const datastructure::PacketBuffer& buffer) const;
 
+  /*!
+   * \brief Gets the error code of an error reply of the sensor.
+   *
+   * \param buffer The incoming tcp packet.
+   *
+   * \returns The error code, 0 if the packet is too short to contain one.
+   */
+  uint16_t getErrorCode(const datastructure::PacketBuffer& buffer) const;
+
+  /*!
+   * \brief Length of a telegram without data, i.e. of the STX, length and header fields.
+   */
+  static const uint32_t MIN_TELEGRAM_LENGTH = 18;
+
+  /*!
+   * \brief Upper bound of the length of a telegram, well above the largest reply of the sensor.
+   */
+  static const uint32_t MAX_TELEGRAM_LENGTH = 1024 * 1024;
+
 private:
-  uint32_t readSTx(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readLength(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readRequestID(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readHubCntr(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readNoC(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint32_t readSessionID(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readCommandType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readCommandMode(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint16_t readErrorCode(std::vector<uint8_t>::const_iterator data_ptr) const;
+  uint32_t readSTx(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readLength(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readRequestID(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readHubCntr(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readNoC(read_write_helper::ConstByteSpan data_ptr) const;
+  uint32_t readSessionID(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readCommandType(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readCommandMode(read_write_helper::ConstByteSpan data_ptr) const;
+  uint16_t readErrorCode(read_write_helper::ConstByteSpan data_ptr) const;
   std::vector<uint8_t> readData(const datastructure::PacketBuffer& buffer) const;
   void setCommandValuesFromPacket(const sick::datastructure::PacketBuffer& buffer,
                                   sick::cola2::Command& command) const;
@@ -69,9 +69,9 @@ public:
                         datastructure::TypeCode& type_code) const;
 
 private:
-  std::string readTypeCode(std::vector<uint8_t>::const_iterator data_ptr) const;
-  uint8_t readInterfaceType(std::vector<uint8_t>::const_iterator data_ptr) const;
-  float readMaxRange(std::vector<uint8_t>::const_iterator data_ptr) const;
+  std::string readTypeCode(read_write_helper::ConstByteSpan data_ptr) const;
+  uint8_t readInterfaceType(read_write_helper::ConstByteSpan data_ptr) const;
+  float readMaxRange(read_write_helper::ConstByteSpan data_ptr) const;
 };
 
 } // namespace data_processing
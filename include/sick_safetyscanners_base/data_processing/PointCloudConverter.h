@@ -0,0 +1,151 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PointCloudConverter.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
+#define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
+
+#include "sick_safetyscanners_base/datastructure/AngleTable.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/DerivedValues.h"
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+namespace sick {
+namespace data_processing {
+
+/*!
+ * \brief Options of the polar to cartesian conversion.
+ */
+struct PointCloudOptions
+{
+  /*!
+   * \brief Appends the reflectivity as third value to each point, giving x, y, intensity.
+   */
+  bool with_intensity{false};
+
+  /*!
+   * \brief Drops beams which do not have the valid bit set.
+   */
+  bool drop_invalid{false};
+
+  /*!
+   * \brief Drops beams which have the infinite bit set.
+   */
+  bool drop_infinite{false};
+
+  /*!
+   * \brief Factor applied to the distances in [mm]. The default yields coordinates in [m].
+   */
+  float distance_scale{0.001f};
+};
+
+/*!
+ * \brief Converts the scanpoints of a measurement into packed cartesian points.
+ *
+ * The points are written as consecutive floats (x, y) or (x, y, intensity) into a buffer provided
+ * by the caller. The sine and cosine of the beam angles are taken from the angle table of the
+ * measurement data if it matches the derived values, otherwise the converter builds and keeps its
+ * own table per configuration. This allows to convert scans in the data callback as well as
+ * recorded data. The conversion uses an SSE2 kernel if available.
+ */
+class PointCloudConverter
+{
+public:
+  /*!
+   * \brief Constructor of the converter.
+   *
+   * \param options The conversion options.
+   */
+  explicit PointCloudConverter(const PointCloudOptions& options = PointCloudOptions());
+
+  /*!
+   * \brief Getter for the conversion options.
+   * \return The conversion options.
+   */
+  PointCloudOptions getOptions() const;
+
+  /*!
+   * \brief Setter for the conversion options.
+   * \param options The conversion options.
+   */
+  void setOptions(const PointCloudOptions& options);
+
+  /*!
+   * \brief Returns the number of floats written per point.
+   * \return 3 if the intensity is added, 2 otherwise.
+   */
+  std::size_t getStride() const;
+
+  /*!
+   * \brief Converts the measurement data of a parsed scan.
+   *
+   * \param data The scan. Measurement data and derived values have to be present.
+   * \param points Buffer for the points, has to hold max_points * getStride() floats.
+   * \param max_points Capacity of the buffer in points, has to be at least the number of
+   * scanpoints.
+   * \return The number of points written. Beams dropped by the options are not written.
+   */
+  std::size_t convert(const sick::datastructure::Data& data, float* points, std::size_t max_points);
+
+  /*!
+   * \brief Converts measurement data given together with the derived values it was measured with.
+   *
+   * \param measurement_data The scanpoints.
+   * \param derived_values The derived values defining the beam angles.
+   * \param points Buffer for the points, has to hold max_points * getStride() floats.
+   * \param max_points Capacity of the buffer in points, has to be at least the number of
+   * scanpoints.
+   * \return The number of points written. Beams dropped by the options are not written.
+   */
+  std::size_t convert(const sick::datastructure::MeasurementData& measurement_data,
+                      const sick::datastructure::DerivedValues& derived_values,
+                      float* points,
+                      std::size_t max_points);
+
+private:
+  PointCloudOptions m_options;
+  std::shared_ptr<const sick::datastructure::AngleTable> m_angle_table_ptr;
+
+  const sick::datastructure::AngleTable&
+  getAngleTable(const sick::datastructure::MeasurementData& measurement_data,
+                const sick::datastructure::DerivedValues& derived_values);
+  uint8_t getDropMask() const;
+  uint8_t getRequiredBits() const;
+};
+
+} // namespace data_processing
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_POINTCLOUDCONVERTER_H
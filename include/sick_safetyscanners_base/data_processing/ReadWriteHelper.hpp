@@ -35,324 +35,622 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_READWRITEHELPER_HPP
 #define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_READWRITEHELPER_HPP
 
+#include "sick_safetyscanners_base/Exceptions.h"
+
+#include <cstddef>
+#include <cstring>
 #include <stdint.h>
+#include <utility>
 
 namespace sick {
 namespace read_write_helper {
 
 /*!
  * \brief Helper Functions read and write data at a certain place in a buffer.
+ *
+ * The buffers are passed as byte spans, i.e. a pointer and a length, so any contiguous memory can
+ * be decoded: vectors, pooled receive slots, fragments or memory mapped files. Multi-byte values
+ * are copied with memcpy and converted with the byte swap intrinsics of the compiler, so unaligned
+ * positions are fine.
  */
 
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset.
+ * \brief Checks that a range lies within a buffer of the given size. The check is only performed
+ * if SICK_CHECK_BOUNDS is defined, which the CHECK_BOUNDS option of the build exports to all users.
  *
- * \param buf The buffer to write to.
- * \param v Value which will be written.
+ * \param size Size of the buffer.
+ * \param offset Start of the range.
+ * \param length Length of the range.
  */
-inline void writeUint8(std::vector<uint8_t>::iterator it, const uint8_t v)
+inline void checkBounds(std::size_t size, std::size_t offset, std::size_t length)
 {
-  *(it + 0) = v;
+#ifdef SICK_CHECK_BOUNDS
+  if (offset > size || length > size - offset)
+  {
+    throw sick::runtime_error("Access beyond the end of the byte span");
+  }
+#else
+  (void)size;
+  (void)offset;
+  (void)length;
+#endif
 }
 
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset in big endian encoding.
+ * \brief A non-owning view onto contiguous bytes, consisting of a pointer and a length.
  *
- * \param buf The buffer to write to.
- * \param v Value which will be written.
+ * Advancing a span by an offset yields the span starting at that offset, which keeps the
+ * `data_ptr + offset` notation of the parsers while carrying the remaining length along.
+ *
+ * \tparam ByteT Either uint8_t or const uint8_t.
+ */
+template <typename ByteT>
+class Span
+{
+public:
+  /*!
+   * \brief Constructs an empty span.
+   */
+  Span()
+    : m_data(nullptr)
+    , m_size(0)
+  {
+  }
+
+  /*!
+   * \brief Constructs a span from a pointer and a length.
+   *
+   * \param data Pointer to the first byte.
+   * \param size Number of bytes.
+   */
+  Span(ByteT* data, std::size_t size)
+    : m_data(data)
+    , m_size(size)
+  {
+  }
+
+  /*!
+   * \brief Constructs a span covering a contiguous container, e.g. a std::vector, std::array or
+   * another span.
+   *
+   * \param container The container, which has to outlive the span.
+   */
+  template <typename ContainerT,
+            typename = decltype(std::declval<ContainerT&>().data() + 0),
+            typename = decltype(std::declval<ContainerT&>().size())>
+  Span(ContainerT& container)
+    : m_data(container.data())
+    , m_size(container.size())
+  {
+  }
+
+  ByteT* data() const { return m_data; }
+
+  std::size_t size() const { return m_size; }
+
+  bool empty() const { return m_size == 0; }
+
+  ByteT* begin() const { return m_data; }
+
+  ByteT* end() const { return m_data + m_size; }
+
+  ByteT& operator[](std::size_t index) const
+  {
+    checkBounds(m_size, index, 1);
+    return m_data[index];
+  }
+
+  /*!
+   * \brief Returns the span starting at the given offset and reaching to the end of this span.
+   *
+   * \param offset Offset of the first byte.
+   * \returns The advanced span.
+   */
+  Span operator+(std::size_t offset) const
+  {
+    checkBounds(m_size, offset, 0);
+    return Span(m_data + offset, m_size - offset);
+  }
+
+  /*!
+   * \brief Returns a part of this span.
+   *
+   * \param offset Offset of the first byte.
+   * \param length Number of bytes.
+   * \returns The sub-span.
+   */
+  Span subspan(std::size_t offset, std::size_t length) const
+  {
+    checkBounds(m_size, offset, length);
+    return Span(m_data + offset, length);
+  }
+
+private:
+  ByteT* m_data;
+  std::size_t m_size;
+};
+
+/*!
+ * \brief A span of writable bytes.
+ */
+typedef Span<uint8_t> ByteSpan;
+
+/*!
+ * \brief A span of read-only bytes.
+ */
+typedef Span<const uint8_t> ConstByteSpan;
+
+namespace detail {
 
+/*!
+ * \brief Unsigned integer type with the given number of bytes.
  */
-inline void writeUint8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <std::size_t NumBytes>
+struct UnsignedWord;
+
+template <>
+struct UnsignedWord<1>
+{
+  typedef uint8_t type;
+};
+
+template <>
+struct UnsignedWord<2>
+{
+  typedef uint16_t type;
+};
+
+template <>
+struct UnsignedWord<4>
+{
+  typedef uint32_t type;
+};
+
+template <>
+struct UnsignedWord<8>
+{
+  typedef uint64_t type;
+};
+
+inline uint8_t swapBytes(uint8_t word)
 {
-  writeUint8(it, v);
+  return word;
 }
 
+inline uint16_t swapBytes(uint16_t word)
+{
+  return __builtin_bswap16(word);
+}
+
+inline uint32_t swapBytes(uint32_t word)
+{
+  return __builtin_bswap32(word);
+}
+
+inline uint64_t swapBytes(uint64_t word)
+{
+  return __builtin_bswap64(word);
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool HOST_IS_BIG_ENDIAN = true;
+#else
+constexpr bool HOST_IS_BIG_ENDIAN = false;
+#endif
+
+template <typename ValueT, bool BigEndian>
+inline ValueT readValue(const uint8_t* data)
+{
+  typedef typename UnsignedWord<sizeof(ValueT)>::type Word;
+  Word word;
+  std::memcpy(&word, data, sizeof(Word));
+  if (BigEndian != HOST_IS_BIG_ENDIAN)
+  {
+    word = swapBytes(word);
+  }
+  ValueT value;
+  std::memcpy(&value, &word, sizeof(ValueT));
+  return value;
+}
+
+template <typename ValueT, bool BigEndian>
+inline void writeValue(uint8_t* data, const ValueT value)
+{
+  typedef typename UnsignedWord<sizeof(ValueT)>::type Word;
+  Word word;
+  std::memcpy(&word, &value, sizeof(Word));
+  if (BigEndian != HOST_IS_BIG_ENDIAN)
+  {
+    word = swapBytes(word);
+  }
+  std::memcpy(data, &word, sizeof(Word));
+}
+
+} // namespace detail
+
 /*!
- * \brief Writes an unsigned 8-bit integer to a buffer at offset in little endian encoding.
+ * \brief Reads an integer in little endian encoding from an unchecked and possibly unaligned
+ * position.
  *
- * \param buf The buffer to write to.
- * \param v Value which will be written.
+ * \param data Position of the first byte, sizeof(ValueT) bytes have to be readable.
+ *
+ * \returns The value in host byte order.
+ */
+template <typename ValueT>
+inline ValueT readLittleEndian(const uint8_t* data)
+{
+  return detail::readValue<ValueT, false>(data);
+}
 
+/*!
+ * \brief Reads an integer in big endian encoding from an unchecked and possibly unaligned
+ * position.
+ *
+ * \param data Position of the first byte, sizeof(ValueT) bytes have to be readable.
+ *
+ * \returns The value in host byte order.
  */
-inline void writeUint8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename ValueT>
+inline ValueT readBigEndian(const uint8_t* data)
 {
-  writeUint8(it, v);
+  return detail::readValue<ValueT, true>(data);
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset.
+ * \brief Writes an integer in little endian encoding to an unchecked and possibly unaligned
+ * position.
  *
- * \param buf The buffer to write to.
+ * \param data Position of the first byte, sizeof(ValueT) bytes have to be writable.
  * \param v Value which will be written.
-
  */
-inline void writeInt8(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename ValueT>
+inline void writeLittleEndian(uint8_t* data, const ValueT v)
 {
-  writeUint8(it, v);
+  detail::writeValue<ValueT, false>(data, v);
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes an integer in big endian encoding to an unchecked and possibly unaligned position.
  *
- * \param buf The buffer to write to.
+ * \param data Position of the first byte, sizeof(ValueT) bytes have to be writable.
  * \param v Value which will be written.
+ */
+template <typename ValueT>
+inline void writeBigEndian(uint8_t* data, const ValueT v)
+{
+  detail::writeValue<ValueT, true>(data, v);
+}
 
+/*!
+ * \brief Reads an integer in little endian encoding from the start of a span.
+ *
+ * \param span Span to read from.
+ *
+ * \returns The value of the read integer.
+ */
+template <typename ValueT>
+inline ValueT readLittleEndian(ConstByteSpan span)
+{
+  checkBounds(span.size(), 0, sizeof(ValueT));
+  return readLittleEndian<ValueT>(span.data());
+}
+
+/*!
+ * \brief Reads an integer in big endian encoding from the start of a span.
+ *
+ * \param span Span to read from.
+ *
+ * \returns The value of the read integer.
  */
-inline void writeInt8BigEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename ValueT>
+inline ValueT readBigEndian(ConstByteSpan span)
 {
-  writeInt8(it, v);
+  checkBounds(span.size(), 0, sizeof(ValueT));
+  return readBigEndian<ValueT>(span.data());
 }
 
 /*!
- * \brief Writes a signed 8-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes an integer in little endian encoding to the start of a span.
  *
- * \param buf The buffer to write to.
+ * \param span Span to write to.
  * \param v Value which will be written.
+ */
+template <typename ValueT>
+inline void writeLittleEndian(ByteSpan span, const ValueT v)
+{
+  checkBounds(span.size(), 0, sizeof(ValueT));
+  writeLittleEndian<ValueT>(span.data(), v);
+}
 
+/*!
+ * \brief Writes an integer in big endian encoding to the start of a span.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
  */
-inline void writeInt8LittleEndian(std::vector<uint8_t>::iterator it, const uint8_t v)
+template <typename ValueT>
+inline void writeBigEndian(ByteSpan span, const ValueT v)
 {
-  writeInt8(it, v);
+  checkBounds(span.size(), 0, sizeof(ValueT));
+  writeBigEndian<ValueT>(span.data(), v);
 }
 
 /*!
- * \brief Writes an unsigned 16-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes an unsigned 8-bit integer to the start of a span.
  *
- * \param buf The buffer to write to.
+ * \param span Span to write to.
  * \param v Value which will be written.
+ */
+inline void writeUint8(ByteSpan span, const uint8_t v)
+{
+  writeLittleEndian<uint8_t>(span, v);
+}
 
+/*!
+ * \brief Writes an unsigned 8-bit integer to the start of a span in big endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
+ */
+inline void writeUint8BigEndian(ByteSpan span, const uint8_t v)
+{
+  writeLittleEndian<uint8_t>(span, v);
+}
+
+/*!
+ * \brief Writes an unsigned 8-bit integer to the start of a span in little endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint16BigEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+inline void writeUint8LittleEndian(ByteSpan span, const uint8_t v)
 {
-  *(it + 0) = (v & 0xff00) >> 8;
-  *(it + 1) = v & 0xff;
+  writeLittleEndian<uint8_t>(span, v);
 }
 
 /*!
- * \brief Writes an unsigned 16-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes a signed 8-bit integer to the start of a span.
  *
- * \param buf The buffer to write to.
+ * \param span Span to write to.
  * \param v Value which will be written.
+ */
+inline void writeInt8(ByteSpan span, const uint8_t v)
+{
+  writeLittleEndian<uint8_t>(span, v);
+}
 
+/*!
+ * \brief Writes a signed 8-bit integer to the start of a span in big endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint16LittleEndian(std::vector<uint8_t>::iterator it, const uint16_t v)
+inline void writeInt8BigEndian(ByteSpan span, const uint8_t v)
 {
-  *(it + 0) = v & 0xff;
-  *(it + 1) = (v & 0xff00) >> 8;
+  writeLittleEndian<uint8_t>(span, v);
 }
 
+/*!
+ * \brief Writes a signed 8-bit integer to the start of a span in little endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
+ */
+inline void writeInt8LittleEndian(ByteSpan span, const uint8_t v)
+{
+  writeLittleEndian<uint8_t>(span, v);
+}
 
 /*!
- * \brief Writes an unsigned 32-bit integer to a buffer at offset in big endian encoding.
+ * \brief Writes an unsigned 16-bit integer to the start of a span in big endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param span Span to write to.
  * \param v Value which will be written.
+ */
+inline void writeUint16BigEndian(ByteSpan span, const uint16_t v)
+{
+  writeBigEndian<uint16_t>(span, v);
+}
 
+/*!
+ * \brief Writes an unsigned 16-bit integer to the start of a span in little endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint32BigEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+inline void writeUint16LittleEndian(ByteSpan span, const uint16_t v)
 {
-  *(it + 0) = (v & 0xff000000) >> 24;
-  *(it + 1) = (v & 0xff0000) >> 16;
-  *(it + 2) = (v & 0xff00) >> 8;
-  *(it + 3) = v & 0xff;
+  writeLittleEndian<uint16_t>(span, v);
 }
 
 /*!
- * \brief Writes an unsigned 32-bit integer to a buffer at offset in little endian encoding.
+ * \brief Writes an unsigned 32-bit integer to the start of a span in big endian encoding.
  *
- * \param buf The buffer to write to.
+ * \param span Span to write to.
  * \param v Value which will be written.
+ */
+inline void writeUint32BigEndian(ByteSpan span, const uint32_t v)
+{
+  writeBigEndian<uint32_t>(span, v);
+}
 
+/*!
+ * \brief Writes an unsigned 32-bit integer to the start of a span in little endian encoding.
+ *
+ * \param span Span to write to.
+ * \param v Value which will be written.
  */
-inline void writeUint32LittleEndian(std::vector<uint8_t>::iterator it, const uint32_t v)
+inline void writeUint32LittleEndian(ByteSpan span, const uint32_t v)
 {
-  *(it + 3) = (v & 0xff000000) >> 24;
-  *(it + 2) = (v & 0xff0000) >> 16;
-  *(it + 1) = (v & 0xff00) >> 8;
-  *(it + 0) = v & 0xff;
+  writeLittleEndian<uint32_t>(span, v);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset.
+ * \brief Read an unsigned 8-bit integer from the start of a span.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8(ConstByteSpan span)
 {
-  return *(it + 0);
+  return readLittleEndian<uint8_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 8-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8BigEndian(ConstByteSpan span)
 {
-  return readUint8(it);
+  return readLittleEndian<uint8_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 8-bit integer at offset in big little encoding.
+ * \brief Read an unsigned 8-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint8_t readUint8LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint8_t readUint8LittleEndian(ConstByteSpan span)
 {
-  return readUint8(it);
+  return readLittleEndian<uint8_t>(span);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset.
+ * \brief Read a signed 8-bit integer from the start of a span.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8(ConstByteSpan span)
 {
-  return readUint8(it);
+  return readLittleEndian<int8_t>(span);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset in big endian encoding.
+ * \brief Read a signed 8-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8BigEndian(ConstByteSpan span)
 {
-  return readInt8(it);
+  return readLittleEndian<int8_t>(span);
 }
 
 /*!
- * \brief Read a signed 8-bit integer at offset in little endian encoding.
+ * \brief Read a signed 8-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int8_t readInt8LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline int8_t readInt8LittleEndian(ConstByteSpan span)
 {
-  return readInt8(it);
+  return readLittleEndian<int8_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 16-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 16-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint16_t readUint16BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint16_t readUint16BigEndian(ConstByteSpan span)
 {
-  return (*(it + 0) << 8) + *(it + 1);
+  return readBigEndian<uint16_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 16-bit integer at offset in little endian encoding.
+ * \brief Read an unsigned 16-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint16_t readUint16LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint16_t readUint16LittleEndian(ConstByteSpan span)
 {
-  return (*(it + 1) << 8) + *(it + 0);
+  return readLittleEndian<uint16_t>(span);
 }
 
 /*!
- * \brief Read a signed 16-bit integer at offset in big endian encoding.
+ * \brief Read a signed 16-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int16_t readInt16BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int16_t readInt16BigEndian(ConstByteSpan span)
 {
-  return readUint16BigEndian(it);
+  return readBigEndian<int16_t>(span);
 }
 
 /*!
- * \brief Read a signed 16-bit integer at offset in little endian encoding.
+ * \brief Read a signed 16-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int16_t readInt16LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline int16_t readInt16LittleEndian(ConstByteSpan span)
 {
-  return readUint16LittleEndian(it);
+  return readLittleEndian<int16_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in big endian encoding.
+ * \brief Read an unsigned 32-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint32_t readUint32BigEndian(std::vector<uint8_t>::const_iterator it)
+inline uint32_t readUint32BigEndian(ConstByteSpan span)
 {
-  return (*(it + 0) << 24) + (*(it + 1) << 16) + (*(it + 2) << 8) + *(it + 3);
+  return readBigEndian<uint32_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in little endian encoding.
+ * \brief Read an unsigned 32-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline uint32_t readUint32LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline uint32_t readUint32LittleEndian(ConstByteSpan span)
 {
-  return (*(it + 3) << 24) + (*(it + 2) << 16) + (*(it + 1) << 8) + *(it + 0);
+  return readLittleEndian<uint32_t>(span);
 }
 
 /*!
- * \brief Read an unsigned 32-bit integer at offset in big endian encoding.
+ * \brief Read a signed 32-bit integer from the start of a span in big endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int32_t readInt32BigEndian(std::vector<uint8_t>::const_iterator it)
+inline int32_t readInt32BigEndian(ConstByteSpan span)
 {
-  return readUint32BigEndian(it);
+  return readBigEndian<int32_t>(span);
 }
 
-
 /*!
- * \brief Read an unsigned 32-bit integer at offset in little endian encoding.
+ * \brief Read a signed 32-bit integer from the start of a span in little endian encoding.
  *
- * \param buf Buffer to read from.
- * \param offset Position of integer.
+ * \param span Span to read from.
  *
  * \returns The value of the read integer.
  */
-inline int32_t readInt32LittleEndian(std::vector<uint8_t>::const_iterator it)
+inline int32_t readInt32LittleEndian(ConstByteSpan span)
 {
-  return readUint32LittleEndian(it);
+  return readLittleEndian<int32_t>(span);
 }
 
 } // namespace read_write_helper
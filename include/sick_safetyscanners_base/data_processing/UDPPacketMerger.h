@@ -36,18 +36,65 @@
 #define SICK_SAFETYSCANNERS_BASE_DATA_PROCESSING_UDPPACKETMERGER_H
 
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
-#include "sick_safetyscanners_base/datastructure/ParsedPacketBuffer.h"
 
 #include "sick_safetyscanners_base/data_processing/ParseDatagramHeader.h"
 
-#include <algorithm>
+#include <chrono>
 #include <mutex>
+#include <vector>
 
 namespace sick {
 namespace data_processing {
 
+/*!
+ * \brief Bounds for the data packets which are reassembled concurrently. Incomplete data packets
+ * exceeding one of these bounds are evicted, e.g. if one of their fragments got lost.
+ */
+struct ReassemblyLimits
+{
+  /*!
+   * \brief Maximum number of data packets which are reassembled concurrently.
+   */
+  std::size_t max_in_flight{4};
+
+  /*!
+   * \brief Maximum size of the receive buffers pinned by the fragments of all data packets in
+   * reassembly [bytes]. Every fragment pins a whole receive buffer, so this is the number of
+   * fragments times the buffer size rather than the length of the data packets.
+   */
+  std::size_t max_memory{1024 * 1024};
+
+  /*!
+   * \brief Maximum time since the first fragment of a data packet has been received.
+   */
+  std::chrono::milliseconds max_age{1000};
+
+  /*!
+   * \brief Evicts all data packets which started before a data packet that just completed.
+   */
+  bool evict_superseded{true};
+};
+
+/*!
+ * \brief Counters of the reassembly of data packets.
+ */
+struct ReassemblyStatistics
+{
+  uint64_t completed{0};
+  uint64_t evicted_by_age{0};
+  uint64_t evicted_by_count{0};
+  uint64_t evicted_by_memory{0};
+  uint64_t evicted_superseded{0};
+  uint64_t dropped_fragments{0};
+};
+
 /*!
  * \brief Merges udp packets together to a complete data packet.
+ *
+ * Fragments are reassembled in a fixed number of in-flight slots keyed by the datagram
+ * identification. Each slot references the received fragments ordered by their fragment offset,
+ * so completion is detected by a received-byte counter. The deployed data packet is a fragmented
+ * PacketBuffer, the fragments are never concatenated.
  */
 class UDPPacketMerger
 {
@@ -57,6 +104,13 @@ public:
    */
   UDPPacketMerger();
 
+  /*!
+   * \brief Constructor of udp packet merger.
+   *
+   * \param limits Bounds for the data packets which are reassembled concurrently.
+   */
+  explicit UDPPacketMerger(const ReassemblyLimits& limits);
+
   /*!
    * \brief Returns if a data packet is complete.
    *
@@ -74,30 +128,87 @@ public:
   bool addUDPPacket(const sick::datastructure::PacketBuffer& buffer);
 
   /*!
-   * \brief Get the latest complete data packet.
+   * \brief Get the latest complete data packet. The data packet is handed over to the caller, so it
+   * can only be retrieved once.
    *
    * \returns The latest complete data packet.
    */
   sick::datastructure::PacketBuffer getDeployedPacketBuffer();
 
+  /*!
+   * \brief Takes back a deployed data packet once it has been processed. The received datagrams are
+   * released, while the storage of its fragment list is reused for a following data packet, so the
+   * reassembly does not allocate per data packet.
+   *
+   * \param buffer The deployed data packet, it is empty afterwards.
+   */
+  void releasePacketBuffer(sick::datastructure::PacketBuffer&& buffer);
+
+  /*!
+   * \brief Evicts the data packets which exceed the maximum age. This is done whenever a udp packet
+   * is added, but has to be triggered if no udp packets arrive, e.g. after a receive timeout.
+   */
+  void evictExpired();
+
+  /*!
+   * \brief Sets new bounds for the reassembly. Data packets currently in reassembly are dropped.
+   *
+   * \param limits Bounds for the data packets which are reassembled concurrently.
+   */
+  void setLimits(const ReassemblyLimits& limits);
+
+  /*!
+   * \brief Returns the current bounds for the reassembly.
+   *
+   * \returns The bounds for the data packets which are reassembled concurrently.
+   */
+  ReassemblyLimits getLimits() const;
+
+  /*!
+   * \brief Returns the counters of completed and evicted data packets.
+   *
+   * \returns The reassembly statistics.
+   */
+  ReassemblyStatistics getStatistics() const;
+
 private:
+  /*!
+   * \brief A data packet which is currently being reassembled.
+   */
+  struct ReassemblySlot
+  {
+    bool in_use{false};
+    uint32_t identification{0};
+    uint32_t total_length{0};
+    uint32_t received_length{0};
+    std::size_t pinned_memory{0};
+    uint64_t sequence{0};
+    std::chrono::steady_clock::time_point started;
+    sick::datastructure::PacketBuffer::FragmentVector fragments;
+  };
+
   bool m_is_complete;
   sick::datastructure::PacketBuffer m_deployed_packet_buffer;
 
-  std::map<uint32_t, sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector>
-    m_parsed_packet_buffer_map;
-  std::mutex m_buffer_mutex;
-
-  bool addToMap(const sick::datastructure::PacketBuffer& buffer,
-                const sick::datastructure::DatagramHeader& header);
-  bool deployPacketIfComplete(datastructure::DatagramHeader& header);
-  bool checkIfComplete(sick::datastructure::DatagramHeader& header);
-  uint32_t calcualteCurrentLengthOfParsedPacketBuffer(
-    const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec);
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector
-  getSortedParsedPacketBufferForIdentification(const sick::datastructure::DatagramHeader& header);
-  std::vector<uint8_t> removeHeaderFromParsedPacketBuffer(
-    const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec);
+  ReassemblyLimits m_limits;
+  ReassemblyStatistics m_statistics;
+  std::vector<ReassemblySlot> m_slots;
+  std::vector<sick::datastructure::PacketBuffer::FragmentVector> m_spare_fragments;
+  uint64_t m_next_sequence;
+  std::size_t m_memory_in_use;
+  mutable std::mutex m_buffer_mutex;
+
+  void evictExpiredSlots(const std::chrono::steady_clock::time_point& now);
+  void evictSupersededSlots(const ReassemblySlot& completed_slot);
+  ReassemblySlot* findOldestSlot(const ReassemblySlot* excluded_slot = nullptr);
+  ReassemblySlot* findOrAssignSlot(const sick::datastructure::DatagramHeader& header,
+                                   const std::chrono::steady_clock::time_point& now);
+  void resetSlot(ReassemblySlot& slot);
+  bool reserveMemory(ReassemblySlot& slot, std::size_t memory);
+  bool writeFragment(ReassemblySlot& slot,
+                     const sick::datastructure::PacketBuffer& buffer,
+                     const sick::datastructure::DatagramHeader& header);
+  void deploySlot(ReassemblySlot& slot);
 };
 
 } // namespace data_processing
@@ -0,0 +1,122 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file AngleTable.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_ANGLETABLE_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_ANGLETABLE_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Immutable table of the beam angles of a scan configuration together with their sine and
+ * cosine.
+ *
+ * The table only depends on the start angle, the angular beam resolution and the number of beams.
+ * It is therefore built once per configuration and shared by all scans measured with it.
+ */
+class AngleTable
+{
+public:
+  /*!
+   * \brief Constructor computing the tables. Each angle is computed directly from its beam index,
+   * so the angles do not accumulate rounding errors.
+   *
+   * \param start_angle Angle of the first beam in [deg].
+   * \param angular_beam_resolution Angle between two consecutive beams in [deg].
+   * \param number_of_beams Number of beams.
+   */
+  AngleTable(float start_angle, float angular_beam_resolution, uint32_t number_of_beams);
+
+  /*!
+   * \brief Checks if the table has been built for the given configuration.
+   *
+   * \param start_angle Angle of the first beam in [deg].
+   * \param angular_beam_resolution Angle between two consecutive beams in [deg].
+   * \param number_of_beams Number of beams.
+   * \return If the table can be used for the configuration.
+   */
+  bool matches(float start_angle, float angular_beam_resolution, uint32_t number_of_beams) const;
+
+  /*!
+   * \brief Getter for the start angle.
+   * \return The start angle in [deg].
+   */
+  float getStartAngle() const;
+
+  /*!
+   * \brief Getter for the angular beam resolution.
+   * \return The angular beam resolution in [deg].
+   */
+  float getAngularBeamResolution() const;
+
+  /*!
+   * \brief Getter for the number of beams.
+   * \return The number of beams, which is the length of each table.
+   */
+  uint32_t getNumberOfBeams() const;
+
+  /*!
+   * \brief Getter for the angles of all beams.
+   * \return The angles in [deg].
+   */
+  const std::vector<float>& getAnglesVector() const;
+
+  /*!
+   * \brief Getter for the sine of all beam angles.
+   * \return The sines.
+   */
+  const std::vector<float>& getSinesVector() const;
+
+  /*!
+   * \brief Getter for the cosine of all beam angles.
+   * \return The cosines.
+   */
+  const std::vector<float>& getCosinesVector() const;
+
+private:
+  float m_start_angle;
+  float m_angular_beam_resolution;
+  uint32_t m_number_of_beams;
+
+  std::vector<float> m_angles;
+  std::vector<float> m_sines;
+  std::vector<float> m_cosines;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_ANGLETABLE_H
@@ -57,26 +57,38 @@ public:
    *
    * \returns The application input.
    */
-  ApplicationInputs getInputs() const;
+  const ApplicationInputs& getInputs() const;
   /*!
    * \brief Sets the application input.
    *
    * \param inputs The new application input.
    */
   void setInputs(const ApplicationInputs& inputs);
+  /*!
+   * \brief Sets the application input.
+   *
+   * \param inputs The new application input.
+   */
+  void setInputs(ApplicationInputs&& inputs);
 
   /*!
    * \brief Gets the application output.
    *
    * \returns The application output.
    */
-  ApplicationOutputs getOutputs() const;
+  const ApplicationOutputs& getOutputs() const;
   /*!
    * \brief Sets the application output.
    *
    * \param outputs The application output.
    */
   void setOutputs(const ApplicationOutputs& outputs);
+  /*!
+   * \brief Sets the application output.
+   *
+   * \param outputs The application output.
+   */
+  void setOutputs(ApplicationOutputs&& outputs);
 
   /*!
    * \brief Check if application data is empty.
@@ -35,9 +35,13 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_APPLICATIONINPUTS_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_APPLICATIONINPUTS_H
 
+#include <algorithm>
+#include <array>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/datastructure/FlagWord.h"
+
 namespace sick {
 namespace datastructure {
 
@@ -47,6 +51,21 @@ namespace datastructure {
 class ApplicationInputs
 {
 public:
+  /*!
+   * \brief Flags of the 32 static unsafe input sources.
+   */
+  typedef FlagWord<uint32_t, 32> UnsafeInputsWord;
+
+  /*!
+   * \brief Flags of the 20 monitoring cases.
+   */
+  typedef FlagWord<uint32_t, 20> MonitoringCaseFlagsWord;
+
+  /*!
+   * \brief Numbers of the 20 monitoring cases.
+   */
+  typedef std::array<uint16_t, 20> MonitoringCaseArray;
+
   /*!
    * \brief Constructor of application inputs.
    */
@@ -69,6 +88,19 @@ public:
      */
   setUnsafeInputsInputSourcesVector(const std::vector<bool>& unsafe_inputs_input_sources_vector);
 
+  /*!
+   * \brief Gets the unsafe input sources as transmitted.
+   *
+   * \returns The unsafe input sources, one bit per flag.
+   */
+  UnsafeInputsWord getUnsafeInputsInputSources() const;
+  /*!
+   * \brief Sets the unsafe input sources.
+   *
+   * \param unsafe_inputs_input_sources The unsafe input sources, one bit per flag.
+   */
+  void setUnsafeInputsInputSources(const UnsafeInputsWord& unsafe_inputs_input_sources);
+
   /*!
    * \brief Gets the flags for the unsafe input sources.
    *
@@ -86,6 +118,19 @@ public:
    */
   void setUnsafeInputsFlagsVector(const std::vector<bool>& unsafe_inputs_flags_vector);
 
+  /*!
+   * \brief Gets the unsafe input sources flags as transmitted.
+   *
+   * \returns The unsafe input sources flags, one bit per flag.
+   */
+  UnsafeInputsWord getUnsafeInputsFlags() const;
+  /*!
+   * \brief Sets the unsafe input sources flags.
+   *
+   * \param unsafe_inputs_flags The unsafe input sources flags, one bit per flag.
+   */
+  void setUnsafeInputsFlags(const UnsafeInputsWord& unsafe_inputs_flags);
+
   /*!
    * \brief Gets the monitoring case numbers.
    *
@@ -99,6 +144,19 @@ public:
    */
   void setMonitoringCaseVector(const std::vector<uint16_t>& monitoring_case_vector);
 
+  /*!
+   * \brief Gets the monitoring case numbers.
+   *
+   * \returns The monitoring case numbers.
+   */
+  const MonitoringCaseArray& getMonitoringCases() const;
+  /*!
+   * \brief Sets the monitoring case numbers.
+   *
+   * \param monitoring_cases The monitoring case numbers.
+   */
+  void setMonitoringCases(const MonitoringCaseArray& monitoring_cases);
+
   /*!
    * \brief Gets the monitoring case flags.
    *
@@ -112,6 +170,19 @@ public:
    */
   void setMonitoringCaseFlagsVector(const std::vector<bool>& monitoring_case_flags_vector);
 
+  /*!
+   * \brief Gets the monitoring case flags as transmitted.
+   *
+   * \returns The monitoring case flags, one bit per flag.
+   */
+  MonitoringCaseFlagsWord getMonitoringCaseFlags() const;
+  /*!
+   * \brief Sets the monitoring case flags.
+   *
+   * \param monitoring_case_flags The monitoring case flags, one bit per flag.
+   */
+  void setMonitoringCaseFlags(const MonitoringCaseFlagsWord& monitoring_case_flags);
+
   /*!
    * \brief Gets the first linear velocity input.
    *
@@ -204,11 +275,11 @@ public:
   void setSleepModeInput(const int8_t& sleep_mode_input);
 
 private:
-  std::vector<bool> m_unsafe_inputs_input_sources_vector;
-  std::vector<bool> m_unsafe_inputs_flags_vector;
+  UnsafeInputsWord m_unsafe_inputs_input_sources;
+  UnsafeInputsWord m_unsafe_inputs_flags;
 
-  std::vector<uint16_t> m_monitoring_case_vector;
-  std::vector<bool> m_monitoring_case_flags_vector;
+  MonitoringCaseArray m_monitoring_cases;
+  MonitoringCaseFlagsWord m_monitoring_case_flags;
 
   int16_t m_velocity_0;
   int16_t m_velocity_1;
@@ -57,13 +57,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -120,13 +126,19 @@ public:
    *
    * \returns The application name for the scanner.
    */
-  std::string getApplicationName() const;
+  const std::string& getApplicationName() const;
   /*!
    * \brief Sets the application name for the scanner.
    *
    * \param application_name The application name for the scanner.
    */
   void setApplicationName(const std::string& application_name);
+  /*!
+   * \brief Sets the application name for the scanner.
+   *
+   * \param application_name The application name for the scanner.
+   */
+  void setApplicationName(std::string&& application_name);
 
 private:
   std::string m_version_c_version;
@@ -35,9 +35,13 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_APPLICATIONOUTPUTS_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_APPLICATIONOUTPUTS_H
 
+#include <algorithm>
+#include <array>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/datastructure/FlagWord.h"
+
 
 namespace sick {
 namespace datastructure {
@@ -48,6 +52,31 @@ namespace datastructure {
 class ApplicationOutputs
 {
 public:
+  /*!
+   * \brief Flags of the 20 evaluation paths.
+   */
+  typedef FlagWord<uint32_t, 20> EvalOutWord;
+
+  /*!
+   * \brief Flags of the 20 monitoring cases.
+   */
+  typedef FlagWord<uint32_t, 20> MonitoringCaseFlagsWord;
+
+  /*!
+   * \brief Numbers of the 20 monitoring cases.
+   */
+  typedef std::array<uint16_t, 20> MonitoringCaseArray;
+
+  /*!
+   * \brief Resulting velocities of the 20 monitoring cases.
+   */
+  typedef std::array<int16_t, 20> ResultingVelocityArray;
+
+  /*!
+   * \brief Validity flags of the 20 resulting velocities.
+   */
+  typedef FlagWord<uint32_t, 20> ResultingVelocityFlagsWord;
+
   /*!
    * \brief Constructor of the application outputs.
    */
@@ -66,6 +95,19 @@ public:
    */
   void setEvalOutVector(const std::vector<bool>& eval_out_vector);
 
+  /*!
+   * \brief Gets the evaluation path outputs as transmitted.
+   *
+   * \returns The evaluation path outputs, one bit per flag.
+   */
+  EvalOutWord getEvalOut() const;
+  /*!
+   * \brief Sets the evaluation path outputs.
+   *
+   * \param eval_out The evaluation path outputs, one bit per flag.
+   */
+  void setEvalOut(const EvalOutWord& eval_out);
+
   /*!
    * \brief Gets if a cut-off path from the output paths is safe.
    *
@@ -79,6 +121,19 @@ public:
    */
   void setEvalOutIsSafeVector(const std::vector<bool>& eval_out_is_safe_vector);
 
+  /*!
+   * \brief Gets the evaluation path safety flags as transmitted.
+   *
+   * \returns The evaluation path safety flags, one bit per flag.
+   */
+  EvalOutWord getEvalOutIsSafe() const;
+  /*!
+   * \brief Sets the evaluation path safety flags.
+   *
+   * \param eval_out_is_safe The evaluation path safety flags, one bit per flag.
+   */
+  void setEvalOutIsSafe(const EvalOutWord& eval_out_is_safe);
+
   /*!
    * \brief If the output path is valid.
    *
@@ -92,6 +147,19 @@ public:
    */
   void setEvalOutIsValidVector(const std::vector<bool>& eval_out_is_valid_vector);
 
+  /*!
+   * \brief Gets the evaluation path validity flags as transmitted.
+   *
+   * \returns The evaluation path validity flags, one bit per flag.
+   */
+  EvalOutWord getEvalOutIsValid() const;
+  /*!
+   * \brief Sets the evaluation path validity flags.
+   *
+   * \param eval_out_is_valid The evaluation path validity flags, one bit per flag.
+   */
+  void setEvalOutIsValid(const EvalOutWord& eval_out_is_valid);
+
   /*!
    * \brief Gets the currently active monitoring case numbers.
    *
@@ -105,6 +173,19 @@ public:
    */
   void setMonitoringCaseVector(const std::vector<uint16_t>& monitoring_case_vector);
 
+  /*!
+   * \brief Gets the monitoring case numbers.
+   *
+   * \returns The monitoring case numbers.
+   */
+  const MonitoringCaseArray& getMonitoringCases() const;
+  /*!
+   * \brief Sets the monitoring case numbers.
+   *
+   * \param monitoring_cases The monitoring case numbers.
+   */
+  void setMonitoringCases(const MonitoringCaseArray& monitoring_cases);
+
   /*!
    * \brief Gets if the corresponding monitoring case number is valid.
    *
@@ -118,6 +199,19 @@ public:
    */
   void setMonitoringCaseFlagsVector(const std::vector<bool>& monitoring_case_flags_vector);
 
+  /*!
+   * \brief Gets the monitoring case flags as transmitted.
+   *
+   * \returns The monitoring case flags, one bit per flag.
+   */
+  MonitoringCaseFlagsWord getMonitoringCaseFlags() const;
+  /*!
+   * \brief Sets the monitoring case flags.
+   *
+   * \param monitoring_case_flags The monitoring case flags, one bit per flag.
+   */
+  void setMonitoringCaseFlags(const MonitoringCaseFlagsWord& monitoring_case_flags);
+
   /*!
    * \brief Gets the state of the sleep mode.
    *
@@ -301,6 +395,19 @@ public:
    */
   void setResultingVelocityVector(const std::vector<int16_t>& resulting_velocity_vector);
 
+  /*!
+   * \brief Gets the resulting velocities.
+   *
+   * \returns The resulting velocities.
+   */
+  const ResultingVelocityArray& getResultingVelocities() const;
+  /*!
+   * \brief Sets the resulting velocities.
+   *
+   * \param resulting_velocities The resulting velocities.
+   */
+  void setResultingVelocities(const ResultingVelocityArray& resulting_velocities);
+
   /*!
    * \brief Gets if the resulting velocities are valid.
    *
@@ -315,6 +422,19 @@ public:
      */
   setResultingVelocityIsValidVector(const std::vector<bool>& resulting_velocity_is_valid_vector);
 
+  /*!
+   * \brief Gets the resulting velocity validity flags as transmitted.
+   *
+   * \returns The resulting velocity validity flags, one bit per flag.
+   */
+  ResultingVelocityFlagsWord getResultingVelocityIsValid() const;
+  /*!
+   * \brief Sets the resulting velocity validity flags.
+   *
+   * \param resulting_velocity_is_valid The resulting velocity validity flags, one bit per flag.
+   */
+  void setResultingVelocityIsValid(const ResultingVelocityFlagsWord& resulting_velocity_is_valid);
+
   /*!
    * \brief Gets if the sleep mode is valid.
    *
@@ -342,12 +462,12 @@ public:
   void setFlagsHostErrorFlagsAreValid(bool flags_host_error_flags_are_valid);
 
 private:
-  std::vector<bool> m_eval_out_vector;
-  std::vector<bool> m_eval_out_is_safe_vector;
-  std::vector<bool> m_eval_out_is_valid_vector;
+  EvalOutWord m_eval_out;
+  EvalOutWord m_eval_out_is_safe;
+  EvalOutWord m_eval_out_is_valid;
 
-  std::vector<uint16_t> m_monitoring_case_vector;
-  std::vector<bool> m_monitoring_case_flags_vector;
+  MonitoringCaseArray m_monitoring_cases;
+  MonitoringCaseFlagsWord m_monitoring_case_flags;
 
   int8_t m_sleep_mode_output;
 
@@ -366,8 +486,8 @@ private:
   bool m_velocity_0_transmitted_safely;
   bool m_velocity_1_transmitted_safely;
 
-  std::vector<int16_t> m_resulting_velocity_vector;
-  std::vector<bool> m_resulting_velocity_is_valid_vector;
+  ResultingVelocityArray m_resulting_velocities;
+  ResultingVelocityFlagsWord m_resulting_velocity_is_valid;
 
   bool m_flags_sleep_mode_output_is_valid;
   bool m_flags_host_error_flags_are_valid;
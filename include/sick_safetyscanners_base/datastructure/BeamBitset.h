@@ -0,0 +1,216 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file BeamBitset.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_BEAMBITSET_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_BEAMBITSET_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Set of flags with one flag per beam, packed into 64 bit words.
+ *
+ * Flag i is stored in bit (i % 64) of word (i / 64), which matches the bit order of the packed
+ * flags in the sensor telegrams. Bits beyond the size of the set are always zero, so the words can
+ * be combined and counted directly.
+ */
+class BeamBitset
+{
+public:
+  typedef uint64_t Word;
+
+  /*!
+   * \brief Number of flags stored in a single word.
+   */
+  static const std::size_t BITS_PER_WORD = 64;
+
+  /*!
+   * \brief Value returned by the find functions if no flag is set.
+   */
+  static const std::size_t NPOS = static_cast<std::size_t>(-1);
+
+  /*!
+   * \brief Iterator over all flags of the set, dereferencing to the value of each flag.
+   */
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef bool value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const bool* pointer;
+    typedef bool reference;
+
+    const_iterator(const BeamBitset* bitset, std::size_t index);
+
+    bool operator*() const;
+    const_iterator& operator++();
+    const_iterator operator++(int);
+    bool operator==(const const_iterator& other) const;
+    bool operator!=(const const_iterator& other) const;
+
+  private:
+    const BeamBitset* m_bitset;
+    std::size_t m_index;
+  };
+
+  /*!
+   * \brief Constructor of an empty set.
+   */
+  BeamBitset();
+
+  /*!
+   * \brief Constructor of a set with all flags cleared.
+   *
+   * \param size Number of flags.
+   */
+  explicit BeamBitset(std::size_t size);
+
+  /*!
+   * \brief Constructor of a set from a vector of flags.
+   *
+   * \param flags_vector The flags.
+   */
+  explicit BeamBitset(const std::vector<bool>& flags_vector);
+
+  /*!
+   * \brief Replaces the content of the set with flags packed into bytes, least significant bit
+   * first. The storage keeps its capacity.
+   *
+   * \param bytes Pointer to the packed flags.
+   * \param num_bytes Number of bytes available at bytes.
+   * \param size Number of flags. Flags not covered by the bytes are cleared.
+   */
+  void assign(const uint8_t* bytes, std::size_t num_bytes, std::size_t size);
+
+  /*!
+   * \brief Returns the number of flags.
+   * \return The number of flags.
+   */
+  std::size_t getSize() const;
+
+  /*!
+   * \brief Returns the value of a single flag.
+   * \param index Index of the flag, has to be less than getSize().
+   * \return The value of the flag.
+   */
+  bool getFlag(std::size_t index) const;
+
+  /*!
+   * \brief Sets the value of a single flag.
+   * \param index Index of the flag, has to be less than getSize().
+   * \param value The new value of the flag.
+   */
+  void setFlag(std::size_t index, bool value);
+
+  /*!
+   * \brief Returns the number of set flags.
+   * \return The number of set flags.
+   */
+  std::size_t countSetFlags() const;
+
+  /*!
+   * \brief Returns the number of flags set in this set as well as in the mask.
+   * \param mask The mask, flags beyond its size are treated as cleared.
+   * \return The number of flags set in both sets.
+   */
+  std::size_t countSetFlags(const BeamBitset& mask) const;
+
+  /*!
+   * \brief Returns if any flag is set.
+   * \return If any flag is set.
+   */
+  bool isAnySet() const;
+
+  /*!
+   * \brief Returns the index of the first set flag.
+   * \return The index of the first set flag, NPOS if no flag is set.
+   */
+  std::size_t findFirstSetFlag() const;
+
+  /*!
+   * \brief Returns the index of the first set flag after the given index.
+   * \param index The index to start searching after.
+   * \return The index of the next set flag, NPOS if no further flag is set.
+   */
+  std::size_t findNextSetFlag(std::size_t index) const;
+
+  /*!
+   * \brief Clears all flags which are not set in the mask.
+   * \param mask The mask, flags beyond its size are treated as cleared.
+   * \return Reference to this set.
+   */
+  BeamBitset& operator&=(const BeamBitset& mask);
+
+  /*!
+   * \brief Returns the flags set in this set as well as in the mask.
+   * \param mask The mask, flags beyond its size are treated as cleared.
+   * \return A set of the size of this set.
+   */
+  BeamBitset operator&(const BeamBitset& mask) const;
+
+  bool operator==(const BeamBitset& other) const;
+  bool operator!=(const BeamBitset& other) const;
+
+  /*!
+   * \brief Returns the packed words.
+   * \return The words, bits beyond the size are zero.
+   */
+  const std::vector<Word>& getWords() const;
+
+  /*!
+   * \brief Expands the flags into a vector.
+   * \return Vector containing one bool per flag.
+   */
+  std::vector<bool> toVector() const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+private:
+  std::size_t m_size;
+  std::vector<Word> m_words;
+
+  static std::size_t getNumWords(std::size_t size);
+  static std::size_t countBits(Word word);
+  static std::size_t findLowestBit(Word word);
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_BEAMBITSET_H
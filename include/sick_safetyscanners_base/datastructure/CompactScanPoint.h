@@ -0,0 +1,179 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file CompactScanPoint.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_COMPACTSCANPOINT_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_COMPACTSCANPOINT_H
+
+#include <stdint.h>
+
+#include "sick_safetyscanners_base/datastructure/AngleTable.h"
+#include "sick_safetyscanners_base/datastructure/ScanPoint.h"
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Scanpoint packed into 8 bytes for keeping large numbers of scans in memory.
+ *
+ * Instead of the angle the index of the beam is stored, the angle is looked up in the AngleTable
+ * of the scan. The status bits are kept in the status byte as transmitted by the sensor.
+ */
+class CompactScanPoint
+{
+public:
+  /*!
+   * \brief Bits of the status byte of a scanpoint as transmitted by the sensor.
+   */
+  static const uint8_t STATUS_VALID_BIT                 = 0x01 << 0;
+  static const uint8_t STATUS_INFINITE_BIT              = 0x01 << 1;
+  static const uint8_t STATUS_GLARE_BIT                 = 0x01 << 2;
+  static const uint8_t STATUS_REFLECTOR_BIT             = 0x01 << 3;
+  static const uint8_t STATUS_CONTAMINATION_BIT         = 0x01 << 4;
+  static const uint8_t STATUS_CONTAMINATION_WARNING_BIT = 0x01 << 5;
+
+  /*!
+   * \brief Constructor of an empty scanpoint of the first beam.
+   */
+  CompactScanPoint();
+
+  /*!
+   * \brief Constructor of a scanpoint from its column values.
+   * \param beam_index Index of the beam in the scan.
+   * \param distance Distance of the scanpoint in [mm].
+   * \param reflectivity Reflectivity of the scanpoint.
+   * \param status Status byte of the scanpoint.
+   */
+  CompactScanPoint(uint32_t beam_index, uint16_t distance, uint8_t reflectivity, uint8_t status);
+
+  /*!
+   * \brief Constructor packing a scanpoint. Apart from the angle all values are kept, the angle
+   * is restored from the beam index by toScanPoint().
+   * \param scan_point The scanpoint.
+   * \param beam_index Index of the beam the scanpoint was measured with.
+   */
+  CompactScanPoint(const ScanPoint& scan_point, uint32_t beam_index);
+
+  /*!
+   * \brief Unpacks the scanpoint.
+   * \param angle_table Angle table of the scan the scanpoint belongs to.
+   * \return The scanpoint with the angle of its beam.
+   */
+  ScanPoint toScanPoint(const AngleTable& angle_table) const;
+
+  /*!
+   * \brief Getter for the index of the beam.
+   * \return The index of the beam in the scan.
+   */
+  uint32_t getBeamIndex() const;
+
+  /*!
+   * \brief Looks up the angle of the beam.
+   * \param angle_table Angle table of the scan the scanpoint belongs to.
+   * \return The angle of the scanpoint in [deg].
+   */
+  float getAngle(const AngleTable& angle_table) const;
+
+  /*!
+   * \brief Getter for the distance of the scanpoint.
+   * \return The distance of the scanpoint in [mm].
+   */
+  uint16_t getDistance() const;
+
+  /*!
+   * \brief Getter for the reflectivity value.
+   * \return The reflectivity value of the scanpoint.
+   */
+  uint8_t getReflectivity() const;
+
+  /*!
+   * \brief Getter for the status byte. The bits are defined by the STATUS_* constants.
+   * \return The status byte of the scanpoint.
+   */
+  uint8_t getStatusByte() const;
+
+  /*!
+   * \brief Returns if the scanpoint is valid.
+   * \return If the scanpoint is valid.
+   */
+  bool getValidBit() const;
+
+  /*!
+   * \brief Returns if the scanpoint is infinite.
+   * \return If the scanpoint is infinite.
+   */
+  bool getInfiniteBit() const;
+
+  /*!
+   * \brief Returns if the scanpoint has glare.
+   * \return If the scanpoint has glare.
+   */
+  bool getGlareBit() const;
+
+  /*!
+   * \brief Returns if the scanpoint detects a reflector.
+   * \return If the scanpoint is a reflector.
+   */
+  bool getReflectorBit() const;
+
+  /*!
+   * \brief Returns if the scanpoint is contaminated.
+   * \return If the scanpoint is contaminated.
+   */
+  bool getContaminationBit() const;
+
+  /*!
+   * \brief Returns if there is a contamination warning.
+   * \return If there is a contamination warning.
+   */
+  bool getContaminationWarningBit() const;
+
+  /*!
+   * \brief Packs the status bits of a scanpoint into a status byte.
+   * \param scan_point The scanpoint.
+   * \return The status byte.
+   */
+  static uint8_t toStatusByte(const ScanPoint& scan_point);
+
+private:
+  uint16_t m_distance; // in mm
+  uint8_t m_reflectivity;
+  uint8_t m_status;
+  uint32_t m_beam_index;
+};
+
+static_assert(sizeof(CompactScanPoint) == 8, "CompactScanPoint is expected to be packed");
+
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_COMPACTSCANPOINT_H
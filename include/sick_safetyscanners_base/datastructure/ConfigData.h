@@ -59,13 +59,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -338,7 +344,7 @@ private:
   /*!
    * \brief Defined angle resolution to convert sensor input to the right frame
    */
-  const double m_ANGLE_RESOLUTION = 4194304.0;
+  static constexpr double m_ANGLE_RESOLUTION = 4194304.0;
 
   // TODO cleanup and refactor in different subclasses
 
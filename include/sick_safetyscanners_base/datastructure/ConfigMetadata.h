@@ -58,13 +58,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -188,13 +194,19 @@ public:
    *
    * \returns The integrity hash for the scanner.
    */
-  std::vector<uint32_t> getIntegrityHash() const;
+  const std::vector<uint32_t>& getIntegrityHash() const;
   /*!
    * \brief Sets the integrity hash for the scanner.
    *
    * \param integrity_hash The integrity hash for the scanner.
    */
   void setIntegrityHash(const std::vector<uint32_t>& integrity_hash);
+  /*!
+   * \brief Sets the integrity hash for the scanner.
+   *
+   * \param integrity_hash The integrity hash for the scanner.
+   */
+  void setIntegrityHash(std::vector<uint32_t>&& integrity_hash);
 
 
 private:
@@ -35,117 +35,431 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATA_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATA_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "sick_safetyscanners_base/datastructure/ApplicationData.h"
 #include "sick_safetyscanners_base/datastructure/ApplicationInputs.h"
 #include "sick_safetyscanners_base/datastructure/ApplicationOutputs.h"
+#include "sick_safetyscanners_base/datastructure/DataBlockDecoder.h"
 #include "sick_safetyscanners_base/datastructure/DataHeader.h"
 #include "sick_safetyscanners_base/datastructure/DerivedValues.h"
 #include "sick_safetyscanners_base/datastructure/GeneralSystemState.h"
 #include "sick_safetyscanners_base/datastructure/IntrusionData.h"
 #include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
 namespace sick {
 namespace datastructure {
 
 /*!
  * \brief The data class containing all data blocks of a measurement.
+ *
+ * The blocks are stored by value, so a scan is a single object. Each block carries a presence
+ * flag which is set as soon as the block has been assigned. The blocks are accessed through const
+ * references. Code which has to retain a block beyond the lifetime of the scan either copies it
+ * from the const reference getter or, if the scan is shared, uses the static get*Ptr() accessors,
+ * which alias the block inside the scan without copying it.
+ *
+ * Except for the data header and the derived values, the blocks can be left pending. A pending
+ * block is present, but only decoded from the kept sensor data on its first access. Concurrent
+ * const access to a pending block is safe.
  */
 class Data
 {
 public:
   /*!
-   * \brief Constructor of data instance.
+   * \brief The blocks which can be left pending.
+   */
+  static const uint8_t PENDING_GENERAL_SYSTEM_STATE = 1 << 0;
+  static const uint8_t PENDING_MEASUREMENT_DATA     = 1 << 1;
+  static const uint8_t PENDING_INTRUSION_DATA       = 1 << 2;
+  static const uint8_t PENDING_APPLICATION_DATA     = 1 << 3;
+  static const uint8_t PENDING_ALL_BLOCKS =
+    PENDING_GENERAL_SYSTEM_STATE | PENDING_MEASUREMENT_DATA | PENDING_INTRUSION_DATA |
+    PENDING_APPLICATION_DATA;
+
+  /*!
+   * \brief Constructor of data instance. No block is present.
    */
   Data();
 
+  /*!
+   * \brief Copies all blocks. The pending blocks of the source are locked against a concurrent
+   * decoding while being copied.
+   */
+  Data(const Data& other);
+
+  /*!
+   * \brief Moves all blocks. The pending blocks of the source are locked against a concurrent
+   * decoding while being moved, the source keeps no pending blocks afterwards.
+   */
+  Data(Data&& other);
+
+  Data& operator=(const Data& other);
+  Data& operator=(Data&& other);
+
+  /*!
+   * \brief Returns if the data header block is present.
+   *
+   * \returns If the data header block is present.
+   */
+  bool hasDataHeader() const;
   /*!
    * \brief Gets the data header.
    *
    * \returns The data header.
    */
-  std::shared_ptr<DataHeader> getDataHeaderPtr() const;
+  const DataHeader& getDataHeader() const;
+  /*!
+   * \brief Gets the data header for modification in place and marks the block as present.
+   *
+   * \returns The data header.
+   */
+  DataHeader& getMutableDataHeader();
+  /*!
+   * \brief Sets the data header.
+   *
+   * \param data_header The new data header.
+   */
+  void setDataHeader(const DataHeader& data_header);
   /*!
    * \brief Sets the data header.
    *
+   * \param data_header The new data header.
+   */
+  void setDataHeader(DataHeader&& data_header);
+
+  /*!
+   * \brief Gets the data header of a shared scan, e.g. to retain it beyond the scan callback. The
+   * returned pointer aliases the block inside the scan and keeps the whole scan alive, nothing is
+   * copied.
+   *
+   * \param data The scan holding the data header.
+   * \returns The data header, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const DataHeader> getDataHeaderPtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the data header by copying. A nullptr marks the block as not present.
+   *
    * \param data_header_ptr The new data header.
    */
   void setDataHeaderPtr(const std::shared_ptr<DataHeader>& data_header_ptr);
 
+  /*!
+   * \brief Returns if the general system state block is present.
+   *
+   * \returns If the general system state block is present.
+   */
+  bool hasGeneralSystemState() const;
   /*!
    * \brief Gets the general system state.
    *
    * \returns The general system state.
    */
-  std::shared_ptr<GeneralSystemState> getGeneralSystemStatePtr() const;
+  const GeneralSystemState& getGeneralSystemState() const;
+  /*!
+   * \brief Gets the general system state for modification in place and marks the block as present.
+   *
+   * \returns The general system state.
+   */
+  GeneralSystemState& getMutableGeneralSystemState();
+  /*!
+   * \brief Sets the general system state.
+   *
+   * \param general_system_state The new general system state.
+   */
+  void setGeneralSystemState(const GeneralSystemState& general_system_state);
+  /*!
+   * \brief Sets the general system state.
+   *
+   * \param general_system_state The new general system state.
+   */
+  void setGeneralSystemState(GeneralSystemState&& general_system_state);
+
+  /*!
+   * \brief Gets the general system state of a shared scan, e.g. to retain it beyond the scan
+   * callback. The returned pointer aliases the block inside the scan and keeps the whole scan
+   * alive, nothing is copied.
+   *
+   * \param data The scan holding the general system state.
+   * \returns The general system state, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const GeneralSystemState> getGeneralSystemStatePtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the general system state by copying. A nullptr marks the block as not present.
+   *
+   * \param general_system_state_ptr The new general system state.
+   */
   void
-    /*!
-     * \brief Sets the general system state.
-     *
-     * \param general_system_state_ptr The new general system state.
-     */
   setGeneralSystemStatePtr(const std::shared_ptr<GeneralSystemState>& general_system_state_ptr);
 
+  /*!
+   * \brief Returns if the derived values block is present.
+   *
+   * \returns If the derived values block is present.
+   */
+  bool hasDerivedValues() const;
   /*!
    * \brief Gets the derived values.
    *
    * \returns The derived values.
    */
-  std::shared_ptr<DerivedValues> getDerivedValuesPtr() const;
+  const DerivedValues& getDerivedValues() const;
+  /*!
+   * \brief Gets the derived values for modification in place and marks the block as present.
+   *
+   * \returns The derived values.
+   */
+  DerivedValues& getMutableDerivedValues();
   /*!
    * \brief Sets the derived values.
    *
+   * \param derived_values The new derived values.
+   */
+  void setDerivedValues(const DerivedValues& derived_values);
+  /*!
+   * \brief Sets the derived values.
+   *
+   * \param derived_values The new derived values.
+   */
+  void setDerivedValues(DerivedValues&& derived_values);
+
+  /*!
+   * \brief Gets the derived values of a shared scan, e.g. to retain it beyond the scan callback.
+   * The returned pointer aliases the block inside the scan and keeps the whole scan alive, nothing
+   * is copied.
+   *
+   * \param data The scan holding the derived values.
+   * \returns The derived values, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const DerivedValues> getDerivedValuesPtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the derived values by copying. A nullptr marks the block as not present.
+   *
    * \param derived_values_ptr The new derived values.
    */
   void setDerivedValuesPtr(const std::shared_ptr<DerivedValues>& derived_values_ptr);
 
+  /*!
+   * \brief Returns if the measurement data block is present.
+   *
+   * \returns If the measurement data block is present.
+   */
+  bool hasMeasurementData() const;
   /*!
    * \brief Gets the measurement data.
    *
    * \returns The measurement data.
    */
-  std::shared_ptr<MeasurementData> getMeasurementDataPtr() const;
+  const MeasurementData& getMeasurementData() const;
+  /*!
+   * \brief Gets the measurement data for modification in place and marks the block as present.
+   *
+   * \returns The measurement data.
+   */
+  MeasurementData& getMutableMeasurementData();
   /*!
    * \brief Sets the measurement data.
    *
+   * \param measurement_data The new measurement data.
+   */
+  void setMeasurementData(const MeasurementData& measurement_data);
+  /*!
+   * \brief Sets the measurement data.
+   *
+   * \param measurement_data The new measurement data.
+   */
+  void setMeasurementData(MeasurementData&& measurement_data);
+
+  /*!
+   * \brief Gets the measurement data of a shared scan, e.g. to retain it beyond the scan callback.
+   * The returned pointer aliases the block inside the scan and keeps the whole scan alive, nothing
+   * is copied.
+   *
+   * \param data The scan holding the measurement data.
+   * \returns The measurement data, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const MeasurementData> getMeasurementDataPtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the measurement data by copying. A nullptr marks the block as not present.
+   *
    * \param measurement_data_ptr The new measurement data.
    */
   void setMeasurementDataPtr(const std::shared_ptr<MeasurementData>& measurement_data_ptr);
 
+  /*!
+   * \brief Returns if the intrusion data block is present.
+   *
+   * \returns If the intrusion data block is present.
+   */
+  bool hasIntrusionData() const;
   /*!
    * \brief Gets the intrusion data.
    *
    * \returns The intrusion data.
    */
-  std::shared_ptr<IntrusionData> getIntrusionDataPtr() const;
+  const IntrusionData& getIntrusionData() const;
+  /*!
+   * \brief Gets the intrusion data for modification in place and marks the block as present.
+   *
+   * \returns The intrusion data.
+   */
+  IntrusionData& getMutableIntrusionData();
   /*!
    * \brief Sets the intrusion data.
    *
+   * \param intrusion_data The new intrusion data.
+   */
+  void setIntrusionData(const IntrusionData& intrusion_data);
+  /*!
+   * \brief Sets the intrusion data.
+   *
+   * \param intrusion_data The new intrusion data.
+   */
+  void setIntrusionData(IntrusionData&& intrusion_data);
+
+  /*!
+   * \brief Gets the intrusion data of a shared scan, e.g. to retain it beyond the scan callback.
+   * The returned pointer aliases the block inside the scan and keeps the whole scan alive, nothing
+   * is copied.
+   *
+   * \param data The scan holding the intrusion data.
+   * \returns The intrusion data, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const IntrusionData> getIntrusionDataPtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the intrusion data by copying. A nullptr marks the block as not present.
+   *
    * \param intrusion_data_ptr The new intrusion data.
    */
   void setIntrusionDataPtr(const std::shared_ptr<IntrusionData>& intrusion_data_ptr);
 
+  /*!
+   * \brief Returns if the application data block is present.
+   *
+   * \returns If the application data block is present.
+   */
+  bool hasApplicationData() const;
   /*!
    * \brief Gets the application data.
    *
    * \returns The application data.
    */
-  std::shared_ptr<ApplicationData> getApplicationDataPtr() const;
+  const ApplicationData& getApplicationData() const;
+  /*!
+   * \brief Gets the application data for modification in place and marks the block as present.
+   *
+   * \returns The application data.
+   */
+  ApplicationData& getMutableApplicationData();
   /*!
    * \brief Sets the application data.
    *
+   * \param application_data The new application data.
+   */
+  void setApplicationData(const ApplicationData& application_data);
+  /*!
+   * \brief Sets the application data.
+   *
+   * \param application_data The new application data.
+   */
+  void setApplicationData(ApplicationData&& application_data);
+
+  /*!
+   * \brief Gets the application data of a shared scan, e.g. to retain it beyond the scan callback.
+   * The returned pointer aliases the block inside the scan and keeps the whole scan alive, nothing
+   * is copied.
+   *
+   * \param data The scan holding the application data.
+   * \returns The application data, or nullptr if the block is not present.
+   */
+  static std::shared_ptr<const ApplicationData> getApplicationDataPtr(
+    const std::shared_ptr<const Data>& data);
+  /*!
+   * \brief Sets the application data by copying. A nullptr marks the block as not present.
+   *
    * \param application_data_ptr The new application data.
    */
   void setApplicationDataPtr(const std::shared_ptr<ApplicationData>& application_data_ptr);
 
+  /*!
+   * \brief Leaves the given blocks pending, so they are decoded on their first access. The data
+   * header and the derived values have to be set already. Blocks which are not left pending are
+   * not touched.
+   *
+   * \param buffer The reassembled sensor data, it is moved in and kept until all pending blocks are
+   * decoded or dropped. If any block is left pending, it is exchanged for the cleared buffer of the
+   * previous scan, whose fragment list can be recycled without allocating.
+   * \param decoder The decoder of the pending blocks.
+   * \param blocks The blocks to leave pending as PENDING_* flags.
+   */
+  void setPendingBlocks(PacketBuffer&& buffer,
+                        const std::shared_ptr<const DataBlockDecoder>& decoder,
+                        uint8_t blocks = PENDING_ALL_BLOCKS);
+
+  /*!
+   * \brief Returns if any block is not decoded yet.
+   *
+   * \returns If any block is pending.
+   */
+  bool hasPendingBlocks() const;
+
+  /*!
+   * \brief Decodes all pending blocks and releases the kept sensor data.
+   */
+  void decodePendingBlocks() const;
+
+  /*!
+   * \brief Drops all pending blocks without decoding them. They are not present afterwards.
+   */
+  void clearPendingBlocks();
+
 private:
-  std::shared_ptr<DataHeader> m_data_header_ptr;
-  std::shared_ptr<GeneralSystemState> m_general_system_state_ptr;
-  std::shared_ptr<DerivedValues> m_derived_values_ptr;
-  std::shared_ptr<MeasurementData> m_measurement_data_ptr;
-  std::shared_ptr<IntrusionData> m_intrusion_data_ptr;
-  std::shared_ptr<ApplicationData> m_application_data_ptr;
+  DataHeader m_data_header;
+  mutable GeneralSystemState m_general_system_state;
+  DerivedValues m_derived_values;
+  mutable MeasurementData m_measurement_data;
+  mutable IntrusionData m_intrusion_data;
+  mutable ApplicationData m_application_data;
+
+  bool m_has_data_header;
+  bool m_has_general_system_state;
+  bool m_has_derived_values;
+  bool m_has_measurement_data;
+  bool m_has_intrusion_data;
+  bool m_has_application_data;
+
+
+  /*!
+   * \brief The sensor data and decoder of the pending blocks. The mutex serializes decoding, it
+   * is neither copied nor moved along with the other members. Copying and moving does not lock, the
+   * data holds the mutex of the source for all of its blocks.
+   */
+  struct PendingBlocks
+  {
+    PendingBlocks();
+    PendingBlocks(const PendingBlocks& other);
+    PendingBlocks(PendingBlocks&& other);
+    PendingBlocks& operator=(const PendingBlocks& other);
+    PendingBlocks& operator=(PendingBlocks&& other);
+
+    PacketBuffer buffer;
+    std::shared_ptr<const DataBlockDecoder> decoder;
+    std::atomic<uint8_t> mask;
+    mutable std::mutex mutex;
+  };
+
+  mutable PendingBlocks m_pending_blocks;
+
+  void decodePendingBlock(uint8_t block) const;
+  void dropPendingBlock(uint8_t block);
 };
 
 } // namespace datastructure
@@ -0,0 +1,108 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataBlockDecoder.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATABLOCKDECODER_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATABLOCKDECODER_H
+
+#include "sick_safetyscanners_base/datastructure/ApplicationData.h"
+#include "sick_safetyscanners_base/datastructure/GeneralSystemState.h"
+#include "sick_safetyscanners_base/datastructure/IntrusionData.h"
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+namespace sick {
+namespace datastructure {
+
+class Data;
+
+/*!
+ * \brief Interface to decode the blocks of a data object on their first access.
+ *
+ * The data header and the derived values are always decoded in advance, the decoder can rely on
+ * them being present in the passed data object. Implementations have to be thread safe, since
+ * blocks of different data objects might be decoded concurrently.
+ */
+class DataBlockDecoder
+{
+public:
+  virtual ~DataBlockDecoder() {}
+
+  /*!
+   * \brief Decodes the general system state.
+   *
+   * \param buffer The reassembled sensor data.
+   * \param data The data object providing the data header.
+   * \param general_system_state The general system state to overwrite.
+   */
+  virtual void decodeGeneralSystemState(const PacketBuffer& buffer,
+                                        const Data& data,
+                                        GeneralSystemState& general_system_state) const = 0;
+
+  /*!
+   * \brief Decodes the measurement data.
+   *
+   * \param buffer The reassembled sensor data.
+   * \param data The data object providing the data header and the derived values.
+   * \param measurement_data The measurement data to overwrite.
+   */
+  virtual void decodeMeasurementData(const PacketBuffer& buffer,
+                                     const Data& data,
+                                     MeasurementData& measurement_data) const = 0;
+
+  /*!
+   * \brief Decodes the intrusion data.
+   *
+   * \param buffer The reassembled sensor data.
+   * \param data The data object providing the data header and the derived values.
+   * \param intrusion_data The intrusion data to overwrite.
+   */
+  virtual void decodeIntrusionData(const PacketBuffer& buffer,
+                                   const Data& data,
+                                   IntrusionData& intrusion_data) const = 0;
+
+  /*!
+   * \brief Decodes the application data.
+   *
+   * \param buffer The reassembled sensor data.
+   * \param data The data object providing the data header.
+   * \param application_data The application data to overwrite.
+   */
+  virtual void decodeApplicationData(const PacketBuffer& buffer,
+                                     const Data& data,
+                                     ApplicationData& application_data) const = 0;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATABLOCKDECODER_H
@@ -0,0 +1,133 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file DataPool.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "sick_safetyscanners_base/datastructure/Data.h"
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief A pool of recycled Data objects.
+ *
+ * An object is returned to the pool explicitly, under the lock of the pool, once the consumer
+ * dropped the last reference to it, so the storage of its blocks (e.g. the scan points) keeps its
+ * capacity across scans. As in the PacketBufferPool, the reference count of an object lives in
+ * storage reserved next to it and no heap allocations are required once the pool is warmed up. The
+ * pool grows on demand up to a maximum number of objects, beyond that acquire() fails until
+ * objects are released. Objects can be acquired and released from any thread, and they may
+ * outlive the pool.
+ */
+class DataPool
+{
+public:
+  /*!
+   * \brief Constructor of the DataPool.
+   *
+   * \param num_objects Number of Data objects to preallocate.
+   * \param max_num_objects Maximum number of Data objects the pool grows to if all objects are in
+   * use.
+   */
+  DataPool(std::size_t num_objects, std::size_t max_num_objects);
+
+  DataPool(const DataPool&) = delete;
+  DataPool& operator=(const DataPool&) = delete;
+
+  /*!
+   * \brief Returns a Data object which is not referenced outside the pool. If all objects are in
+   * use, the pool grows by one object unless the maximum number of objects is reached.
+   *
+   * \return The acquired Data object, which is returned to the pool when all references are
+   * dropped. Its content is the one of a previous scan. An empty pointer if all objects are in use
+   * and the pool cannot grow any further.
+   */
+  std::shared_ptr<Data> acquire();
+
+  /*!
+   * \brief Returns the total number of Data objects owned by the pool.
+   * \return Number of Data objects.
+   */
+  std::size_t getNumObjects() const;
+
+  /*!
+   * \brief Returns the number of Data objects which are currently not referenced outside the pool.
+   * \return Number of available Data objects.
+   */
+  std::size_t getNumAvailableObjects() const;
+
+  /*!
+   * \brief Returns the maximum number of Data objects the pool grows to.
+   * \return Maximum number of Data objects.
+   */
+  std::size_t getMaxNumObjects() const;
+
+  /*!
+   * \brief Size of the storage reserved for the reference count of each Data object.
+   */
+  static const std::size_t CONTROL_BLOCK_SIZE = 64;
+
+private:
+  /*!
+   * \brief A Data object together with the storage of its reference count.
+   */
+  struct Entry
+  {
+    Data data;
+    std::aligned_storage<CONTROL_BLOCK_SIZE>::type control_block;
+  };
+
+  /*!
+   * \brief The objects and the free list, shared with all handed out objects.
+   */
+  struct Storage
+  {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::vector<Entry*> free_entries;
+  };
+
+  std::shared_ptr<Storage> m_storage;
+  std::size_t m_max_num_objects;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_DATAPOOL_H
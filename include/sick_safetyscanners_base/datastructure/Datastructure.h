@@ -1,11 +1,16 @@
+#include "AngleTable.h"
 #include "ApplicationData.h"
 #include "ApplicationInputs.h"
 #include "ApplicationName.h"
 #include "ApplicationOutputs.h"
+#include "BeamBitset.h"
 #include "CommSettings.h"
+#include "CompactScanPoint.h"
 #include "ConfigData.h"
 #include "ConfigMetadata.h"
 #include "Data.h"
+#include "DataBlockDecoder.h"
+#include "DataPool.h"
 #include "DataHeader.h"
 #include "DatagramHeader.h"
 #include "DerivedValues.h"
@@ -14,6 +19,7 @@
 #include "FieldData.h"
 #include "FieldSets.h"
 #include "FirmwareVersion.h"
+#include "FlagWord.h"
 #include "GeneralSystemState.h"
 #include "IntrusionData.h"
 #include "IntrusionDatum.h"
@@ -26,6 +32,7 @@
 #include "ProjectName.h"
 #include "RequiredUserAction.h"
 #include "ScanPoint.h"
+#include "SensorConfiguration.h"
 #include "SerialNumber.h"
 #include "StatusOverview.h"
 #include "TypeCode.h"
@@ -143,7 +143,7 @@ private:
   /*!
    * \brief Defined angle resolution to convert sensor input to the right frame
    */
-  const double m_ANGLE_RESOLUTION = 4194304.0;
+  static constexpr double m_ANGLE_RESOLUTION = 4194304.0;
 
   bool m_is_empty;
 
@@ -57,13 +57,19 @@ public:
    *
    * \returns The device name for the scanner.
    */
-  std::string getDeviceName() const;
+  const std::string& getDeviceName() const;
   /*!
    * \brief Sets the device name for the scanner.
    *
    * \param device_name The device name for the scanner.
    */
   void setDeviceName(const std::string& device_name);
+  /*!
+   * \brief Sets the device name for the scanner.
+   *
+   * \param device_name The device name for the scanner.
+   */
+  void setDeviceName(std::string&& device_name);
 
 private:
   std::string m_device_name;
@@ -72,13 +72,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -207,13 +213,19 @@ public:
    *
    * \returns The current field name.
    */
-  std::string getFieldName() const;
+  const std::string& getFieldName() const;
   /*!
    * \brief Sets the field name.
    *
    * \param field_name The field name.
    */
   void setFieldName(const std::string& field_name);
+  /*!
+   * \brief Sets the field name.
+   *
+   * \param field_name The field name.
+   */
+  void setFieldName(std::string&& field_name);
 
   /*!
    * \brief Returns if a field is warning field.
@@ -248,7 +260,7 @@ public:
    *
    * \returns Vector with beam distances.
    */
-  std::vector<uint16_t> getBeamDistances() const;
+  const std::vector<uint16_t>& getBeamDistances() const;
 
   /*!
    * \brief Sets vector with beam distances for field.
@@ -256,6 +268,12 @@ public:
    * \param beam_distances New beam distances for field.
    */
   void setBeamDistances(const std::vector<uint16_t>& beam_distances);
+  /*!
+   * \brief Sets vector with beam distances for field.
+   *
+   * \param beam_distances New beam distances for field.
+   */
+  void setBeamDistances(std::vector<uint16_t>&& beam_distances);
 
   /*!
    * \brief Get the start angle of the scan.
@@ -315,7 +333,7 @@ private:
   /*!
    * \brief Defined angle resolution to convert sensor input to the right frame
    */
-  const double m_ANGLE_RESOLUTION = 4194304.0;
+  static constexpr double m_ANGLE_RESOLUTION = 4194304.0;
 
   std::string m_version_c_version;
   uint8_t m_version_major_version_number;
@@ -57,13 +57,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -108,38 +114,56 @@ public:
    *
    * \returns The length of the field name.
    */
-  std::vector<uint32_t> getNameLength() const;
+  const std::vector<uint32_t>& getNameLength() const;
   /*!
    * \brief Sets the length of the field name.
    *
    * \param name_length The length of the field name.
    */
   void setNameLength(const std::vector<uint32_t>& name_length);
+  /*!
+   * \brief Sets the length of the field name.
+   *
+   * \param name_length The length of the field name.
+   */
+  void setNameLength(std::vector<uint32_t>&& name_length);
   /*!
    * \brief Gets the field name for the scanner.
    *
    * \returns The field name for the scanner.
    */
-  std::vector<std::string> getFieldName() const;
+  const std::vector<std::string>& getFieldName() const;
   /*!
    * \brief Sets the field name for the scanner.
    *
    * \param field_name The field name for the scanner.
    */
   void setFieldName(const std::vector<std::string>& field_name);
+  /*!
+   * \brief Sets the field name for the scanner.
+   *
+   * \param field_name The field name for the scanner.
+   */
+  void setFieldName(std::vector<std::string>&& field_name);
 
   /*!
    * \brief Gets if the fields are defined.
    *
    * \returns if the fields are defined.
    */
-  std::vector<bool> getIsDefined() const;
+  const std::vector<bool>& getIsDefined() const;
   /*!
    * \brief Sets if the fields are defined.
    *
    * \param is_defined if the fields are defined.
    */
   void setIsDefined(const std::vector<bool>& is_defined);
+  /*!
+   * \brief Sets if the fields are defined.
+   *
+   * \param is_defined if the fields are defined.
+   */
+  void setIsDefined(std::vector<bool>&& is_defined);
 
 private:
   std::string m_version_c_version;
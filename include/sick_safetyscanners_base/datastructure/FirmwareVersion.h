@@ -57,13 +57,19 @@ public:
    *
    * \returns The firmware version for the scanner.
    */
-  std::string getFirmwareVersion() const;
+  const std::string& getFirmwareVersion() const;
   /*!
    * \brief Sets the firmware version for the scanner.
    *
    * \param max_distance The firmware version for the scanner.
    */
   void setFirmwareVersion(const std::string& firmware_version);
+  /*!
+   * \brief Sets the firmware version for the scanner.
+   *
+   * \param max_distance The firmware version for the scanner.
+   */
+  void setFirmwareVersion(std::string&& firmware_version);
 
 private:
   std::string m_firmware_version;
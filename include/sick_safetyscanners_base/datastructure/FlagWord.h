@@ -0,0 +1,201 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file FlagWord.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_FLAGWORD_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_FLAGWORD_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief A fixed number of flags kept in the integer word they are transmitted in.
+ *
+ * Flag i is stored in bit i of the word. Bits beyond the number of flags are always cleared.
+ *
+ * \tparam WordT Unsigned integer type of the word.
+ * \tparam NumFlags Number of flags used in the word.
+ */
+template <typename WordT, std::size_t NumFlags>
+class FlagWord
+{
+public:
+  typedef WordT Word;
+
+  /*!
+   * \brief Number of flags in the word.
+   */
+  static constexpr std::size_t NUM_FLAGS = NumFlags;
+
+  /*!
+   * \brief Mask of the bits used by the flags.
+   */
+  static constexpr WordT MASK =
+    NumFlags >= sizeof(WordT) * 8
+      ? static_cast<WordT>(~static_cast<WordT>(0))
+      : static_cast<WordT>((static_cast<WordT>(1) << (NumFlags % (sizeof(WordT) * 8))) - 1);
+
+  /*!
+   * \brief Constructor with all flags cleared.
+   */
+  constexpr FlagWord()
+    : m_word(0)
+  {
+  }
+
+  /*!
+   * \brief Constructor from a word as transmitted. Unused bits are cleared.
+   *
+   * \param word The word.
+   */
+  constexpr explicit FlagWord(WordT word)
+    : m_word(word & MASK)
+  {
+  }
+
+  /*!
+   * \brief Returns the word containing the flags.
+   * \return The word.
+   */
+  constexpr WordT getWord() const
+  {
+    return m_word;
+  }
+
+  /*!
+   * \brief Returns the value of a single flag.
+   * \param index Index of the flag, has to be less than NUM_FLAGS.
+   * \return The value of the flag.
+   */
+  constexpr bool getFlag(std::size_t index) const
+  {
+    return ((m_word >> index) & 1) != 0;
+  }
+
+  /*!
+   * \brief Returns if any flag is set.
+   * \return If any flag is set.
+   */
+  constexpr bool isAnySet() const
+  {
+    return m_word != 0;
+  }
+
+  /*!
+   * \brief Returns if any of the flags in the mask is set.
+   * \param mask Mask of the flags to check.
+   * \return If any flag of the mask is set.
+   */
+  constexpr bool isAnySet(WordT mask) const
+  {
+    return (m_word & mask) != 0;
+  }
+
+  /*!
+   * \brief Returns if all of the flags in the mask are set.
+   * \param mask Mask of the flags to check.
+   * \return If all flags of the mask are set.
+   */
+  constexpr bool areAllSet(WordT mask) const
+  {
+    return (m_word & mask) == (mask & MASK);
+  }
+
+  /*!
+   * \brief Returns the number of set flags.
+   * \return The number of set flags.
+   */
+  std::size_t countSetFlags() const
+  {
+    std::size_t count = 0;
+    for (WordT word = m_word; word != 0; word &= static_cast<WordT>(word - 1))
+    {
+      ++count;
+    }
+    return count;
+  }
+
+  /*!
+   * \brief Expands the flags into a vector.
+   * \return Vector containing NUM_FLAGS bools.
+   */
+  std::vector<bool> toVector() const
+  {
+    std::vector<bool> flags_vector(NumFlags);
+    for (std::size_t i = 0; i < NumFlags; ++i)
+    {
+      flags_vector[i] = getFlag(i);
+    }
+    return flags_vector;
+  }
+
+  /*!
+   * \brief Packs a vector of flags. Flags beyond NUM_FLAGS are ignored.
+   * \param flags_vector The flags.
+   * \return The packed flags.
+   */
+  static FlagWord fromVector(const std::vector<bool>& flags_vector)
+  {
+    WordT word = 0;
+    for (std::size_t i = 0; i < flags_vector.size() && i < NumFlags; ++i)
+    {
+      word |= static_cast<WordT>(static_cast<WordT>(flags_vector[i]) << i);
+    }
+    return FlagWord(word);
+  }
+
+  constexpr bool operator==(const FlagWord& other) const
+  {
+    return m_word == other.m_word;
+  }
+  constexpr bool operator!=(const FlagWord& other) const
+  {
+    return m_word != other.m_word;
+  }
+
+private:
+  WordT m_word;
+};
+
+template <typename WordT, std::size_t NumFlags>
+constexpr std::size_t FlagWord<WordT, NumFlags>::NUM_FLAGS;
+
+template <typename WordT, std::size_t NumFlags>
+constexpr WordT FlagWord<WordT, NumFlags>::MASK;
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_FLAGWORD_H
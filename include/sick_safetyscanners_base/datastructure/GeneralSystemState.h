@@ -38,6 +38,8 @@
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/datastructure/FlagWord.h"
+
 namespace sick {
 namespace datastructure {
 
@@ -49,6 +51,11 @@ namespace datastructure {
 class GeneralSystemState
 {
 public:
+  /*!
+   * \brief Flags of the 20 cut-off paths.
+   */
+  typedef FlagWord<uint32_t, 20> CutOffPathWord;
+
   /*!
    * \brief Constructor of GeneralSystemState, creates empty instance.
    */
@@ -137,6 +144,19 @@ public:
    */
   void setSafeCutOffPathvector(const std::vector<bool>& safe_cut_off_path_vector);
 
+  /*!
+   * \brief Gets the safe cut-off path states as transmitted.
+   *
+   * \returns The safe cut-off path states, one bit per flag.
+   */
+  CutOffPathWord getSafeCutOffPath() const;
+  /*!
+   * \brief Sets the safe cut-off path states.
+   *
+   * \param safe_cut_off_path The safe cut-off path states, one bit per flag.
+   */
+  void setSafeCutOffPath(const CutOffPathWord& safe_cut_off_path);
+
   /*!
    * \brief Returns the state of all non-safe cut-off paths.
    * \return  Vector containing the state of all non-safe cut-off paths
@@ -149,6 +169,19 @@ public:
    */
   void setNonSafeCutOffPathVector(const std::vector<bool>& non_safe_cut_off_path_vector);
 
+  /*!
+   * \brief Gets the non-safe cut-off path states as transmitted.
+   *
+   * \returns The non-safe cut-off path states, one bit per flag.
+   */
+  CutOffPathWord getNonSafeCutOffPath() const;
+  /*!
+   * \brief Sets the non-safe cut-off path states.
+   *
+   * \param non_safe_cut_off_path The non-safe cut-off path states, one bit per flag.
+   */
+  void setNonSafeCutOffPath(const CutOffPathWord& non_safe_cut_off_path);
+
   /*!
    * \brief Returns if a cut-off path has to be reset.
    * \return Vector if a cut-off path has to be reset.
@@ -162,6 +195,19 @@ public:
   void
   setResetRequiredCutOffPathVector(const std::vector<bool>& reset_required_cut_off_path_vector);
 
+  /*!
+   * \brief Gets the reset required cut-off path states as transmitted.
+   *
+   * \returns The reset required cut-off path states, one bit per flag.
+   */
+  CutOffPathWord getResetRequiredCutOffPath() const;
+  /*!
+   * \brief Sets the reset required cut-off path states.
+   *
+   * \param reset_required_cut_off_path The reset required cut-off path states, one bit per flag.
+   */
+  void setResetRequiredCutOffPath(const CutOffPathWord& reset_required_cut_off_path);
+
   /*!
    * \brief Returns the current monitor case table 1.
    * \return The current monitoring case table 1.
@@ -256,9 +302,9 @@ private:
   bool m_reference_contour_status;
   bool m_manipulation_status;
 
-  std::vector<bool> m_safe_cut_off_path_vector;
-  std::vector<bool> m_non_safe_cut_off_path_vector;
-  std::vector<bool> m_reset_required_cut_off_path_vector;
+  CutOffPathWord m_safe_cut_off_path;
+  CutOffPathWord m_non_safe_cut_off_path;
+  CutOffPathWord m_reset_required_cut_off_path;
 
   uint8_t m_current_monitoring_case_no_table_1;
   uint8_t m_current_monitoring_case_no_table_2;
@@ -57,13 +57,25 @@ public:
    * \brief Getter for all IntrusionDatums.
    * \return Vector of IntrusionDatum.
    */
-  std::vector<IntrusionDatum> getIntrusionDataVector() const;
+  const std::vector<IntrusionDatum>& getIntrusionDataVector() const;
 
   /*!
    * \brief Setter for the vector of IntrusionDatums.
    * \param intrusion_data_vector Vector of IntrusionDatums.
    */
   void setIntrusionDataVector(const std::vector<IntrusionDatum>& intrusion_data_vector);
+  /*!
+   * \brief Setter for the vector of IntrusionDatums.
+   * \param intrusion_data_vector Vector of IntrusionDatums.
+   */
+  void setIntrusionDataVector(std::vector<IntrusionDatum>&& intrusion_data_vector);
+
+  /*!
+   * \brief Mutable access to the IntrusionDatums for decoding them in place. The datums keep the
+   * capacity of their flags across scans.
+   * \return Vector of IntrusionDatum.
+   */
+  std::vector<IntrusionDatum>& getMutableIntrusionDataVector();
 
   /*!
    * \brief Return if intrusion data has been enabled.
@@ -35,9 +35,12 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_INTRUSIONDATUM_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_INTRUSIONDATUM_H
 
+#include <cstddef>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/datastructure/BeamBitset.h"
+
 namespace sick {
 namespace datastructure {
 
@@ -65,7 +68,33 @@ public:
   void setSize(const int32_t& size);
 
   /*!
-   * \brief Getter for the flags vector.
+   * \brief Getter for the packed flags, one flag per beam.
+   * \return The flags.
+   */
+  const BeamBitset& getFlags() const;
+
+  /*!
+   * \brief Setter for the packed flags.
+   * \param flags The flags.
+   */
+  void setFlags(const BeamBitset& flags);
+
+  /*!
+   * \brief Setter for the packed flags.
+   * \param flags The flags.
+   */
+  void setFlags(BeamBitset&& flags);
+
+  /*!
+   * \brief Setter for the flags as packed in the telegram, least significant bit first.
+   * \param bytes Pointer to the packed flags.
+   * \param num_bytes Number of bytes available at bytes.
+   * \param num_flags Number of flags to take over.
+   */
+  void setFlags(const uint8_t* bytes, std::size_t num_bytes, std::size_t num_flags);
+
+  /*!
+   * \brief Getter for the flags vector. The flags are expanded from the packed representation.
    * \return Boolean vector of all flags
    */
   std::vector<bool> getFlagsVector() const;
@@ -78,7 +107,7 @@ public:
 
 private:
   int32_t m_size;
-  std::vector<bool> m_flags_vector;
+  BeamBitset m_flags;
 };
 
 } // namespace datastructure
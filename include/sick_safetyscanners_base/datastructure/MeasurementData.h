@@ -35,9 +35,13 @@
 #ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_MEASUREMENTDATA_H
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_MEASUREMENTDATA_H
 
+#include <cstddef>
+#include <memory>
 #include <stdint.h>
 #include <vector>
 
+#include "sick_safetyscanners_base/datastructure/AngleTable.h"
+#include "sick_safetyscanners_base/datastructure/CompactScanPoint.h"
 #include "sick_safetyscanners_base/datastructure/ScanPoint.h"
 
 namespace sick {
@@ -45,10 +49,27 @@ namespace datastructure {
 
 /*!
  * \brief Class containing all scanpoints of a single measurement.
+ *
+ * The scanpoints are stored column-wise: distances, reflectivities, status bytes and angles are
+ * kept in separate contiguous vectors which can be accessed without copying. The angle column is
+ * either owned or provided by an AngleTable shared with other scans of the same configuration.
+ * The ScanPoint based interface is kept for compatibility and assembles the scanpoints from the
+ * columns.
  */
 class MeasurementData
 {
 public:
+  /*!
+   * \brief Bits of the status byte of a scanpoint as transmitted by the sensor.
+   */
+  static const uint8_t STATUS_VALID_BIT         = CompactScanPoint::STATUS_VALID_BIT;
+  static const uint8_t STATUS_INFINITE_BIT      = CompactScanPoint::STATUS_INFINITE_BIT;
+  static const uint8_t STATUS_GLARE_BIT         = CompactScanPoint::STATUS_GLARE_BIT;
+  static const uint8_t STATUS_REFLECTOR_BIT     = CompactScanPoint::STATUS_REFLECTOR_BIT;
+  static const uint8_t STATUS_CONTAMINATION_BIT = CompactScanPoint::STATUS_CONTAMINATION_BIT;
+  static const uint8_t STATUS_CONTAMINATION_WARNING_BIT =
+    CompactScanPoint::STATUS_CONTAMINATION_WARNING_BIT;
+
   /*!
    * \brief Constructor of an empty measurement.
    */
@@ -67,17 +88,123 @@ public:
   void setNumberOfBeams(const uint32_t& number_of_beams);
 
   /*!
-   * \brief Getter for all contained scanpoints.
+   * \brief Getter for the number of contained scanpoints.
+   * \return Number of scanpoints, which is the length of each column.
+   */
+  std::size_t getNumberOfScanPoints() const;
+
+  /*!
+   * \brief Getter for the distances of all scanpoints.
+   * \return Contiguous column of distances in [mm].
+   */
+  const std::vector<uint16_t>& getDistancesVector() const;
+
+  /*!
+   * \brief Getter for the reflectivities of all scanpoints.
+   * \return Contiguous column of reflectivities.
+   */
+  const std::vector<uint8_t>& getReflectivitiesVector() const;
+
+  /*!
+   * \brief Getter for the status bytes of all scanpoints. The bits are defined by the STATUS_*
+   * constants.
+   * \return Contiguous column of status bytes.
+   */
+  const std::vector<uint8_t>& getStatusBytesVector() const;
+
+  /*!
+   * \brief Getter for the angles of all scanpoints.
+   * \return Contiguous column of angles in [deg].
+   */
+  const std::vector<float>& getAnglesVector() const;
+
+  /*!
+   * \brief Getter for the angle table providing the angle column.
+   * \return The angle table including the sine and cosine of each angle, nullptr if the angle
+   * column is owned by this object.
+   */
+  const std::shared_ptr<const AngleTable>& getAngleTablePtr() const;
+
+  /*!
+   * \brief Lets the angle column be provided by an angle table. The table has to contain as many
+   * beams as there are scanpoints.
+   * \param angle_table_ptr The angle table.
+   */
+  void setAngleTablePtr(const std::shared_ptr<const AngleTable>& angle_table_ptr);
+
+  /*!
+   * \brief Assembles a single scanpoint from the columns.
+   * \param index Index of the scanpoint, has to be less than getNumberOfScanPoints().
+   * \return The scanpoint.
+   */
+  ScanPoint getScanPoint(std::size_t index) const;
+
+  /*!
+   * \brief Getter for all contained scanpoints. The scanpoints are assembled from the columns, use
+   * the column getters to avoid the copy.
    * \return Vector of scanpoints.
    */
   std::vector<ScanPoint> getScanPointsVector() const;
 
+  /*!
+   * \brief Packs a single scanpoint. Its angle is given by the angle table of the measurement.
+   * \param index Index of the scanpoint, has to be less than getNumberOfScanPoints().
+   * \return The packed scanpoint, whose beam index is the index of the scanpoint.
+   */
+  CompactScanPoint getCompactScanPoint(std::size_t index) const;
+
+  /*!
+   * \brief Getter for all contained scanpoints in packed form.
+   * \return Vector of packed scanpoints.
+   */
+  std::vector<CompactScanPoint> getCompactScanPointsVector() const;
+
   /*!
    * \brief Add a single scanpoint to the vector of scanpoints.
    * \param scan_point New scanpoint to add.
    */
   void addScanPoint(ScanPoint scan_point);
 
+  /*!
+   * \brief Add a single scanpoint given by its column values.
+   * \param angle Angle of the scanpoint in [deg].
+   * \param distance Distance of the scanpoint in [mm].
+   * \param reflectivity Reflectivity of the scanpoint.
+   * \param status Status byte of the scanpoint.
+   */
+  void addScanPoint(float angle, uint16_t distance, uint8_t reflectivity, uint8_t status);
+
+  /*!
+   * \brief Resizes all columns. Added scanpoints are zero initialized and are meant to be
+   * overwritten through the mutable column pointers. The angle column is left untouched while it is
+   * provided by an angle table.
+   * \param number_of_scan_points New number of scanpoints.
+   */
+  void resizeScanPoints(std::size_t number_of_scan_points);
+
+  /*!
+   * \brief Mutable access to the columns for decoding scanpoints in bulk. The pointers are
+   * invalidated when the number of scanpoints changes. Accessing the angles copies them out of the
+   * angle table, if one is set.
+   * \return Pointer to the first element of the respective column.
+   */
+  uint16_t* getMutableDistances();
+  uint8_t* getMutableReflectivities();
+  uint8_t* getMutableStatusBytes();
+  float* getMutableAngles();
+
+  /*!
+   * \brief Reserves storage in all columns.
+   * \param number_of_scan_points Number of scanpoints to reserve storage for.
+   */
+  void reserveScanPoints(std::size_t number_of_scan_points);
+
+  /*!
+   * \brief Removes all scanpoints and the angle table. The storage keeps its capacity for
+   * subsequent scans.
+   */
+  void clearScanPoints();
+
   /*!
    * \brief Returns if measurement data has been enabled.
    * \return If measurement data has been enabled.
@@ -94,7 +221,13 @@ private:
   bool m_is_empty;
 
   uint32_t m_number_of_beams;
-  std::vector<ScanPoint> m_scan_points_vector;
+  std::vector<uint16_t> m_distances;
+  std::vector<uint8_t> m_reflectivities;
+  std::vector<uint8_t> m_status_bytes;
+  std::vector<float> m_angles;
+  std::shared_ptr<const AngleTable> m_angle_table_ptr;
+
+  void detachAngleTable();
 };
 
 } // namespace datastructure
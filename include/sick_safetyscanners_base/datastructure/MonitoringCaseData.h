@@ -87,7 +87,7 @@ public:
    *
    * \returns The field indices.
    */
-  std::vector<uint16_t> getFieldIndices() const;
+  const std::vector<uint16_t>& getFieldIndices() const;
 
   /*!
    * \brief Sets the field indices.
@@ -95,13 +95,19 @@ public:
    * \param field_indices The field indices.
    */
   void setFieldIndices(const std::vector<uint16_t>& field_indices);
+  /*!
+   * \brief Sets the field indices.
+   *
+   * \param field_indices The field indices.
+   */
+  void setFieldIndices(std::vector<uint16_t>&& field_indices);
 
   /*!
    * \brief Returns if the fields are configured and valid.
    *
    * \returns If the fields are valid.
    */
-  std::vector<bool> getFieldsValid() const;
+  const std::vector<bool>& getFieldsValid() const;
 
   /*!
    * \brief Sets if the fields are valid.
@@ -109,6 +115,12 @@ public:
    * \param fields_valid if the fields are valid.
    */
   void setFieldsValid(const std::vector<bool>& fields_valid);
+  /*!
+   * \brief Sets if the fields are valid.
+   *
+   * \param fields_valid if the fields are valid.
+   */
+  void setFieldsValid(std::vector<bool>&& fields_valid);
 
 private:
   bool m_is_valid;
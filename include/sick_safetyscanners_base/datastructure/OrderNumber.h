@@ -57,13 +57,19 @@ public:
    *
    * \returns The order number for the scanner.
    */
-  std::string getOrderNumber() const;
+  const std::string& getOrderNumber() const;
   /*!
    * \brief Sets the order number for the scanner.
    *
    * \param order_number The order number for the scanner.
    */
   void setOrderNumber(const std::string& order_number);
+  /*!
+   * \brief Sets the order number for the scanner.
+   *
+   * \param order_number The order number for the scanner.
+   */
+  void setOrderNumber(std::string&& order_number);
 
 private:
   std::string m_order_number;
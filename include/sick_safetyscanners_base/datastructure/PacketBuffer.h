@@ -36,6 +36,7 @@
 #define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETBUFFER_H
 
 #include <iostream>
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -66,6 +67,37 @@ public:
    */
   typedef boost::array<uint8_t, MAXSIZE> ArrayBuffer;
 
+  /*!
+   * \brief A part of a fragmented PacketBuffer referencing a range of a received datagram.
+   */
+  struct Fragment
+  {
+    /*!
+     * \brief The received datagram.
+     */
+    std::shared_ptr<std::vector<uint8_t> const> buffer;
+
+    /*!
+     * \brief Start of the fragment within the received datagram.
+     */
+    size_t offset;
+
+    /*!
+     * \brief Length of the fragment.
+     */
+    size_t length;
+
+    /*!
+     * \brief Start of the fragment within the PacketBuffer.
+     */
+    size_t position;
+  };
+
+  /*!
+   * \brief Typedef for the fragments of a fragmented PacketBuffer.
+   */
+  typedef std::vector<Fragment> FragmentVector;
+
   /*!
    * \brief Constructor of PacketBuffer.
    */
@@ -87,6 +119,27 @@ public:
    */
   PacketBuffer(const ArrayBuffer& buffer, const size_t& length);
 
+  /*!
+   * \brief Constructor of PacketBuffer referencing a receive slot without copying.
+   * \param slot Receive slot, e.g. acquired from a PacketBufferPool. It is not resized, so it keeps
+   * its capacity for the next datagram.
+   * \param length Number of valid bytes at the start of the slot.
+   */
+  PacketBuffer(const std::shared_ptr<std::vector<uint8_t>>& slot, const size_t& length);
+
+  /*!
+   * \brief Constructor of a fragmented PacketBuffer. The data is not concatenated but stays in the
+   * received datagrams.
+   * \param fragments Fragments sorted by their position and covering the PacketBuffer without gaps.
+   */
+  explicit PacketBuffer(const FragmentVector& fragments);
+
+  /*!
+   * \brief Constructor of a fragmented PacketBuffer which takes over the given fragments.
+   * \param fragments Fragments sorted by their position and covering the PacketBuffer without gaps.
+   */
+  explicit PacketBuffer(FragmentVector&& fragments);
+
   /*!
    * \brief Returns defined maximum size of PacketBuffer.
    * \return Maximum size of PacketBuffer.
@@ -95,16 +148,61 @@ public:
 
   /*!
    * \brief Getter to return a copy of the data saved in the PacketBuffer.
+   *
+   * A fragmented PacketBuffer is concatenated on every call. Prefer to read it through a
+   * PacketBufferCursor, which only copies data straddling fragment boundaries.
+   *
+   * A PacketBuffer referencing a receive slot is copied if the slot is larger than the data. Prefer
+   * getStorage() in that case.
+   *
    * \return Data copy as shared_ptr<vector const>.  Needed because this bufer could be overwritten.
    */
   std::shared_ptr<std::vector<uint8_t> const> getBuffer() const;
 
+  /*!
+   * \brief Returns the storage of a contiguous PacketBuffer without copying. The storage may be
+   * larger than the data, only the first getLength() bytes are valid.
+   *
+   * \return The storage, empty if the PacketBuffer is fragmented.
+   */
+  std::shared_ptr<std::vector<uint8_t> const> getStorage() const;
+
+  /*!
+   * \brief Indicates whether the PacketBuffer consists of several fragments.
+   * \return True if the data is fragmented.
+   */
+  bool isFragmented() const;
+
+  /*!
+   * \brief Returns the fragments of a fragmented PacketBuffer.
+   * \return The fragments, empty if the PacketBuffer is contiguous.
+   */
+  const FragmentVector& getFragments() const;
+
+  /*!
+   * \brief Hands over the fragments of a fragmented PacketBuffer, which is empty afterwards.
+   * \return The fragments, empty if the PacketBuffer is contiguous.
+   */
+  FragmentVector releaseFragments();
+
+  /*!
+   * \brief Releases the data and the fragments. The fragment list keeps its capacity, so it can be
+   * recycled like the one of a released PacketBuffer.
+   */
+  void clear();
+
   /*!
    * \brief Setter for the PacketBuffer.
    * \param buffer Input VectorBuffer to save.
    */
   void setBuffer(const std::vector<uint8_t>& buffer);
 
+  /*!
+   * \brief Setter for the PacketBuffer taking over the storage of the given vector.
+   * \param buffer Input VectorBuffer to save.
+   */
+  void setBuffer(std::vector<uint8_t>&& buffer);
+
   /*!
    * \brief Setter for the PacketBuffer.
    * \param buffer Input ArrayBuffer to save.
@@ -121,6 +219,8 @@ public:
 
 private:
   std::shared_ptr<std::vector<uint8_t> const> m_buffer;
+  size_t m_length;
+  FragmentVector m_fragments;
 };
 
 } // namespace datastructure
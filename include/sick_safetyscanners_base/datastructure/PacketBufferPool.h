@@ -0,0 +1,152 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PacketBufferPool.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETBUFFERPOOL_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETBUFFERPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <type_traits>
+#include <vector>
+
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief A preallocated pool of receive slots for raw sensor datagrams.
+ *
+ * The socket receives directly into a slot, which is then handed out wrapped in a PacketBuffer
+ * without copying. A slot is returned to the pool explicitly, under the lock of the pool, once the
+ * last reference to it is dropped. The reference count of a slot lives in storage reserved next to
+ * the slot, so no heap allocations are required once the pool is warmed up. Slots keep their full
+ * size, the number of valid bytes is tracked by the PacketBuffer. The pool grows on demand up to
+ * a maximum number of slots, beyond that acquire() fails until slots are released. Slots can be
+ * acquired and released from any thread, and they may outlive the pool.
+ */
+class PacketBufferPool
+{
+public:
+  /*!
+   * \brief Typedef for a single receive slot of the pool.
+   */
+  typedef std::shared_ptr<std::vector<uint8_t>> Slot;
+
+  /*!
+   * \brief Constructor of the PacketBufferPool.
+   *
+   * \param num_slots Number of slots to preallocate.
+   * \param max_num_slots Maximum number of slots the pool grows to if all slots are in use.
+   * \param slot_size Size of each slot in bytes.
+   */
+  PacketBufferPool(std::size_t num_slots,
+                   std::size_t max_num_slots,
+                   std::size_t slot_size = MAXSIZE);
+
+  PacketBufferPool(const PacketBufferPool&) = delete;
+  PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+
+  /*!
+   * \brief Returns a free slot of the slot size. If all slots are in use, the pool grows by one
+   * slot unless the maximum number of slots is reached.
+   *
+   * \return The acquired slot, which is returned to the pool when all references are dropped. An
+   * empty pointer if all slots are in use and the pool cannot grow any further.
+   */
+  Slot acquire();
+
+  /*!
+   * \brief Returns the total number of slots owned by the pool.
+   * \return Number of slots.
+   */
+  std::size_t getNumSlots() const;
+
+  /*!
+   * \brief Returns the number of slots which are currently not referenced outside the pool.
+   * \return Number of available slots.
+   */
+  std::size_t getNumAvailableSlots() const;
+
+  /*!
+   * \brief Returns the maximum number of slots the pool grows to.
+   * \return Maximum number of slots.
+   */
+  std::size_t getMaxNumSlots() const;
+
+  /*!
+   * \brief Returns the size of each slot in bytes.
+   * \return Slot size.
+   */
+  std::size_t getSlotSize() const;
+
+  /*!
+   * \brief Size of the storage reserved for the reference count of each slot.
+   */
+  static const std::size_t CONTROL_BLOCK_SIZE = 64;
+
+private:
+  /*!
+   * \brief A slot together with the storage of its reference count.
+   */
+  struct Entry
+  {
+    explicit Entry(std::size_t slot_size)
+      : buffer(slot_size)
+    {
+    }
+
+    std::vector<uint8_t> buffer;
+    std::aligned_storage<CONTROL_BLOCK_SIZE>::type control_block;
+  };
+
+  /*!
+   * \brief The slots and the free list, shared with all handed out slots.
+   */
+  struct Storage
+  {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Entry>> entries;
+    std::vector<Entry*> free_entries;
+  };
+
+  std::shared_ptr<Storage> m_storage;
+  std::size_t m_max_num_slots;
+  std::size_t m_slot_size;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_PACKETBUFFERPOOL_H
@@ -0,0 +1,121 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PoolControlBlockAllocator.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_POOLCONTROLBLOCKALLOCATOR_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_POOLCONTROLBLOCKALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Places the reference count of a pooled object in the storage reserved in its entry, used
+ * by the DataPool and the PacketBufferPool. Deallocating the reference count is the last access to
+ * the entry once all references are dropped, so this is where the entry is returned to the free
+ * list. The mutex orders all reads of the consumer before the entry is handed out again.
+ *
+ * StorageT has to provide a mutex and a free list free_entries of EntryT pointers with enough
+ * capacity for all entries, EntryT the storage control_block for the reference count.
+ */
+template <typename T, typename StorageT, typename EntryT>
+class PoolControlBlockAllocator
+{
+public:
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind
+  {
+    typedef PoolControlBlockAllocator<U, StorageT, EntryT> other;
+  };
+
+  PoolControlBlockAllocator(std::shared_ptr<StorageT> storage, EntryT* entry)
+    : m_storage(std::move(storage))
+    , m_entry(entry)
+  {
+  }
+
+  template <typename U>
+  PoolControlBlockAllocator(const PoolControlBlockAllocator<U, StorageT, EntryT>& other)
+    : m_storage(other.m_storage)
+    , m_entry(other.m_entry)
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    static_assert(sizeof(T) <= sizeof(m_entry->control_block),
+                  "Reference count does not fit into its storage");
+    static_assert(alignof(T) <= alignof(decltype(m_entry->control_block)),
+                  "Reference count is not sufficiently aligned");
+    if (n != 1)
+    {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(static_cast<void*>(&m_entry->control_block));
+  }
+
+  void deallocate(T*, std::size_t)
+  {
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+    m_storage->free_entries.push_back(m_entry);
+  }
+
+  template <typename U>
+  bool operator==(const PoolControlBlockAllocator<U, StorageT, EntryT>& other) const
+  {
+    return m_entry == other.m_entry;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolControlBlockAllocator<U, StorageT, EntryT>& other) const
+  {
+    return m_entry != other.m_entry;
+  }
+
+private:
+  template <typename U, typename OtherStorageT, typename OtherEntryT>
+  friend class PoolControlBlockAllocator;
+
+  std::shared_ptr<StorageT> m_storage;
+  EntryT* m_entry;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_POOLCONTROLBLOCKALLOCATOR_H
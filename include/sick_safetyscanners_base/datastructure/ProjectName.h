@@ -57,13 +57,19 @@ public:
    *
    * \returns The project name for the scanner.
    */
-  std::string getProjectName() const;
+  const std::string& getProjectName() const;
   /*!
    * \brief Sets the project name for the scanner.
    *
    * \param project_name The project name for the scanner.
    */
   void setProjectName(const std::string& project_name);
+  /*!
+   * \brief Sets the project name for the scanner.
+   *
+   * \param project_name The project name for the scanner.
+   */
+  void setProjectName(std::string&& project_name);
 
 private:
   std::string m_project_name;
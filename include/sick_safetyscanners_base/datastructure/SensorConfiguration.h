@@ -0,0 +1,311 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file SensorConfiguration.h
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORCONFIGURATION_H
+#define SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORCONFIGURATION_H
+
+#include "sick_safetyscanners_base/datastructure/ConfigData.h"
+#include "sick_safetyscanners_base/datastructure/ConfigMetadata.h"
+#include "sick_safetyscanners_base/datastructure/DeviceName.h"
+#include "sick_safetyscanners_base/datastructure/FieldData.h"
+#include "sick_safetyscanners_base/datastructure/FieldSets.h"
+#include "sick_safetyscanners_base/datastructure/FirmwareVersion.h"
+#include "sick_safetyscanners_base/datastructure/MonitoringCaseData.h"
+#include "sick_safetyscanners_base/datastructure/OrderNumber.h"
+#include "sick_safetyscanners_base/datastructure/ProjectName.h"
+#include "sick_safetyscanners_base/datastructure/SerialNumber.h"
+#include "sick_safetyscanners_base/datastructure/TypeCode.h"
+
+#include <vector>
+
+namespace sick {
+namespace datastructure {
+
+/*!
+ * \brief Class bundling the configuration of a laser scanner which only changes when the scanner
+ * is commissioned, as it is loaded in bulk from the sensor.
+ */
+class SensorConfiguration
+{
+public:
+  /*!
+   * \brief Constructor of the sensor configuration.
+   */
+  SensorConfiguration();
+
+  /*!
+   * \brief Gets the serial number of the scanner.
+   *
+   * \returns The serial number of the scanner.
+   */
+  const SerialNumber& getSerialNumber() const;
+  /*!
+   * \brief Sets the serial number of the scanner.
+   *
+   * \param serial_number The serial number of the scanner.
+   */
+  void setSerialNumber(const SerialNumber& serial_number);
+  /*!
+   * \brief Sets the serial number of the scanner.
+   *
+   * \param serial_number The serial number of the scanner.
+   */
+  void setSerialNumber(SerialNumber&& serial_number);
+
+  /*!
+   * \brief Gets the type code of the scanner.
+   *
+   * \returns The type code of the scanner.
+   */
+  const TypeCode& getTypeCode() const;
+  /*!
+   * \brief Sets the type code of the scanner.
+   *
+   * \param type_code The type code of the scanner.
+   */
+  void setTypeCode(const TypeCode& type_code);
+  /*!
+   * \brief Sets the type code of the scanner.
+   *
+   * \param type_code The type code of the scanner.
+   */
+  void setTypeCode(TypeCode&& type_code);
+
+  /*!
+   * \brief Gets the firmware version of the scanner.
+   *
+   * \returns The firmware version of the scanner.
+   */
+  const FirmwareVersion& getFirmwareVersion() const;
+  /*!
+   * \brief Sets the firmware version of the scanner.
+   *
+   * \param firmware_version The firmware version of the scanner.
+   */
+  void setFirmwareVersion(const FirmwareVersion& firmware_version);
+  /*!
+   * \brief Sets the firmware version of the scanner.
+   *
+   * \param firmware_version The firmware version of the scanner.
+   */
+  void setFirmwareVersion(FirmwareVersion&& firmware_version);
+
+  /*!
+   * \brief Gets the order number of the scanner.
+   *
+   * \returns The order number of the scanner.
+   */
+  const OrderNumber& getOrderNumber() const;
+  /*!
+   * \brief Sets the order number of the scanner.
+   *
+   * \param order_number The order number of the scanner.
+   */
+  void setOrderNumber(const OrderNumber& order_number);
+  /*!
+   * \brief Sets the order number of the scanner.
+   *
+   * \param order_number The order number of the scanner.
+   */
+  void setOrderNumber(OrderNumber&& order_number);
+
+  /*!
+   * \brief Gets the device name of the scanner.
+   *
+   * \returns The device name of the scanner.
+   */
+  const DeviceName& getDeviceName() const;
+  /*!
+   * \brief Sets the device name of the scanner.
+   *
+   * \param device_name The device name of the scanner.
+   */
+  void setDeviceName(const DeviceName& device_name);
+  /*!
+   * \brief Sets the device name of the scanner.
+   *
+   * \param device_name The device name of the scanner.
+   */
+  void setDeviceName(DeviceName&& device_name);
+
+  /*!
+   * \brief Gets the project name of the scanner.
+   *
+   * \returns The project name of the scanner.
+   */
+  const ProjectName& getProjectName() const;
+  /*!
+   * \brief Sets the project name of the scanner.
+   *
+   * \param project_name The project name of the scanner.
+   */
+  void setProjectName(const ProjectName& project_name);
+  /*!
+   * \brief Sets the project name of the scanner.
+   *
+   * \param project_name The project name of the scanner.
+   */
+  void setProjectName(ProjectName&& project_name);
+
+  /*!
+   * \brief Gets the config metadata of the scanner.
+   *
+   * \returns The config metadata of the scanner.
+   */
+  const ConfigMetadata& getConfigMetadata() const;
+  /*!
+   * \brief Sets the config metadata of the scanner.
+   *
+   * \param config_metadata The config metadata of the scanner.
+   */
+  void setConfigMetadata(const ConfigMetadata& config_metadata);
+  /*!
+   * \brief Sets the config metadata of the scanner.
+   *
+   * \param config_metadata The config metadata of the scanner.
+   */
+  void setConfigMetadata(ConfigMetadata&& config_metadata);
+
+  /*!
+   * \brief Gets the field sets of the scanner.
+   *
+   * \returns The field sets of the scanner.
+   */
+  const FieldSets& getFieldSets() const;
+  /*!
+   * \brief Sets the field sets of the scanner.
+   *
+   * \param field_sets The field sets of the scanner.
+   */
+  void setFieldSets(const FieldSets& field_sets);
+  /*!
+   * \brief Sets the field sets of the scanner.
+   *
+   * \param field_sets The field sets of the scanner.
+   */
+  void setFieldSets(FieldSets&& field_sets);
+
+  /*!
+   * \brief Gets the current measurement configuration of the scanner.
+   *
+   * \returns The current measurement configuration of the scanner.
+   */
+  const ConfigData& getCurrentConfig() const;
+  /*!
+   * \brief Sets the current measurement configuration of the scanner.
+   *
+   * \param current_config The current measurement configuration of the scanner.
+   */
+  void setCurrentConfig(const ConfigData& current_config);
+  /*!
+   * \brief Sets the current measurement configuration of the scanner.
+   *
+   * \param current_config The current measurement configuration of the scanner.
+   */
+  void setCurrentConfig(ConfigData&& current_config);
+
+  /*!
+   * \brief Gets the persistent configuration of the scanner.
+   *
+   * \returns The persistent configuration of the scanner.
+   */
+  const ConfigData& getPersistentConfig() const;
+  /*!
+   * \brief Sets the persistent configuration of the scanner.
+   *
+   * \param persistent_config The persistent configuration of the scanner.
+   */
+  void setPersistentConfig(const ConfigData& persistent_config);
+  /*!
+   * \brief Sets the persistent configuration of the scanner.
+   *
+   * \param persistent_config The persistent configuration of the scanner.
+   */
+  void setPersistentConfig(ConfigData&& persistent_config);
+
+  /*!
+   * \brief Gets the protective and warning fields of the scanner.
+   *
+   * \returns The protective and warning fields of the scanner.
+   */
+  const std::vector<FieldData>& getFieldData() const;
+  /*!
+   * \brief Sets the protective and warning fields of the scanner.
+   *
+   * \param field_data The protective and warning fields of the scanner.
+   */
+  void setFieldData(const std::vector<FieldData>& field_data);
+  /*!
+   * \brief Sets the protective and warning fields of the scanner.
+   *
+   * \param field_data The protective and warning fields of the scanner.
+   */
+  void setFieldData(std::vector<FieldData>&& field_data);
+
+  /*!
+   * \brief Gets the monitoring cases of the scanner.
+   *
+   * \returns The monitoring cases of the scanner.
+   */
+  const std::vector<MonitoringCaseData>& getMonitoringCases() const;
+  /*!
+   * \brief Sets the monitoring cases of the scanner.
+   *
+   * \param monitoring_cases The monitoring cases of the scanner.
+   */
+  void setMonitoringCases(const std::vector<MonitoringCaseData>& monitoring_cases);
+  /*!
+   * \brief Sets the monitoring cases of the scanner.
+   *
+   * \param monitoring_cases The monitoring cases of the scanner.
+   */
+  void setMonitoringCases(std::vector<MonitoringCaseData>&& monitoring_cases);
+
+private:
+  SerialNumber m_serial_number;
+  TypeCode m_type_code;
+  FirmwareVersion m_firmware_version;
+  OrderNumber m_order_number;
+  DeviceName m_device_name;
+  ProjectName m_project_name;
+  ConfigMetadata m_config_metadata;
+  FieldSets m_field_sets;
+  ConfigData m_current_config;
+  ConfigData m_persistent_config;
+  std::vector<FieldData> m_field_data;
+  std::vector<MonitoringCaseData> m_monitoring_cases;
+};
+
+} // namespace datastructure
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_DATASTRUCTURE_SENSORCONFIGURATION_H
@@ -57,13 +57,19 @@ public:
    *
    * \returns The serial number for the scanner.
    */
-  std::string getSerialNumber() const;
+  const std::string& getSerialNumber() const;
   /*!
    * \brief Sets the serial number for the scanner.
    *
    * \param serial_number The serial number for the scanner.
    */
   void setSerialNumber(const std::string& serial_number);
+  /*!
+   * \brief Sets the serial number for the scanner.
+   *
+   * \param serial_number The serial number for the scanner.
+   */
+  void setSerialNumber(std::string&& serial_number);
 
 private:
   std::string m_serial_number;
@@ -70,13 +70,19 @@ public:
    *
    * \returns The type code for the scanner.
    */
-  std::string getTypeCode() const;
+  const std::string& getTypeCode() const;
   /*!
    * \brief Sets the type code for the scanner.
    *
    * \param type_code The type code for the scanner.
    */
   void setTypeCode(const std::string& type_code);
+  /*!
+   * \brief Sets the type code for the scanner.
+   *
+   * \param type_code The type code for the scanner.
+   */
+  void setTypeCode(std::string&& type_code);
   /*!
    * \brief Gets the interface type for the scanner.
    *
@@ -57,13 +57,19 @@ public:
    *
    * \returns The version indicator for the scanner.
    */
-  std::string getVersionCVersion() const;
+  const std::string& getVersionCVersion() const;
   /*!
    * \brief Sets the version indicator for the scanner.
    *
    * \param version_c_version The version indicator for the scanner.
    */
   void setVersionCVersion(const std::string& version_c_version);
+  /*!
+   * \brief Sets the version indicator for the scanner.
+   *
+   * \param version_c_version The version indicator for the scanner.
+   */
+  void setVersionCVersion(std::string&& version_c_version);
 
   /*!
    * \brief Gets the major version number for the scanner.
@@ -120,13 +126,19 @@ public:
    *
    * \returns The user name for the scanner.
    */
-  std::string getUserName() const;
+  const std::string& getUserName() const;
   /*!
    * \brief Sets the user name for the scanner.
    *
    * \param user_name The user name for the scanner.
    */
   void setUserName(const std::string& user_name);
+  /*!
+   * \brief Sets the user name for the scanner.
+   *
+   * \param user_name The user name for the scanner.
+   */
+  void setUserName(std::string&& user_name);
 
 private:
   std::string m_version_c_version;
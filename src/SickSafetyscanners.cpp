@@ -35,24 +35,45 @@
 //----------------------------------------------------------------------
 
 #include "sick_safetyscanners_base/SickSafetyscanners.h"
+#include "sick_safetyscanners_base/Exceptions.h"
 #include "sick_safetyscanners_base/cola2/Cola2.h"
+#include <algorithm>
 #include <chrono>
 #include <utility>
 
 namespace sick {
 
+namespace {
+
+/*!
+ * \brief Returns the channel index if it addresses one of the four channels, channel 0 otherwise.
+ */
+int8_t checkChannelIndex(int8_t channel_index)
+{
+  if (channel_index < 0 || channel_index > 3)
+  {
+    LOG_WARN("Index is out of bounds, returning default channel 0");
+    return 0;
+  }
+  return channel_index;
+}
+
+} // namespace
+
 SickSafetyscannersBase::SickSafetyscannersBase(sick::types::ip_address_t sensor_ip,
                                                sick::types::port_t sensor_tcp_port,
                                                CommSettings comm_settings)
   : m_sensor_ip(sensor_ip)
   , m_sensor_tcp_port(sensor_tcp_port)
   , m_comm_settings(comm_settings)
+  , m_lazy_decoding(false)
   , m_io_service_ptr(sick::make_unique<boost::asio::io_service>())
   , m_io_service(*m_io_service_ptr)
   , m_udp_client(m_io_service, comm_settings.host_udp_port)
   , m_session(
       std::move(sick::make_unique<sick::communication::TCPClient>(m_sensor_ip, sensor_tcp_port)))
   , m_packet_merger()
+  , m_data_parser()
 {
   changeSensorSettings(comm_settings);
 }
@@ -64,12 +85,14 @@ SickSafetyscannersBase::SickSafetyscannersBase(sick::types::ip_address_t sensor_
   : m_sensor_ip(sensor_ip)
   , m_sensor_tcp_port(sensor_tcp_port)
   , m_comm_settings(comm_settings)
+  , m_lazy_decoding(false)
   , m_io_service_ptr(nullptr)
   , m_io_service(io_service)
   , m_udp_client(m_io_service, comm_settings.host_udp_port)
   , m_session(
       std::move(sick::make_unique<sick::communication::TCPClient>(m_sensor_ip, sensor_tcp_port)))
   , m_packet_merger()
+  , m_data_parser()
 {
   changeSensorSettings(comm_settings);
 }
@@ -101,46 +124,96 @@ void SickSafetyscannersBase::requestApplicationName(
 }
 void SickSafetyscannersBase::requestFieldData(std::vector<sick::datastructure::FieldData>& fields)
 {
-  sick::datastructure::ConfigData config_data;
-  createAndExecuteCommand<sick::cola2::MeasurementCurrentConfigVariableCommand>(m_session,
-                                                                                config_data);
+  sick::datastructure::SensorConfiguration configuration;
+  loadConfiguration(configuration, sick::cola2::ConfigurationLoader::FIELDS);
+  fields.insert(
+    fields.end(), configuration.getFieldData().begin(), configuration.getFieldData().end());
+}
 
-  for (int i = 0; i < 128; i++)
-  {
-    sick::datastructure::FieldData field_data;
-    createAndExecuteCommand<sick::cola2::FieldHeaderVariableCommand>(m_session, field_data, i);
+void SickSafetyscannersBase::requestFieldSets(sick::datastructure::FieldSets& field_sets)
+{
+  createAndExecuteCommand<sick::cola2::FieldSetsVariableCommand>(m_session, field_sets);
+}
 
-    if (field_data.getIsValid())
-    {
-      createAndExecuteCommand<sick::cola2::FieldGeometryVariableCommand>(m_session, field_data, i);
-      field_data.setStartAngleDegrees(config_data.getDerivedStartAngle());
-      field_data.setAngularBeamResolutionDegrees(config_data.getDerivedAngularBeamResolution());
-      fields.push_back(field_data);
-    }
-    else if (i > 0) // index 0 is reserved for contour data
-    {
-      break; // skip other requests after first invalid
-    }
+void SickSafetyscannersBase::setReassemblyLimits(
+  const sick::data_processing::ReassemblyLimits& limits)
+{
+  m_packet_merger.setLimits(limits);
+}
+
+sick::data_processing::ReassemblyStatistics SickSafetyscannersBase::getReassemblyStatistics() const
+{
+  return m_packet_merger.getStatistics();
+}
+
+void SickSafetyscannersBase::setLazyDecoding(bool lazy_decoding)
+{
+  m_lazy_decoding = lazy_decoding;
+}
+
+void SickSafetyscannersBase::setParseMask(sick::types::SensorFeatures parse_mask)
+{
+  m_data_parser.setParseMask(parse_mask);
+}
+
+sick::types::SensorFeatures SickSafetyscannersBase::getParseMask() const
+{
+  return m_data_parser.getParseMask();
+}
+
+void SickSafetyscannersBase::setSessionReuse(bool session_reuse)
+{
+  m_session.setSessionReuse(session_reuse);
+}
+
+void SickSafetyscannersBase::setSessionIdleTimeout(sick::types::time_duration_t idle_timeout)
+{
+  m_session.setIdleTimeout(idle_timeout);
+}
+
+void SickSafetyscannersBase::parseData(sick::datastructure::PacketBuffer& buffer,
+                                       sick::datastructure::Data& data)
+{
+  if (m_lazy_decoding)
+  {
+    m_data_parser.parseUDPSequenceLazily(std::move(buffer), data);
+  }
+  else
+  {
+    m_data_parser.parseUDPSequence(buffer, data);
   }
 }
 
 void SickSafetyscannersBase::requestMonitoringCases(
   std::vector<sick::datastructure::MonitoringCaseData>& monitoring_cases)
 {
-  for (int i = 0; i < 254; i++)
-  {
-    sick::datastructure::MonitoringCaseData monitoring_case_data;
-    createAndExecuteCommand<sick::cola2::MonitoringCaseVariableCommand>(
-      m_session, monitoring_case_data, i);
-    if (monitoring_case_data.getIsValid())
-    {
-      monitoring_cases.push_back(monitoring_case_data);
-    }
-    else
-    {
-      break; // skip other requests after first invalid
-    }
-  }
+  sick::datastructure::SensorConfiguration configuration;
+  loadConfiguration(configuration, sick::cola2::ConfigurationLoader::MONITORING_CASES);
+  monitoring_cases.insert(monitoring_cases.end(),
+                          configuration.getMonitoringCases().begin(),
+                          configuration.getMonitoringCases().end());
+}
+
+sick::cola2::ConfigurationLoaderStatistics SickSafetyscannersBase::requestSensorConfiguration(
+  sick::datastructure::SensorConfiguration& configuration)
+{
+  return loadConfiguration(configuration, sick::cola2::ConfigurationLoader::ALL);
+}
+
+sick::cola2::ConfigurationLoaderStatistics SickSafetyscannersBase::loadConfiguration(
+  sick::datastructure::SensorConfiguration& configuration,
+  sick::cola2::ConfigurationLoader::Content content)
+{
+  sick::cola2::ConfigurationLoader loader(m_session);
+  loader.setCache(m_configuration_cache);
+  loader.load(configuration, content);
+  return loader.getStatistics();
+}
+
+void SickSafetyscannersBase::setConfigurationCache(
+  std::shared_ptr<sick::cola2::ConfigurationCache> cache)
+{
+  m_configuration_cache = std::move(cache);
 }
 
 void SickSafetyscannersBase::requestDeviceName(
@@ -183,6 +256,13 @@ void SickSafetyscannersBase::requestFirmwareVersion(
 
 void SickSafetyscannersBase::requestPersistentConfig(sick::datastructure::ConfigData& config_data)
 {
+  if (m_configuration_cache)
+  {
+    sick::datastructure::SensorConfiguration configuration;
+    requestSensorConfiguration(configuration);
+    config_data = configuration.getPersistentConfig();
+    return;
+  }
   createAndExecuteCommand<cola2::MeasurementPersistentConfigVariableCommand>(m_session,
                                                                              config_data);
 }
@@ -207,13 +287,8 @@ void SickSafetyscannersBase::requestDeviceStatus(sick::datastructure::DeviceStat
 void SickSafetyscannersBase::requestLatestTelegram(sick::datastructure::Data& data,
                                                    int8_t channel_index)
 {
-  if (channel_index < 0 || channel_index > 3)
-  {
-    LOG_WARN("Index is out of bounds, returning default channel 0");
-    channel_index = 0;
-  }
   createAndExecuteCommand<sick::cola2::LatestTelegramVariableCommand>(
-    m_session, data, channel_index);
+    m_session, data, checkChannelIndex(channel_index));
 }
 
 void SickSafetyscannersBase::requestRequiredUserAction(
@@ -223,13 +298,45 @@ void SickSafetyscannersBase::requestRequiredUserAction(
                                                                           required_user_action);
 }
 
+const long AsyncSickSafetyScanner::CLOSE_SESSION_TIMEOUT_MS;
+
 AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
                                                sick::types::port_t sensor_tcp_port,
                                                CommSettings comm_settings,
                                                sick::types::ScanDataCb callback)
+  : AsyncSickSafetyScanner(sensor_ip,
+                           sensor_tcp_port,
+                           comm_settings,
+                           [callback](const std::shared_ptr<const Data>& data) { callback(*data); })
+{
+}
+
+AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                                               sick::types::port_t sensor_tcp_port,
+                                               CommSettings comm_settings,
+                                               sick::types::ScanDataCb callback,
+                                               boost::asio::io_service& io_service)
+  : AsyncSickSafetyScanner(sensor_ip,
+                           sensor_tcp_port,
+                           comm_settings,
+                           [callback](const std::shared_ptr<const Data>& data) { callback(*data); },
+                           io_service)
+{
+}
+
+AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                                               sick::types::port_t sensor_tcp_port,
+                                               CommSettings comm_settings,
+                                               sick::types::ScanDataPtrCb callback)
   : SickSafetyscannersBase(sensor_ip, sensor_tcp_port, comm_settings)
   , m_scan_data_cb(callback)
+  , m_data_pool(DATA_POOL_SIZE, DATA_POOL_MAX_SIZE)
+  , m_num_dropped_scans(0)
   , m_work(sick::make_unique<boost::asio::io_service::work>(m_io_service))
+  , m_async_session(
+      std::make_shared<sick::cola2::AsyncCola2Session>(m_io_service, sensor_ip, sensor_tcp_port))
+  , m_eviction_timer(m_io_service)
+  , m_is_running(false)
 {
   m_service_thread = boost::thread([this] {
     try
@@ -246,16 +353,51 @@ AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_
 AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
                                                sick::types::port_t sensor_tcp_port,
                                                CommSettings comm_settings,
-                                               sick::types::ScanDataCb callback,
+                                               sick::types::ScanDataPtrCb callback,
                                                boost::asio::io_service& io_service)
   : SickSafetyscannersBase(sensor_ip, sensor_tcp_port, comm_settings, io_service)
   , m_scan_data_cb(callback)
+  , m_data_pool(DATA_POOL_SIZE, DATA_POOL_MAX_SIZE)
+  , m_num_dropped_scans(0)
   , m_work()
+  , m_async_session(
+      std::make_shared<sick::cola2::AsyncCola2Session>(m_io_service, sensor_ip, sensor_tcp_port))
+  , m_eviction_timer(m_io_service)
+  , m_is_running(false)
+{
+}
+
+AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                                               sick::types::port_t sensor_tcp_port,
+                                               CommSettings comm_settings,
+                                               sick::types::ScanDataViewCb callback)
+  : AsyncSickSafetyScanner(sensor_ip, sensor_tcp_port, comm_settings, sick::types::ScanDataPtrCb())
 {
+  m_scan_data_view_cb = callback;
+}
+
+AsyncSickSafetyScanner::AsyncSickSafetyScanner(sick::types::ip_address_t sensor_ip,
+                                               sick::types::port_t sensor_tcp_port,
+                                               CommSettings comm_settings,
+                                               sick::types::ScanDataViewCb callback,
+                                               boost::asio::io_service& io_service)
+  : AsyncSickSafetyScanner(
+      sensor_ip, sensor_tcp_port, comm_settings, sick::types::ScanDataPtrCb(), io_service)
+{
+  m_scan_data_view_cb = callback;
 }
 
 AsyncSickSafetyScanner::~AsyncSickSafetyScanner()
 {
+  {
+    std::lock_guard<std::mutex> lock(m_eviction_mutex);
+    m_is_running = false;
+    m_eviction_timer.cancel();
+  }
+  // Let the strand send the request closing the session before the io_service is stopped. The wait
+  // is bounded, as the io_service may not be run anymore.
+  std::future<void> closed = m_async_session->close();
+  closed.wait_for(std::chrono::milliseconds(CLOSE_SESSION_TIMEOUT_MS));
   m_io_service.stop();
   m_work.reset();
   if (m_service_thread.joinable())
@@ -269,24 +411,303 @@ void AsyncSickSafetyScanner::processUDPPacket(const sick::datastructure::PacketB
   if (m_packet_merger.addUDPPacket(buffer))
   {
     sick::datastructure::PacketBuffer deployed_buffer = m_packet_merger.getDeployedPacketBuffer();
-    sick::data_processing::ParseData data_parser;
-    sick::datastructure::Data data = data_parser.parseUDPSequence(deployed_buffer);
+    if (m_scan_data_view_cb)
+    {
+      sick::data_processing::DataView view(deployed_buffer);
+      view.setAngleTablePtr(getAngleTable(view));
+      m_scan_data_view_cb(view);
+      m_packet_merger.releasePacketBuffer(std::move(deployed_buffer));
+      return;
+    }
+    std::shared_ptr<sick::datastructure::Data> data = m_data_pool.acquire();
+    if (!data)
+    {
+      ++m_num_dropped_scans;
+      m_packet_merger.releasePacketBuffer(std::move(deployed_buffer));
+      return;
+    }
+    parseData(deployed_buffer, *data);
+    // Pending blocks take over the data packet, the buffer left behind recycles the fragment list.
+    m_packet_merger.releasePacketBuffer(std::move(deployed_buffer));
 
     m_scan_data_cb(data);
   }
 }
 
+const std::shared_ptr<const sick::datastructure::AngleTable>&
+AsyncSickSafetyScanner::getAngleTable(const sick::data_processing::DataView& view)
+{
+  if (!view.hasMeasurementData())
+  {
+    return m_angle_table_ptr;
+  }
+  sick::data_processing::DerivedValuesView derived_values = view.getDerivedValues();
+  float start_angle        = derived_values.getStartAngle();
+  float resolution         = derived_values.getAngularBeamResolution();
+  uint32_t number_of_beams = view.getMeasurementData().getNumberOfBeams();
+  if (!m_angle_table_ptr || !m_angle_table_ptr->matches(start_angle, resolution, number_of_beams))
+  {
+    m_angle_table_ptr =
+      std::make_shared<sick::datastructure::AngleTable>(start_angle, resolution, number_of_beams);
+  }
+  return m_angle_table_ptr;
+}
+
 void AsyncSickSafetyScanner::run()
 {
-  sick::types::PacketHandler callback = [this](const sick::datastructure::PacketBuffer& buffer) {
-    processUDPPacket(buffer);
-  };
-  m_udp_client.run(std::move(callback));
+  sick::types::PacketBatchHandler callback =
+    [this](const std::vector<sick::datastructure::PacketBuffer>& buffers) {
+      for (const auto& buffer : buffers)
+      {
+        processUDPPacket(buffer);
+      }
+    };
+  m_udp_client.runBatched(std::move(callback));
+
+  {
+    std::lock_guard<std::mutex> lock(m_eviction_mutex);
+    m_is_running = true;
+  }
+  scheduleEviction();
 }
 
 void AsyncSickSafetyScanner::stop()
 {
   m_udp_client.stop();
+
+  std::lock_guard<std::mutex> lock(m_eviction_mutex);
+  m_is_running = false;
+  m_eviction_timer.cancel();
+}
+
+void AsyncSickSafetyScanner::scheduleEviction()
+{
+  std::lock_guard<std::mutex> lock(m_eviction_mutex);
+  if (!m_is_running)
+  {
+    return;
+  }
+  const std::chrono::milliseconds period =
+    std::max(m_packet_merger.getLimits().max_age, std::chrono::milliseconds(1));
+  m_eviction_timer.expires_from_now(boost::posix_time::milliseconds(period.count()));
+  m_eviction_timer.async_wait([this](const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted)
+    {
+      return;
+    }
+    m_packet_merger.evictExpired();
+    scheduleEviction();
+  });
+}
+
+sick::communication::UDPClientStatistics AsyncSickSafetyScanner::getReceiveStatistics() const
+{
+  return m_udp_client.getStatistics();
+}
+
+uint64_t AsyncSickSafetyScanner::getNumDroppedScans() const
+{
+  return m_num_dropped_scans;
+}
+
+void AsyncSickSafetyScanner::requestConfigMetadataAsync(
+  sick::types::AsyncResultCb<sick::datastructure::ConfigMetadata> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::ConfigMetadataVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::ConfigMetadata>
+AsyncSickSafetyScanner::requestConfigMetadataAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::ConfigMetadataVariableCommand,
+                                      sick::datastructure::ConfigMetadata>();
+}
+
+void AsyncSickSafetyScanner::requestStatusOverviewAsync(
+  sick::types::AsyncResultCb<sick::datastructure::StatusOverview> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::StatusOverviewVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::StatusOverview>
+AsyncSickSafetyScanner::requestStatusOverviewAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::StatusOverviewVariableCommand,
+                                      sick::datastructure::StatusOverview>();
+}
+
+void AsyncSickSafetyScanner::requestDeviceStatusAsync(
+  sick::types::AsyncResultCb<sick::datastructure::DeviceStatus> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::DeviceStatusVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::DeviceStatus> AsyncSickSafetyScanner::requestDeviceStatusAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::DeviceStatusVariableCommand,
+                                      sick::datastructure::DeviceStatus>();
+}
+
+void AsyncSickSafetyScanner::requestRequiredUserActionAsync(
+  sick::types::AsyncResultCb<sick::datastructure::RequiredUserAction> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::RequiredUserActionVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::RequiredUserAction>
+AsyncSickSafetyScanner::requestRequiredUserActionAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::RequiredUserActionVariableCommand,
+                                      sick::datastructure::RequiredUserAction>();
+}
+
+void AsyncSickSafetyScanner::requestSerialNumberAsync(
+  sick::types::AsyncResultCb<sick::datastructure::SerialNumber> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::SerialNumberVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::SerialNumber> AsyncSickSafetyScanner::requestSerialNumberAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::SerialNumberVariableCommand,
+                                      sick::datastructure::SerialNumber>();
+}
+
+void AsyncSickSafetyScanner::requestTypeCodeAsync(
+  sick::types::AsyncResultCb<sick::datastructure::TypeCode> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::TypeCodeVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::TypeCode> AsyncSickSafetyScanner::requestTypeCodeAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::TypeCodeVariableCommand,
+                                      sick::datastructure::TypeCode>();
+}
+
+void AsyncSickSafetyScanner::requestFirmwareVersionAsync(
+  sick::types::AsyncResultCb<sick::datastructure::FirmwareVersion> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::FirmwareVersionVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::FirmwareVersion>
+AsyncSickSafetyScanner::requestFirmwareVersionAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::FirmwareVersionVariableCommand,
+                                      sick::datastructure::FirmwareVersion>();
+}
+
+void AsyncSickSafetyScanner::requestOrderNumberAsync(
+  sick::types::AsyncResultCb<sick::datastructure::OrderNumber> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::OrderNumberVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::OrderNumber> AsyncSickSafetyScanner::requestOrderNumberAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::OrderNumberVariableCommand,
+                                      sick::datastructure::OrderNumber>();
+}
+
+void AsyncSickSafetyScanner::requestDeviceNameAsync(
+  sick::types::AsyncResultCb<sick::datastructure::DeviceName> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::DeviceNameVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::DeviceName> AsyncSickSafetyScanner::requestDeviceNameAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::DeviceNameVariableCommand,
+                                      sick::datastructure::DeviceName>();
+}
+
+void AsyncSickSafetyScanner::requestProjectNameAsync(
+  sick::types::AsyncResultCb<sick::datastructure::ProjectName> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::ProjectNameVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::ProjectName> AsyncSickSafetyScanner::requestProjectNameAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::ProjectNameVariableCommand,
+                                      sick::datastructure::ProjectName>();
+}
+
+void AsyncSickSafetyScanner::requestUserNameAsync(
+  sick::types::AsyncResultCb<sick::datastructure::UserName> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::UserNameVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::UserName> AsyncSickSafetyScanner::requestUserNameAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::UserNameVariableCommand,
+                                      sick::datastructure::UserName>();
+}
+
+void AsyncSickSafetyScanner::requestApplicationNameAsync(
+  sick::types::AsyncResultCb<sick::datastructure::ApplicationName> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::ApplicationNameVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::ApplicationName>
+AsyncSickSafetyScanner::requestApplicationNameAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::ApplicationNameVariableCommand,
+                                      sick::datastructure::ApplicationName>();
+}
+
+void AsyncSickSafetyScanner::requestFieldSetsAsync(
+  sick::types::AsyncResultCb<sick::datastructure::FieldSets> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::FieldSetsVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::FieldSets> AsyncSickSafetyScanner::requestFieldSetsAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::FieldSetsVariableCommand,
+                                      sick::datastructure::FieldSets>();
+}
+
+void AsyncSickSafetyScanner::requestCurrentConfigAsync(
+  sick::types::AsyncResultCb<sick::datastructure::ConfigData> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::MeasurementCurrentConfigVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::ConfigData> AsyncSickSafetyScanner::requestCurrentConfigAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::MeasurementCurrentConfigVariableCommand,
+                                      sick::datastructure::ConfigData>();
+}
+
+void AsyncSickSafetyScanner::requestPersistentConfigAsync(
+  sick::types::AsyncResultCb<sick::datastructure::ConfigData> callback)
+{
+  createAndExecuteCommandAsync<sick::cola2::MeasurementPersistentConfigVariableCommand>(callback);
+}
+
+std::future<sick::datastructure::ConfigData> AsyncSickSafetyScanner::requestPersistentConfigAsync()
+{
+  return createAndExecuteCommandAsync<sick::cola2::MeasurementPersistentConfigVariableCommand,
+                                      sick::datastructure::ConfigData>();
+}
+
+void AsyncSickSafetyScanner::requestLatestTelegramAsync(
+  sick::types::AsyncResultCb<sick::datastructure::Data> callback, int8_t channel_index)
+{
+  createAndExecuteCommandAsync<sick::cola2::LatestTelegramVariableCommand>(
+    callback, checkChannelIndex(channel_index));
+}
+
+std::future<sick::datastructure::Data>
+AsyncSickSafetyScanner::requestLatestTelegramAsync(int8_t channel_index)
+{
+  return createAndExecuteCommandAsync<sick::cola2::LatestTelegramVariableCommand,
+                                      sick::datastructure::Data>(
+    checkChannelIndex(channel_index));
 }
 
 bool SyncSickSafetyScanner::isDataAvailable() const
@@ -296,15 +717,31 @@ bool SyncSickSafetyScanner::isDataAvailable() const
 
 const Data SyncSickSafetyScanner::receive(sick::types::time_duration_t timeout)
 {
-  sick::data_processing::ParseData data_parser;
+  sick::datastructure::Data data;
+  receive(data, timeout);
+  return data;
+}
+
+void SyncSickSafetyScanner::receive(Data& data, sick::types::time_duration_t timeout)
+{
   while (!m_packet_merger.isComplete())
   {
-    auto buffer = m_udp_client.receive(timeout);
+    sick::datastructure::PacketBuffer buffer;
+    try
+    {
+      buffer = m_udp_client.receive(timeout);
+    }
+    catch (const sick::timeout_error&)
+    {
+      // Releases the fragments of a stalled data stream.
+      m_packet_merger.evictExpired();
+      throw;
+    }
     m_packet_merger.addUDPPacket(buffer);
   }
   sick::datastructure::PacketBuffer deployed_buffer = m_packet_merger.getDeployedPacketBuffer();
-  sick::datastructure::Data data                    = data_parser.parseUDPSequence(deployed_buffer);
-  return data;
+  parseData(deployed_buffer, data);
+  m_packet_merger.releasePacketBuffer(std::move(deployed_buffer));
 }
 
 } // namespace sick
@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 ApplicationNameVariableCommand::ApplicationNameVariableCommand(
-  Cola2Session& session, sick::datastructure::ApplicationName& application_name)
+  Cola2SessionState& session, sick::datastructure::ApplicationName& application_name)
   : VariableCommand(session, 33)
   , m_application_name(application_name)
 {
@@ -0,0 +1,445 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file AsyncCola2Session.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/AsyncCola2Session.h"
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/cola2/CloseSession.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace sick {
+namespace cola2 {
+
+AsyncCola2Session::AsyncCola2Session(boost::asio::io_service& io_service,
+                                     sick::types::ip_address_t server_ip,
+                                     sick::types::port_t server_port,
+                                     std::size_t window,
+                                     sick::types::time_duration_t timeout)
+  : m_strand(io_service)
+  , m_tcp_client(m_strand, server_ip, server_port)
+  , m_window(window)
+  , m_timeout(timeout)
+  , m_state(State::CLOSED)
+  , m_is_closed(false)
+  , m_is_receiving(false)
+  , m_connection_id(0)
+  , m_send_sequence(0)
+{
+  if (m_window == 0)
+  {
+    throw runtime_error("Cola2 pipeline window has to contain at least one command.");
+  }
+}
+
+void AsyncCola2Session::executeCommand(CommandFactory factory, CommandCompletionHandler handler)
+{
+  auto self = shared_from_this();
+  m_strand.post([self, factory, handler] {
+    QueuedCommand command{factory, handler, nullptr, false, 0};
+    if (self->m_is_closed)
+    {
+      self->complete(command,
+                     std::make_exception_ptr(runtime_error("Cola2 session has been closed.")));
+      return;
+    }
+    self->m_queued_commands.push_back(std::move(command));
+    self->process();
+  });
+}
+
+void AsyncCola2Session::setIdleTimeout(sick::types::time_duration_t idle_timeout)
+{
+  auto self = shared_from_this();
+  m_strand.post([self, idle_timeout] { self->m_session_state.setIdleTimeout(idle_timeout); });
+}
+
+std::future<void> AsyncCola2Session::close()
+{
+  auto self   = shared_from_this();
+  auto closed = std::make_shared<std::promise<void> >();
+  m_strand.post([self, closed] {
+    if (self->m_is_closed)
+    {
+      closed->set_value();
+      return;
+    }
+    self->m_is_closed = true;
+    auto error        = std::make_exception_ptr(runtime_error("Cola2 session has been closed."));
+    for (auto& pending : self->m_pending_commands)
+    {
+      self->complete(pending.second, error);
+    }
+    self->m_pending_commands.clear();
+    for (auto& queued : self->m_queued_commands)
+    {
+      self->complete(queued, error);
+    }
+    self->m_queued_commands.clear();
+    ++self->m_connection_id;
+
+    if (self->m_state != State::OPEN)
+    {
+      self->m_tcp_client.disconnect();
+      self->m_state = State::CLOSED;
+      closed->set_value();
+      return;
+    }
+    // The reply is not awaited, the sensor drops the session with the connection anyway.
+    CloseSession cmd(self->m_session_state);
+    cmd.setSessionID(self->m_session_state.getSessionID().get_value_or(0));
+    auto telegram = std::make_shared<std::vector<uint8_t> >();
+    *telegram     = cmd.constructTelegram(*telegram);
+    self->m_tcp_client.send(telegram,
+                            [self, closed](const boost::system::error_code&) {
+                              self->m_tcp_client.disconnect();
+                              closed->set_value();
+                            });
+    self->m_state = State::CLOSED;
+  });
+  return closed->get_future();
+}
+
+void AsyncCola2Session::process()
+{
+  if (m_is_closed)
+  {
+    return;
+  }
+  if (m_state == State::CLOSED)
+  {
+    if (!m_queued_commands.empty())
+    {
+      connect();
+    }
+    return;
+  }
+  if (m_state != State::OPEN)
+  {
+    return;
+  }
+
+  if (m_pending_commands.empty() && !m_queued_commands.empty() && m_session_state.isIdleTimeoutExceeded())
+  {
+    LOG_DEBUG("Cola2 session has been idle for too long, reopening it.");
+    reset(nullptr);
+    return;
+  }
+
+  while (!m_queued_commands.empty() && m_pending_commands.size() < m_window)
+  {
+    QueuedCommand command = std::move(m_queued_commands.front());
+    m_queued_commands.pop_front();
+    try
+    {
+      command.cmd = command.factory(m_session_state);
+    }
+    catch (const std::exception&)
+    {
+      complete(command, std::current_exception());
+      continue;
+    }
+    // Replies are routed by request ID, so it has to be unique among the pending commands.
+    while (m_pending_commands.count(command.cmd->getRequestID()) > 0)
+    {
+      command.cmd->setRequestID(m_session_state.getNextRequestID());
+    }
+    sendTelegram(*command.cmd);
+    // The request IDs wrap around, so the send order is kept separately.
+    command.send_sequence     = m_send_sequence++;
+    const uint16_t request_id = command.cmd->getRequestID();
+    m_pending_commands.emplace(request_id, std::move(command));
+  }
+
+  if (!m_pending_commands.empty())
+  {
+    beginReceive();
+  }
+}
+
+void AsyncCola2Session::connect()
+{
+  m_state = State::CONNECTING;
+  m_receive_buffer.clear();
+  auto self                    = shared_from_this();
+  const uint64_t connection_id = ++m_connection_id;
+  m_tcp_client.connect(m_timeout, [self, connection_id](const boost::system::error_code& ec) {
+    self->handleConnect(connection_id, ec);
+  });
+}
+
+void AsyncCola2Session::handleConnect(uint64_t connection_id, const boost::system::error_code& ec)
+{
+  if (connection_id != m_connection_id)
+  {
+    return;
+  }
+  if (ec)
+  {
+    handleError(ec);
+    return;
+  }
+  m_state          = State::OPENING;
+  m_create_session = std::make_shared<CreateSession>(m_session_state);
+  sendTelegram(*m_create_session);
+  beginReceive();
+}
+
+void AsyncCola2Session::sendTelegram(Command& cmd)
+{
+  cmd.setSessionID(m_session_state.getSessionID().get_value_or(0));
+  auto telegram = std::make_shared<std::vector<uint8_t> >();
+  *telegram     = cmd.constructTelegram(*telegram);
+
+  auto self                    = shared_from_this();
+  const uint64_t connection_id = m_connection_id;
+  m_tcp_client.send(telegram, [self, connection_id](const boost::system::error_code& ec) {
+    if (ec && connection_id == self->m_connection_id)
+    {
+      self->handleError(ec);
+    }
+  });
+}
+
+void AsyncCola2Session::beginReceive()
+{
+  if (m_is_receiving)
+  {
+    return;
+  }
+  m_is_receiving               = true;
+  auto self                    = shared_from_this();
+  const uint64_t connection_id = m_connection_id;
+  m_tcp_client.receive(m_timeout,
+                       [self, connection_id](const boost::system::error_code& ec,
+                                             const sick::datastructure::PacketBuffer& packet) {
+                         self->handleReceive(connection_id, ec, packet);
+                       });
+}
+
+void AsyncCola2Session::handleReceive(uint64_t connection_id,
+                                      const boost::system::error_code& ec,
+                                      const sick::datastructure::PacketBuffer& packet)
+{
+  if (connection_id != m_connection_id)
+  {
+    return;
+  }
+  m_is_receiving = false;
+  if (ec)
+  {
+    handleError(ec);
+    return;
+  }
+
+  const std::vector<uint8_t>& data = *packet.getBuffer();
+  m_receive_buffer.insert(m_receive_buffer.end(), data.begin(), data.end());
+
+  // STX and length field
+  const std::size_t header_length = 8;
+  while (m_receive_buffer.size() >= header_length)
+  {
+    std::size_t telegram_length = 0;
+    try
+    {
+      telegram_length = m_tcp_packet_parser.getExpectedPacketLength(
+        sick::read_write_helper::ConstByteSpan(m_receive_buffer));
+    }
+    catch (const runtime_error&)
+    {
+      // The telegram boundaries are lost, the stream can not be resynchronized.
+      reset(std::current_exception());
+      return;
+    }
+    if (m_receive_buffer.size() < telegram_length)
+    {
+      break;
+    }
+    auto telegram_end = m_receive_buffer.begin() + telegram_length;
+    sick::datastructure::PacketBuffer telegram;
+    telegram.setBuffer(std::vector<uint8_t>(m_receive_buffer.begin(), telegram_end));
+    m_receive_buffer.erase(m_receive_buffer.begin(), telegram_end);
+
+    processTelegram(telegram);
+    if (connection_id != m_connection_id)
+    {
+      return;
+    }
+  }
+
+  process();
+  if (m_state == State::OPENING)
+  {
+    beginReceive();
+  }
+}
+
+void AsyncCola2Session::processTelegram(const sick::datastructure::PacketBuffer& telegram)
+{
+  const uint16_t request_id = m_tcp_packet_parser.getRequestID(telegram);
+
+  if (m_state == State::OPENING && m_create_session &&
+      request_id == m_create_session->getRequestID())
+  {
+    m_create_session->processReplyBase(*telegram.getBuffer());
+    // see cola2 manual 0x4F = O, 0x41 = A
+    const bool is_open = m_create_session->getCommandType() == 0x4F &&
+                         m_create_session->getCommandMode() == 0x41;
+    m_create_session.reset();
+    if (!is_open)
+    {
+      reset(std::make_exception_ptr(runtime_error("Could not open Cola2 session.")));
+      return;
+    }
+    m_state = State::OPEN;
+    m_session_state.updateLastActivity();
+    return;
+  }
+
+  auto it = m_pending_commands.find(request_id);
+  if (it == m_pending_commands.end())
+  {
+    LOG_WARN("Dropping Cola2 reply with unexpected request ID.");
+    return;
+  }
+
+  try
+  {
+    it->second.cmd->processReplyBase(*telegram.getBuffer());
+  }
+  catch (const std::exception&)
+  {
+    QueuedCommand command = std::move(it->second);
+    m_pending_commands.erase(it);
+    complete(command, std::current_exception());
+    return;
+  }
+  if (Cola2Session::isSessionErrorReply(*it->second.cmd, telegram))
+  {
+    // The command stays pending, so it is repeated in a new session along with the others.
+    LOG_DEBUG("Cola2 session is not known to the sensor anymore, reopening it.");
+    reset(std::make_exception_ptr(runtime_error("Cola2 session rejected by sensor.")));
+    return;
+  }
+
+  QueuedCommand command = std::move(it->second);
+  m_pending_commands.erase(it);
+  m_session_state.updateLastActivity();
+  // see cola2 manual 0x46 = F, the sensor replies with FA to commands it cannot process
+  if (command.cmd->getCommandType() == 0x46)
+  {
+    complete(command, std::make_exception_ptr(runtime_error("Cola2 command rejected by sensor.")));
+    return;
+  }
+  complete(command, nullptr);
+}
+
+void AsyncCola2Session::handleError(const boost::system::error_code& ec)
+{
+  if (ec == boost::asio::error::timed_out)
+  {
+    reset(std::make_exception_ptr(
+      timeout_error("Timeout exceeded while communicating with the SICK sensor", m_timeout)));
+    return;
+  }
+  reset(std::make_exception_ptr(runtime_error(ec.message())));
+}
+
+void AsyncCola2Session::reset(std::exception_ptr error)
+{
+  const bool was_open = m_state == State::OPEN;
+  m_tcp_client.disconnect();
+  ++m_connection_id;
+  m_state        = State::CLOSED;
+  m_is_receiving = false;
+  m_receive_buffer.clear();
+  m_create_session.reset();
+
+  std::vector<QueuedCommand> pending_commands;
+  pending_commands.reserve(m_pending_commands.size());
+  for (auto& pending : m_pending_commands)
+  {
+    pending_commands.push_back(std::move(pending.second));
+  }
+  m_pending_commands.clear();
+  std::sort(pending_commands.begin(),
+            pending_commands.end(),
+            [](const QueuedCommand& lhs, const QueuedCommand& rhs) {
+              return lhs.send_sequence < rhs.send_sequence;
+            });
+
+  // Repeat the commands in the order they have been sent, in front of the commands still queued.
+  std::deque<QueuedCommand> repeated_commands;
+  for (auto& pending : pending_commands)
+  {
+    if (was_open && !pending.is_repeated)
+    {
+      LOG_DEBUG("Cola2 session failed, repeating the command in a new session.");
+      pending.cmd.reset();
+      pending.is_repeated = true;
+      repeated_commands.push_back(std::move(pending));
+    }
+    else
+    {
+      complete(pending, error);
+    }
+  }
+  m_queued_commands.insert(m_queued_commands.begin(),
+                           std::make_move_iterator(repeated_commands.begin()),
+                           std::make_move_iterator(repeated_commands.end()));
+
+  if (!was_open && error)
+  {
+    for (auto& queued : m_queued_commands)
+    {
+      complete(queued, error);
+    }
+    m_queued_commands.clear();
+  }
+  process();
+}
+
+void AsyncCola2Session::complete(QueuedCommand& command, std::exception_ptr error) const
+{
+  try
+  {
+    command.handler(error);
+  }
+  catch (const std::exception& e)
+  {
+    LOG_ERROR("Cola2 completion handler failed: %s", e.what());
+  }
+}
+
+} // namespace cola2
+} // namespace sick
@@ -42,7 +42,7 @@ namespace sick {
 namespace cola2 {
 
 ChangeCommSettingsCommand::ChangeCommSettingsCommand(
-  Cola2Session& session, const sick::datastructure::CommSettings& settings)
+  Cola2SessionState& session, const sick::datastructure::CommSettings& settings)
   : MethodCommand(session, 0x00b0)
   , m_settings(settings)
 {
@@ -56,14 +56,14 @@ ChangeCommSettingsCommand::addTelegramData(const std::vector<uint8_t>& telegram)
   auto output        = expandTelegram(base_output, 28);
 
   // Add new values after telegram
-  const auto new_data_offset_it = output.begin() + base_length + telegram.size();
+  const auto new_data_span = read_write_helper::ByteSpan(output) + base_length + telegram.size();
 
-  writeDataToDataPtr(new_data_offset_it);
+  writeDataToDataPtr(new_data_span);
 
   return output;
 }
 
-void ChangeCommSettingsCommand::writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void ChangeCommSettingsCommand::writeDataToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   writeChannelToDataPtr(data_ptr);
   writeEnabledToDataPtr(data_ptr);
@@ -86,53 +86,53 @@ bool ChangeCommSettingsCommand::processReply()
   return (!base_class::processReply());
 }
 
-void ChangeCommSettingsCommand::writeChannelToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void ChangeCommSettingsCommand::writeChannelToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint8LittleEndian(data_ptr + 0, m_settings.channel);
 }
 
-void ChangeCommSettingsCommand::writeEnabledToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void ChangeCommSettingsCommand::writeEnabledToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint8LittleEndian(data_ptr + 4, static_cast<uint8_t>(m_settings.enabled));
 }
 
 void ChangeCommSettingsCommand::writeEInterfaceTypeToDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint8LittleEndian(data_ptr + 5, m_settings.e_interface_type);
 }
 
 void ChangeCommSettingsCommand::writeIPAddresstoDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint32LittleEndian(data_ptr + 8, m_settings.host_ip.to_ulong());
 }
 
-void ChangeCommSettingsCommand::writePortToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void ChangeCommSettingsCommand::writePortToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint16LittleEndian(data_ptr + 12, m_settings.host_udp_port);
 }
 
 void ChangeCommSettingsCommand::writeFrequencyToDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint16LittleEndian(data_ptr + 14, m_settings.publishing_frequency);
 }
 
 void ChangeCommSettingsCommand::writeStartAngleToDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint32LittleEndian(data_ptr + 16, m_settings.start_angle);
 }
 
 void ChangeCommSettingsCommand::writeEndAngleToDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint32LittleEndian(data_ptr + 20, m_settings.end_angle);
 }
 
 void ChangeCommSettingsCommand::writeFeaturesToDataPtr(
-  std::vector<uint8_t>::iterator data_ptr) const
+  read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint16LittleEndian(data_ptr + 24,
                                              static_cast<uint16_t>(m_settings.features));
@@ -36,36 +36,137 @@
 #include "sick_safetyscanners_base/Types.h"
 #include <boost/asio.hpp>
 
+#include <algorithm>
+#include <map>
+#include <utility>
+
 namespace sick {
 namespace cola2 {
 
+namespace {
+
+// see cola2 manual, error codes of an FA reply which concern the session instead of the command
+const uint16_t ERROR_SESSION_NO_RESOURCES = 0x0021;
+const uint16_t ERROR_SESSION_UNKNOWN_ID   = 0x0022;
+
+} // namespace
+
 Cola2Session::Cola2Session(communication::TCPClientPtr tcp_client)
-  : m_request_id(0)
-  , m_session_id(boost::none)
-  , m_tcp_client_ptr(std::move(tcp_client))
+  : m_tcp_client_ptr(std::move(tcp_client))
+  , m_reuse_session(false)
 {
 }
 
-boost::optional<uint32_t> Cola2Session::getSessionID() const
+Cola2Session::~Cola2Session()
 {
-  return m_session_id;
+  if (m_reuse_session)
+  {
+    closeReusedSession();
+  }
 }
 
-uint16_t Cola2Session::getNextRequestID()
+void Cola2Session::executeCommand(Command& cmd, boost::posix_time::time_duration timeout)
 {
-  return ++m_request_id;
+  executeCommands(std::vector<Command*>(1, &cmd), 1, timeout);
 }
 
-void Cola2Session::setSessionID(uint32_t session_id)
+void Cola2Session::executeCommands(const std::vector<Command*>& commands,
+                                   std::size_t window,
+                                   boost::posix_time::time_duration timeout)
 {
-  if (m_session_id.is_initialized())
+  if (commands.empty())
   {
-    m_session_id.reset(session_id);
+    return;
   }
-  else
+  if (window == 0)
   {
-    m_session_id.emplace(session_id);
+    throw runtime_error("Cola2 pipeline window has to contain at least one command.");
   }
+
+  if (!m_reuse_session)
+  {
+    std::vector<Command*> repeated_commands;
+    open();
+    sendCommands(commands, window, timeout, repeated_commands);
+    close();
+    return;
+  }
+
+  if (isOpen() && isIdleTimeoutExceeded())
+  {
+    LOG_DEBUG("Cola2 session has been idle for too long, reopening it.");
+    reset();
+  }
+
+  std::vector<Command*> repeated_commands = commands;
+  if (isOpen())
+  {
+    // The replies overwrite type and mode of the commands, keep them to be able to repeat them.
+    std::vector<std::pair<uint8_t, uint8_t> > command_types;
+    command_types.reserve(commands.size());
+    for (const Command* cmd : commands)
+    {
+      command_types.emplace_back(cmd->getCommandType(), cmd->getCommandMode());
+    }
+    try
+    {
+      // On a transport error the commands answered before stay processed, the sensor may already
+      // have executed them.
+      sendCommands(commands, window, timeout, repeated_commands);
+      if (repeated_commands.empty())
+      {
+        updateLastActivity();
+        return;
+      }
+      LOG_DEBUG("Reused Cola2 session is not valid anymore, reopening it.");
+    }
+    catch (const runtime_error& e)
+    {
+      LOG_DEBUG("Reused Cola2 session failed, reopening it: %s", e.what());
+    }
+    reset();
+    for (std::size_t i = 0; i < commands.size(); ++i)
+    {
+      if (std::find(repeated_commands.begin(), repeated_commands.end(), commands[i]) !=
+          repeated_commands.end())
+      {
+        commands[i]->setCommandType(command_types[i].first);
+        commands[i]->setCommandMode(command_types[i].second);
+      }
+    }
+  }
+
+  try
+  {
+    open();
+    std::vector<Command*> rejected_commands;
+    sendCommands(repeated_commands, window, timeout, rejected_commands);
+  }
+  catch (const runtime_error&)
+  {
+    reset();
+    throw;
+  }
+  updateLastActivity();
+}
+
+void Cola2Session::setSessionReuse(bool reuse_session)
+{
+  if (m_reuse_session && !reuse_session)
+  {
+    closeReusedSession();
+  }
+  m_reuse_session = reuse_session;
+}
+
+bool Cola2Session::getSessionReuse() const
+{
+  return m_reuse_session;
+}
+
+Cola2SessionStatistics Cola2Session::getStatistics() const
+{
+  return m_statistics;
 }
 
 void Cola2Session::open()
@@ -75,10 +176,13 @@ void Cola2Session::open()
     close();
   }
   m_tcp_client_ptr->connect();
+  m_receive_buffer.clear();
+  ++m_statistics.sessions;
   CreateSession cmd(*this);
   sendCommand(cmd);
   auto sessID = cmd.getSessionID();
   setSessionID(sessID);
+  updateLastActivity();
   // LOG_DEBUG("Successfully opened Cola2 session with sessionID: %u", sessID);
 }
 
@@ -98,6 +202,48 @@ void Cola2Session::close()
   sendCommand(cmd);
   // auto sessID = cmd.getSessionID();
   m_tcp_client_ptr->disconnect();
+  m_receive_buffer.clear();
+}
+
+void Cola2Session::reset()
+{
+  if (isOpen())
+  {
+    m_tcp_client_ptr->disconnect();
+  }
+  resetSessionID();
+  m_receive_buffer.clear();
+}
+
+void Cola2Session::closeReusedSession()
+{
+  if (isOpen() && isIdleTimeoutExceeded())
+  {
+    reset();
+    return;
+  }
+  try
+  {
+    close();
+  }
+  catch (const runtime_error& e)
+  {
+    LOG_WARN("Could not close Cola2 session: %s", e.what());
+    reset();
+  }
+}
+
+bool Cola2Session::isSessionErrorReply(const Command& cmd,
+                                       const sick::datastructure::PacketBuffer& reply)
+{
+  // see cola2 manual 0x46 = F, the sensor replies with FA and an error code to commands it cannot
+  // process
+  if (cmd.getCommandType() != 0x46)
+  {
+    return false;
+  }
+  const uint16_t error_code = sick::data_processing::ParseTCPPacket().getErrorCode(reply);
+  return error_code == ERROR_SESSION_NO_RESOURCES || error_code == ERROR_SESSION_UNKNOWN_ID;
 }
 
 void Cola2Session::assembleAndSendTelegram(Command& cmd)
@@ -112,30 +258,92 @@ void Cola2Session::assembleAndSendTelegram(Command& cmd)
   m_tcp_client_ptr->send(telegram);
 }
 
+void Cola2Session::sendCommands(const std::vector<Command*>& commands,
+                                std::size_t window,
+                                boost::posix_time::time_duration timeout,
+                                std::vector<Command*>& repeated_commands)
+{
+  m_statistics.commands += commands.size();
+  m_statistics.round_trips += (commands.size() + window - 1) / window;
+
+  repeated_commands = commands;
+  std::map<uint16_t, Command*> pending_commands;
+  std::size_t num_sent = 0;
+
+  while (num_sent < commands.size() || !pending_commands.empty())
+  {
+    while (num_sent < commands.size() && pending_commands.size() < window)
+    {
+      Command* cmd = commands[num_sent++];
+      // Replies are routed by request ID, so it has to be unique among the pending commands.
+      while (pending_commands.count(cmd->getRequestID()) > 0)
+      {
+        cmd->setRequestID(getNextRequestID());
+      }
+      assembleAndSendTelegram(*cmd);
+      pending_commands[cmd->getRequestID()] = cmd;
+    }
+
+    sick::datastructure::PacketBuffer response = receiveTelegram(timeout);
+    auto it = pending_commands.find(m_tcp_packet_parser.getRequestID(response));
+    if (it == pending_commands.end())
+    {
+      LOG_WARN("Dropping Cola2 reply with unexpected request ID.");
+      continue;
+    }
+    Command* cmd = it->second;
+    pending_commands.erase(it);
+    cmd->processReplyBase(*response.getBuffer());
+    if (!isSessionErrorReply(*cmd, response))
+    {
+      repeated_commands.erase(
+        std::find(repeated_commands.begin(), repeated_commands.end(), cmd));
+    }
+  }
+}
+
 sick::datastructure::PacketBuffer
-Cola2Session::receiveAndProcessResponse(Command& cmd, boost::posix_time::time_duration timeout)
+Cola2Session::receiveTelegram(boost::posix_time::time_duration timeout)
 {
-  sick::data_processing::TCPPacketMerger packet_merger(0);
-  sick::data_processing::ParseTCPPacket tcp_packet_parser;
+  // STX and length field
+  const std::size_t header_length = 8;
 
-  while (!packet_merger.isComplete())
+  std::size_t telegram_length = 0;
+  while (telegram_length == 0 || m_receive_buffer.size() < telegram_length)
   {
-    sick::datastructure::PacketBuffer packet_buffer = m_tcp_client_ptr->receive(timeout);
-    if (packet_merger.isEmpty())
+    if (telegram_length == 0 && m_receive_buffer.size() >= header_length)
     {
-      auto expectedPacketLength = tcp_packet_parser.getExpectedPacketLength(packet_buffer);
-      packet_merger.setTargetSize(expectedPacketLength);
+      try
+      {
+        telegram_length = m_tcp_packet_parser.getExpectedPacketLength(
+          sick::read_write_helper::ConstByteSpan(m_receive_buffer));
+      }
+      catch (const runtime_error&)
+      {
+        // The telegram boundaries are lost, the stream can not be resynchronized.
+        reset();
+        throw;
+      }
+      continue;
     }
-    packet_merger.addTCPPacket(packet_buffer);
+    sick::datastructure::PacketBuffer packet_buffer = m_tcp_client_ptr->receive(timeout);
+    const std::vector<uint8_t>& packet              = *packet_buffer.getBuffer();
+    m_receive_buffer.insert(m_receive_buffer.end(), packet.begin(), packet.end());
   }
-  sick::datastructure::PacketBuffer response = packet_merger.getDeployedPacketBuffer();
+
+  auto telegram_end = m_receive_buffer.begin() + telegram_length;
+  sick::datastructure::PacketBuffer response;
+  response.setBuffer(std::vector<uint8_t>(m_receive_buffer.begin(), telegram_end));
+  m_receive_buffer.erase(m_receive_buffer.begin(), telegram_end);
   return response;
 }
 
 void Cola2Session::sendCommand(Command& cmd, boost::posix_time::time_duration timeout)
 {
+  ++m_statistics.commands;
+  ++m_statistics.round_trips;
   assembleAndSendTelegram(cmd);
-  auto response = receiveAndProcessResponse(cmd, timeout);
+  auto response = receiveTelegram(timeout);
   cmd.processReplyBase(*response.getBuffer());
 }
 
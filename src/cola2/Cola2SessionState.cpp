@@ -0,0 +1,113 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file Cola2SessionState.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/Cola2SessionState.h"
+#include "sick_safetyscanners_base/Logging.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace cola2 {
+
+const long Cola2SessionState::MIN_IDLE_TIMEOUT_SECONDS;
+const long Cola2SessionState::MAX_IDLE_TIMEOUT_SECONDS;
+
+Cola2SessionState::Cola2SessionState()
+  : m_request_id(0)
+  , m_session_id(boost::none)
+  , m_idle_timeout(boost::posix_time::seconds(60))
+{
+}
+
+boost::optional<uint32_t> Cola2SessionState::getSessionID() const
+{
+  return m_session_id;
+}
+
+uint16_t Cola2SessionState::getNextRequestID()
+{
+  return ++m_request_id;
+}
+
+void Cola2SessionState::setSessionID(uint32_t session_id)
+{
+  if (m_session_id.is_initialized())
+  {
+    m_session_id.reset(session_id);
+  }
+  else
+  {
+    m_session_id.emplace(session_id);
+  }
+}
+
+void Cola2SessionState::resetSessionID()
+{
+  m_session_id.reset();
+}
+
+void Cola2SessionState::setIdleTimeout(sick::types::time_duration_t idle_timeout)
+{
+  // The sensor only accepts whole seconds in a single byte
+  const long idle_timeout_seconds = std::max(
+    MIN_IDLE_TIMEOUT_SECONDS, std::min(MAX_IDLE_TIMEOUT_SECONDS, idle_timeout.total_seconds()));
+  if (idle_timeout_seconds != idle_timeout.total_seconds() ||
+      idle_timeout.fractional_seconds() != 0)
+  {
+    LOG_WARN("Idle timeout of %ld ms is set to %ld s, the sensor supports whole seconds from %ld "
+             "to %ld.",
+             static_cast<long>(idle_timeout.total_milliseconds()),
+             idle_timeout_seconds,
+             MIN_IDLE_TIMEOUT_SECONDS,
+             MAX_IDLE_TIMEOUT_SECONDS);
+  }
+  m_idle_timeout = boost::posix_time::seconds(idle_timeout_seconds);
+}
+
+sick::types::time_duration_t Cola2SessionState::getIdleTimeout() const
+{
+  return m_idle_timeout;
+}
+
+void Cola2SessionState::updateLastActivity()
+{
+  m_last_activity = std::chrono::steady_clock::now();
+}
+
+bool Cola2SessionState::isIdleTimeoutExceeded() const
+{
+  return std::chrono::steady_clock::now() - m_last_activity >=
+         std::chrono::milliseconds(m_idle_timeout.total_milliseconds());
+}
+
+} // namespace cola2
+} // namespace sick
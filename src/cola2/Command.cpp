@@ -33,12 +33,12 @@
 //----------------------------------------------------------------------
 
 #include "sick_safetyscanners_base/cola2/Command.h"
-#include "sick_safetyscanners_base/cola2/Cola2Session.h"
+#include "sick_safetyscanners_base/cola2/Cola2SessionState.h"
 
 namespace sick {
 namespace cola2 {
 
-Command::Command(Cola2Session& session, uint16_t command_type, uint16_t command_mode)
+Command::Command(Cola2SessionState& session, uint16_t command_type, uint16_t command_mode)
   : m_session(session)
   , m_command_mode(command_mode)
   , m_command_type(command_type)
@@ -66,6 +66,16 @@ void Command::processReplyBase(const std::vector<uint8_t>& packet)
   // m_execution_mutex.unlock();
 }
 
+void Command::processReplyData(const uint8_t& command_type,
+                               const uint8_t& command_mode,
+                               const std::vector<uint8_t>& data)
+{
+  setCommandType(command_type);
+  setCommandMode(command_mode);
+  setDataVector(data);
+  m_was_successful = processReply();
+}
+
 void Command::waitForCompletion()
 {
   boost::mutex::scoped_lock lock(m_execution_mutex);
@@ -129,8 +139,8 @@ std::vector<uint8_t> Command::expandTelegram(const std::vector<uint8_t>& telegra
 
 std::vector<uint8_t> Command::addTelegramHeader(const std::vector<uint8_t>& telegram) const
 {
-  std::vector<uint8_t> header             = prepareHeader();
-  std::vector<uint8_t>::iterator data_ptr = header.begin();
+  std::vector<uint8_t> header          = prepareHeader();
+  read_write_helper::ByteSpan data_ptr = header;
   writeDataToDataPtr(data_ptr, telegram);
   // Add telegram to end of new header, this may resize header
   header.insert(header.end(), telegram.begin(), telegram.end());
@@ -152,7 +162,7 @@ void Command::setDataVector(const std::vector<uint8_t>& data)
   m_data_vector = data;
 }
 
-void Command::writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr,
+void Command::writeDataToDataPtr(read_write_helper::ByteSpan data_ptr,
                                  const std::vector<uint8_t>& telegram) const
 {
   writeCola2StxToDataPtr(data_ptr);
@@ -165,47 +175,47 @@ void Command::writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr,
   writeCommandModeToDataPtr(data_ptr);
 }
 
-void Command::writeCola2StxToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeCola2StxToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   uint32_t cola2_stx = 0x02020202;
   read_write_helper::writeUint32BigEndian(data_ptr + 0, cola2_stx);
 }
 
-void Command::writeLengthToDataPtr(std::vector<uint8_t>::iterator data_ptr,
+void Command::writeLengthToDataPtr(read_write_helper::ByteSpan data_ptr,
                                    const std::vector<uint8_t>& telegram) const
 {
   uint32_t length = 10 + telegram.size();
   read_write_helper::writeUint32BigEndian(data_ptr + 4, length);
 }
 
-void Command::writeCola2HubCntrToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeCola2HubCntrToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   uint8_t cola2_hub_cntr = 0x00;
   read_write_helper::writeUint8BigEndian(data_ptr + 8, cola2_hub_cntr);
 }
 
-void Command::writeCola2NoCToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeCola2NoCToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   uint8_t cola2_noc = 0x00;
   read_write_helper::writeUint8BigEndian(data_ptr + 9, cola2_noc);
 }
 
-void Command::writeSessionIdToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeSessionIdToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint32BigEndian(data_ptr + 10, getSessionID());
 }
 
-void Command::writeRequestIdToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeRequestIdToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint16BigEndian(data_ptr + 14, getRequestID());
 }
 
-void Command::writeCommandTypeToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeCommandTypeToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint8BigEndian(data_ptr + 16, getCommandType());
 }
 
-void Command::writeCommandModeToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void Command::writeCommandModeToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint8BigEndian(data_ptr + 17, getCommandMode());
 }
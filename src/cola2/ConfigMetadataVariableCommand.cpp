@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 ConfigMetadataVariableCommand::ConfigMetadataVariableCommand(
-  Cola2Session& session, sick::datastructure::ConfigMetadata& config_metadata)
+  Cola2SessionState& session, sick::datastructure::ConfigMetadata& config_metadata)
   : VariableCommand(session, 28)
   , m_config_metadata(config_metadata)
 {
@@ -0,0 +1,272 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationCache.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/ConfigurationCache.h"
+
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/data_processing/ReadWriteHelper.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace sick {
+namespace cola2 {
+
+namespace {
+
+// "SSCC" in little endian
+const uint32_t CACHE_FILE_MAGIC   = 0x43435353;
+const uint32_t CACHE_FILE_VERSION = 1;
+
+void appendUint32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+  buffer.resize(buffer.size() + 4);
+  read_write_helper::writeUint32LittleEndian(
+    read_write_helper::ByteSpan(buffer) + (buffer.size() - 4), value);
+}
+
+void appendBytes(std::vector<uint8_t>& buffer, const uint8_t* data, std::size_t length)
+{
+  buffer.insert(buffer.end(), data, data + length);
+}
+
+/*!
+ * \brief Reads the file contents front to back, throwing if the file is truncated.
+ */
+class FileReader
+{
+public:
+  explicit FileReader(const std::vector<uint8_t>& buffer)
+    : m_buffer(buffer)
+    , m_offset(0)
+  {
+  }
+
+  const uint8_t* read(std::size_t length)
+  {
+    if (length > m_buffer.size() - m_offset)
+    {
+      throw runtime_error("Configuration cache file is truncated.");
+    }
+    const uint8_t* data = m_buffer.data() + m_offset;
+    m_offset += length;
+    return data;
+  }
+
+  uint32_t readUint32()
+  {
+    return read_write_helper::readLittleEndian<uint32_t>(read(4));
+  }
+
+  bool isAtEnd() const
+  {
+    return m_offset == m_buffer.size();
+  }
+
+private:
+  const std::vector<uint8_t>& m_buffer;
+  std::size_t m_offset;
+};
+
+} // namespace
+
+ConfigurationCache::ConfigurationCache(const std::string& directory)
+  : m_directory(directory)
+{
+}
+
+bool ConfigurationCache::lookup(const std::string& serial_number,
+                                const std::string& key,
+                                CachedConfiguration& configuration)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_configurations.find(serial_number);
+  if (it == m_configurations.end() || it->second.key != key)
+  {
+    CachedConfiguration persisted_configuration;
+    if (!readFile(serial_number, persisted_configuration) || persisted_configuration.key != key)
+    {
+      return false;
+    }
+    it = m_configurations.emplace(serial_number, CachedConfiguration()).first;
+    it->second = std::move(persisted_configuration);
+  }
+  configuration = it->second;
+  return true;
+}
+
+void ConfigurationCache::store(const std::string& serial_number,
+                               const CachedConfiguration& configuration)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_configurations[serial_number] = configuration;
+  writeFile(serial_number, configuration);
+}
+
+void ConfigurationCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_configurations.clear();
+}
+
+std::string ConfigurationCache::makeKey(const datastructure::SerialNumber& serial_number,
+                                        const datastructure::ConfigMetadata& config_metadata)
+{
+  std::ostringstream key;
+  key << serial_number.getSerialNumber() << std::hex << std::setfill('0') << ':' << std::setw(8)
+      << config_metadata.getAppChecksum() << ':' << std::setw(8)
+      << config_metadata.getOverallChecksum() << ':';
+  for (uint32_t word : config_metadata.getIntegrityHash())
+  {
+    key << std::setw(8) << word;
+  }
+  return key.str();
+}
+
+std::string ConfigurationCache::getFilePath(const std::string& serial_number) const
+{
+  // Keep the file name portable, the serial number is read from the sensor
+  std::string file_name = serial_number;
+  for (char& c : file_name)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '_')
+    {
+      c = '_';
+    }
+  }
+  return m_directory + "/" + file_name + ".cola2cache";
+}
+
+bool ConfigurationCache::readFile(const std::string& serial_number,
+                                  CachedConfiguration& configuration) const
+{
+  if (m_directory.empty())
+  {
+    return false;
+  }
+  std::ifstream file(getFilePath(serial_number), std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  const std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
+                                    std::istreambuf_iterator<char>());
+  try
+  {
+    FileReader reader(buffer);
+    if (reader.readUint32() != CACHE_FILE_MAGIC || reader.readUint32() != CACHE_FILE_VERSION)
+    {
+      throw runtime_error("Unknown configuration cache file format.");
+    }
+    const uint32_t key_length = reader.readUint32();
+    const uint8_t* key        = reader.read(key_length);
+    configuration.key.assign(key, key + key_length);
+    configuration.window = reader.readUint32();
+
+    const uint32_t num_replies = reader.readUint32();
+    for (uint32_t i = 0; i < num_replies; ++i)
+    {
+      const uint8_t* header = reader.read(4);
+      CachedReply& reply =
+        configuration.replies[read_write_helper::readLittleEndian<uint16_t>(header)];
+      reply.command_type         = header[2];
+      reply.command_mode         = header[3];
+      const uint32_t data_length = reader.readUint32();
+      const uint8_t* data        = reader.read(data_length);
+      reply.data.assign(data, data + data_length);
+    }
+    if (!reader.isAtEnd())
+    {
+      throw runtime_error("Configuration cache file has trailing data.");
+    }
+  }
+  catch (const runtime_error& e)
+  {
+    LOG_WARN("Ignoring configuration cache file of %s: %s", serial_number.c_str(), e.what());
+    return false;
+  }
+  return true;
+}
+
+void ConfigurationCache::writeFile(const std::string& serial_number,
+                                   const CachedConfiguration& configuration) const
+{
+  if (m_directory.empty())
+  {
+    return;
+  }
+  std::vector<uint8_t> buffer;
+  appendUint32(buffer, CACHE_FILE_MAGIC);
+  appendUint32(buffer, CACHE_FILE_VERSION);
+  appendUint32(buffer, configuration.key.size());
+  appendBytes(buffer,
+              reinterpret_cast<const uint8_t*>(configuration.key.data()),
+              configuration.key.size());
+  appendUint32(buffer, configuration.window);
+  appendUint32(buffer, configuration.replies.size());
+  for (const auto& reply : configuration.replies)
+  {
+    const uint8_t header[4] = {static_cast<uint8_t>(reply.first & 0xff),
+                               static_cast<uint8_t>(reply.first >> 8),
+                               reply.second.command_type,
+                               reply.second.command_mode};
+    appendBytes(buffer, header, sizeof(header));
+    appendUint32(buffer, reply.second.data.size());
+    appendBytes(buffer, reply.second.data.data(), reply.second.data.size());
+  }
+
+  // Replace the file atomically, so a concurrent reader never sees a partial file
+  const std::string file_path = getFilePath(serial_number);
+  const std::string tmp_path  = file_path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    if (!file)
+    {
+      LOG_WARN("Could not write configuration cache file %s", tmp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), file_path.c_str()) != 0)
+  {
+    LOG_WARN("Could not replace configuration cache file %s", file_path.c_str());
+    std::remove(tmp_path.c_str());
+  }
+}
+
+} // namespace cola2
+} // namespace sick
@@ -0,0 +1,336 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file ConfigurationLoader.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/ConfigurationLoader.h"
+
+#include "sick_safetyscanners_base/Logging.h"
+#include "sick_safetyscanners_base/cola2/ConfigMetadataVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/DeviceNameVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/FieldGeometryVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/FieldHeaderVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/FieldSetsVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/FirmwareVersionVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/MeasurementCurrentConfigVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/MeasurementPersistentConfigVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/MonitoringCaseVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/OrderNumberVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/ProjectNameVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/SerialNumberVariableCommand.h"
+#include "sick_safetyscanners_base/cola2/TypeCodeVariableCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+
+namespace sick {
+namespace cola2 {
+
+ConfigurationLoader::ConfigurationLoader(Cola2Session& session, std::size_t window)
+  : m_session(session)
+  , m_window(std::max<std::size_t>(window, 1))
+  , m_replay(false)
+  , m_content(ALL)
+{
+}
+
+void ConfigurationLoader::load(datastructure::SensorConfiguration& configuration, Content content)
+{
+  const auto start                                = std::chrono::steady_clock::now();
+  const Cola2SessionStatistics session_statistics = m_session.getStatistics();
+
+  const bool reuse_session = m_session.getSessionReuse();
+  m_session.setSessionReuse(true);
+  m_statistics.from_cache = false;
+  m_content               = content;
+  try
+  {
+    loadCached(configuration);
+  }
+  catch (...)
+  {
+    m_session.setSessionReuse(reuse_session);
+    throw;
+  }
+  // Closes the session unless it was reused before
+  m_session.setSessionReuse(reuse_session);
+
+  const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start);
+  m_statistics.duration = boost::posix_time::microseconds(duration.count());
+  m_statistics.commands = m_session.getStatistics().commands - session_statistics.commands;
+  m_statistics.round_trips =
+    m_session.getStatistics().round_trips - session_statistics.round_trips;
+
+  LOG_INFO("Loaded %u fields and %u monitoring cases %s in %ld ms, %lu commands, %lu round trips.",
+           static_cast<unsigned>(configuration.getFieldData().size()),
+           static_cast<unsigned>(configuration.getMonitoringCases().size()),
+           m_statistics.from_cache ? "from cache" : "from sensor",
+           static_cast<long>(m_statistics.duration.total_milliseconds()),
+           static_cast<unsigned long>(m_statistics.commands),
+           static_cast<unsigned long>(m_statistics.round_trips));
+}
+
+void ConfigurationLoader::setCache(std::shared_ptr<ConfigurationCache> cache)
+{
+  m_cache = std::move(cache);
+}
+
+ConfigurationLoaderStatistics ConfigurationLoader::getStatistics() const
+{
+  return m_statistics;
+}
+
+void ConfigurationLoader::loadCached(datastructure::SensorConfiguration& configuration)
+{
+  m_replay = false;
+  m_replies.replies.clear();
+  if (!m_cache)
+  {
+    loadPipelined(configuration);
+    return;
+  }
+
+  datastructure::SerialNumber serial_number;
+  datastructure::ConfigMetadata config_metadata;
+  std::vector<std::unique_ptr<VariableCommand> > commands;
+  commands.emplace_back(new SerialNumberVariableCommand(m_session, serial_number));
+  commands.emplace_back(new ConfigMetadataVariableCommand(m_session, config_metadata));
+  execute(commands);
+  m_replies.replies.clear();
+  const std::string key = ConfigurationCache::makeKey(serial_number, config_metadata);
+
+  if (m_cache->lookup(serial_number.getSerialNumber(), key, m_replies))
+  {
+    m_replay = true;
+    try
+    {
+      loadPipelined(configuration);
+      m_replay                = false;
+      m_statistics.from_cache = true;
+      return;
+    }
+    catch (const runtime_error& e)
+    {
+      // Expected if only other parts of the configuration have been cached so far
+      LOG_INFO("Cached configuration of %s is incomplete or unusable: %s",
+               serial_number.getSerialNumber().c_str(),
+               e.what());
+    }
+    // The cached replies are kept, the replies of this load are merged into them.
+    m_replay = false;
+  }
+
+  m_replies.key    = key;
+  m_replies.window = m_window;
+  loadPipelined(configuration);
+  // Do not cache a configuration which has been changed while loading it
+  if (ConfigurationCache::makeKey(configuration.getSerialNumber(),
+                                  configuration.getConfigMetadata()) == key)
+  {
+    m_cache->store(serial_number.getSerialNumber(), m_replies);
+  }
+}
+
+void ConfigurationLoader::loadPipelined(datastructure::SensorConfiguration& configuration)
+{
+  // Probing is repeated with the recorded window, so the same replies are requested
+  const std::size_t window = m_replay ? std::max<std::size_t>(m_replies.window, 1) : m_window;
+
+  datastructure::SerialNumber serial_number;
+  datastructure::TypeCode type_code;
+  datastructure::FirmwareVersion firmware_version;
+  datastructure::OrderNumber order_number;
+  datastructure::DeviceName device_name;
+  datastructure::ProjectName project_name;
+  datastructure::ConfigMetadata config_metadata;
+  datastructure::FieldSets field_sets;
+  datastructure::ConfigData current_config;
+  datastructure::ConfigData persistent_config;
+  std::vector<datastructure::FieldData> fields(MAX_NUM_FIELDS);
+  std::vector<datastructure::MonitoringCaseData> monitoring_cases(MAX_NUM_MONITORING_CASES);
+
+  const bool all_content = m_content == ALL;
+
+  // The serial number and the config metadata tell if the configuration changed while loading it
+  std::vector<std::unique_ptr<VariableCommand> > commands;
+  commands.emplace_back(new SerialNumberVariableCommand(m_session, serial_number));
+  commands.emplace_back(new ConfigMetadataVariableCommand(m_session, config_metadata));
+  if (all_content)
+  {
+    commands.emplace_back(new TypeCodeVariableCommand(m_session, type_code));
+    commands.emplace_back(new FirmwareVersionVariableCommand(m_session, firmware_version));
+    commands.emplace_back(new OrderNumberVariableCommand(m_session, order_number));
+    commands.emplace_back(new DeviceNameVariableCommand(m_session, device_name));
+    commands.emplace_back(new ProjectNameVariableCommand(m_session, project_name));
+    commands.emplace_back(new FieldSetsVariableCommand(m_session, field_sets));
+    commands.emplace_back(
+      new MeasurementPersistentConfigVariableCommand(m_session, persistent_config));
+  }
+  // The fields depend on the angles of the current config
+  if (m_content & FIELDS)
+  {
+    commands.emplace_back(new MeasurementCurrentConfigVariableCommand(m_session, current_config));
+  }
+
+  uint16_t num_probed_fields = 0;
+  uint16_t num_probed_cases  = 0;
+  uint16_t num_cases         = 0;
+  bool fields_complete       = !(m_content & FIELDS);
+  bool cases_complete        = !(m_content & MONITORING_CASES);
+  std::vector<uint16_t> valid_fields;
+  std::vector<uint16_t> pending_geometries;
+
+  while (!fields_complete || !cases_complete || !pending_geometries.empty())
+  {
+    const uint16_t fields_end =
+      fields_complete ? num_probed_fields
+                      : std::min<std::size_t>(num_probed_fields + window, MAX_NUM_FIELDS);
+    const uint16_t cases_end =
+      cases_complete ? num_probed_cases
+                     : std::min<std::size_t>(num_probed_cases + window, MAX_NUM_MONITORING_CASES);
+
+    for (uint16_t i = num_probed_fields; i < fields_end; ++i)
+    {
+      commands.emplace_back(new FieldHeaderVariableCommand(m_session, fields[i], i));
+    }
+    for (uint16_t i : pending_geometries)
+    {
+      commands.emplace_back(new FieldGeometryVariableCommand(m_session, fields[i], i));
+    }
+    pending_geometries.clear();
+    for (uint16_t i = num_probed_cases; i < cases_end; ++i)
+    {
+      commands.emplace_back(new MonitoringCaseVariableCommand(m_session, monitoring_cases[i], i));
+    }
+    execute(commands);
+
+    for (uint16_t i = num_probed_fields; i < fields_end && !fields_complete; ++i)
+    {
+      if (fields[i].getIsValid())
+      {
+        valid_fields.push_back(i);
+        pending_geometries.push_back(i);
+      }
+      else if (i > 0) // index 0 is reserved for contour data
+      {
+        fields_complete = true; // skip other fields after first invalid
+      }
+    }
+    num_probed_fields = fields_end;
+    fields_complete   = fields_complete || num_probed_fields == MAX_NUM_FIELDS;
+
+    for (uint16_t i = num_probed_cases; i < cases_end && !cases_complete; ++i)
+    {
+      if (monitoring_cases[i].getIsValid())
+      {
+        ++num_cases;
+      }
+      else
+      {
+        cases_complete = true; // skip other cases after first invalid
+      }
+    }
+    num_probed_cases = cases_end;
+    cases_complete   = cases_complete || num_probed_cases == MAX_NUM_MONITORING_CASES;
+  }
+
+  std::vector<datastructure::FieldData> field_data;
+  field_data.reserve(valid_fields.size());
+  for (uint16_t i : valid_fields)
+  {
+    fields[i].setStartAngleDegrees(current_config.getDerivedStartAngle());
+    fields[i].setAngularBeamResolutionDegrees(current_config.getDerivedAngularBeamResolution());
+    field_data.push_back(std::move(fields[i]));
+  }
+  monitoring_cases.resize(num_cases);
+
+  configuration.setSerialNumber(std::move(serial_number));
+  configuration.setConfigMetadata(std::move(config_metadata));
+  if (all_content)
+  {
+    configuration.setTypeCode(std::move(type_code));
+    configuration.setFirmwareVersion(std::move(firmware_version));
+    configuration.setOrderNumber(std::move(order_number));
+    configuration.setDeviceName(std::move(device_name));
+    configuration.setProjectName(std::move(project_name));
+    configuration.setFieldSets(std::move(field_sets));
+    configuration.setPersistentConfig(std::move(persistent_config));
+  }
+  if (m_content & FIELDS)
+  {
+    configuration.setCurrentConfig(std::move(current_config));
+    configuration.setFieldData(std::move(field_data));
+  }
+  if (m_content & MONITORING_CASES)
+  {
+    configuration.setMonitoringCases(std::move(monitoring_cases));
+  }
+}
+
+void ConfigurationLoader::execute(std::vector<std::unique_ptr<VariableCommand> >& commands)
+{
+  if (m_replay)
+  {
+    for (const auto& cmd : commands)
+    {
+      auto it = m_replies.replies.find(cmd->getVariableIndex());
+      if (it == m_replies.replies.end())
+      {
+        throw runtime_error("Reply to variable " + std::to_string(cmd->getVariableIndex()) +
+                            " is missing.");
+      }
+      cmd->processReplyData(it->second.command_type, it->second.command_mode, it->second.data);
+    }
+    commands.clear();
+    return;
+  }
+
+  std::vector<Command*> command_ptrs;
+  command_ptrs.reserve(commands.size());
+  for (const auto& cmd : commands)
+  {
+    command_ptrs.push_back(cmd.get());
+  }
+  m_session.executeCommands(command_ptrs, m_window);
+  for (const auto& cmd : commands)
+  {
+    CachedReply& reply = m_replies.replies[cmd->getVariableIndex()];
+    reply.command_type = cmd->getCommandType();
+    reply.command_mode = cmd->getCommandMode();
+    reply.data         = cmd->getDataVector();
+  }
+  commands.clear();
+}
+
+} // namespace cola2
+} // namespace sick
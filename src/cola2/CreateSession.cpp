@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-CreateSession::CreateSession(Cola2Session& session)
+CreateSession::CreateSession(Cola2SessionState& session)
   : Command(session, 0x4F, 0x58) // see cola2 manual 0x4F = O, 0x58 = X
 {
 }
@@ -49,9 +49,9 @@ std::vector<uint8_t> CreateSession::addTelegramData(const std::vector<uint8_t>&
 {
   auto output = expandTelegram(telegram, 5);
   // Add new values after telegram
-  auto new_data_offset_it = output.begin() + telegram.size();
-  writeHeartbeatTimeoutToDataPtr(new_data_offset_it);
-  writeClientIdToDataPtr(new_data_offset_it);
+  auto new_data_span = read_write_helper::ByteSpan(output) + telegram.size();
+  writeHeartbeatTimeoutToDataPtr(new_data_span);
+  writeClientIdToDataPtr(new_data_span);
   return output;
 }
 
@@ -76,16 +76,19 @@ bool CreateSession::processReply()
   return result;
 }
 
-void CreateSession::writeHeartbeatTimeoutToDataPtr(std::vector<uint8_t>::iterator it) const
+void CreateSession::writeHeartbeatTimeoutToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
-  uint8_t heart_beat_time_out_seconds = 60;
-  read_write_helper::writeUint8BigEndian(it + 0, heart_beat_time_out_seconds);
+  // The sensor closes the session once it has been idle for the heartbeat timeout, the session
+  // keeps it within the range the sensor accepts
+  uint8_t heart_beat_time_out_seconds =
+    static_cast<uint8_t>(m_session.getIdleTimeout().total_seconds());
+  read_write_helper::writeUint8BigEndian(data_ptr + 0, heart_beat_time_out_seconds);
 }
 
-void CreateSession::writeClientIdToDataPtr(std::vector<uint8_t>::iterator it) const
+void CreateSession::writeClientIdToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   uint32_t client_id = 1; // can be any random number
-  read_write_helper::writeUint32BigEndian(it + 1, client_id);
+  read_write_helper::writeUint32BigEndian(data_ptr + 1, client_id);
 }
 
 } // namespace cola2
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-DeviceNameVariableCommand::DeviceNameVariableCommand(Cola2Session& session,
+DeviceNameVariableCommand::DeviceNameVariableCommand(Cola2SessionState& session,
                                                      datastructure::DeviceName& device_name)
   : VariableCommand(session, 17)
   , m_device_name(device_name)
@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 DeviceStatusVariableCommand::DeviceStatusVariableCommand(
-  Cola2Session& session, sick::datastructure::DeviceStatus& device_status)
+  Cola2SessionState& session, sick::datastructure::DeviceStatus& device_status)
   : VariableCommand(session, 15)
   , m_device_status(device_status)
 {
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-FieldGeometryVariableCommand::FieldGeometryVariableCommand(Cola2Session& session,
+FieldGeometryVariableCommand::FieldGeometryVariableCommand(Cola2SessionState& session,
                                                            datastructure::FieldData& field_data,
                                                            const uint16_t& index)
   : VariableCommand(session, 0x2810 + index)
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-FieldHeaderVariableCommand::FieldHeaderVariableCommand(Cola2Session& session,
+FieldHeaderVariableCommand::FieldHeaderVariableCommand(Cola2SessionState& session,
                                                        datastructure::FieldData& field_data,
                                                        const uint16_t& index)
   : VariableCommand(session, 0x2710 + index)
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-FieldSetsVariableCommand::FieldSetsVariableCommand(Cola2Session& session,
+FieldSetsVariableCommand::FieldSetsVariableCommand(Cola2SessionState& session,
                                                    sick::datastructure::FieldSets& field_sets)
   : VariableCommand(session, 1003)
   , m_field_sets(field_sets)
@@ -41,7 +41,7 @@
 namespace sick {
 namespace cola2 {
 
-FindMeCommand::FindMeCommand(Cola2Session& session, uint16_t blink_time)
+FindMeCommand::FindMeCommand(Cola2SessionState& session, uint16_t blink_time)
   : MethodCommand(session, 14)
   , m_blink_time(blink_time)
 {
@@ -54,14 +54,14 @@ std::vector<uint8_t> FindMeCommand::addTelegramData(const std::vector<uint8_t>&
   auto output        = expandTelegram(base_output, 2);
 
   // Add new values after telegram
-  const auto new_data_offset_it = output.begin() + base_length + telegram.size();
+  const auto new_data_span = read_write_helper::ByteSpan(output) + base_length + telegram.size();
 
-  writeDataToDataPtr(new_data_offset_it);
+  writeDataToDataPtr(new_data_span);
 
   return output;
 }
 
-void FindMeCommand::writeDataToDataPtr(std::vector<uint8_t>::iterator data_ptr) const
+void FindMeCommand::writeDataToDataPtr(read_write_helper::ByteSpan data_ptr) const
 {
   read_write_helper::writeUint16LittleEndian(data_ptr + 0, m_blink_time);
 }
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-LatestTelegramVariableCommand::LatestTelegramVariableCommand(Cola2Session& session,
+LatestTelegramVariableCommand::LatestTelegramVariableCommand(Cola2SessionState& session,
                                                              datastructure::Data& data,
                                                              const int8_t index)
   : VariableCommand(session, 179 + index)
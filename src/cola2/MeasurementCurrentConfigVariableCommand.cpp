@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 MeasurementCurrentConfigVariableCommand::MeasurementCurrentConfigVariableCommand(
-  Cola2Session& session, datastructure::ConfigData& config_data)
+  Cola2SessionState& session, datastructure::ConfigData& config_data)
   : VariableCommand(session, 178)
   , m_config_data(config_data)
 {
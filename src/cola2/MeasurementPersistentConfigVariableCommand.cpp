@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 MeasurementPersistentConfigVariableCommand::MeasurementPersistentConfigVariableCommand(
-  Cola2Session& session, datastructure::ConfigData& config_data)
+  Cola2SessionState& session, datastructure::ConfigData& config_data)
   : VariableCommand(session, 177)
   , m_config_data(config_data)
 {
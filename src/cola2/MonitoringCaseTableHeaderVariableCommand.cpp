@@ -43,7 +43,7 @@ namespace cola2 {
 // TODO
 
 MonitoringCaseTableHeaderVariableCommand::MonitoringCaseTableHeaderVariableCommand(
-  Cola2Session& session, datastructure::FieldData& field_data)
+  Cola2SessionState& session, datastructure::FieldData& field_data)
   : VariableCommand(session, 2100)
 {
   m_field_header_parser_ptr = std::make_shared<sick::data_processing::ParseFieldHeaderData>();
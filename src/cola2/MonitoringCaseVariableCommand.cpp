@@ -42,7 +42,7 @@ namespace cola2 {
 
 
 MonitoringCaseVariableCommand::MonitoringCaseVariableCommand(
-  Cola2Session& session,
+  Cola2SessionState& session,
   datastructure::MonitoringCaseData& monitoring_case_data,
   const uint16_t& index)
   : VariableCommand(session, 2101 + index)
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-OrderNumberVariableCommand::OrderNumberVariableCommand(Cola2Session& session,
+OrderNumberVariableCommand::OrderNumberVariableCommand(Cola2SessionState& session,
                                                        datastructure::OrderNumber& order_number)
   : VariableCommand(session, 14)
   , m_order_number(order_number)
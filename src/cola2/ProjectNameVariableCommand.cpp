@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-ProjectNameVariableCommand::ProjectNameVariableCommand(Cola2Session& session,
+ProjectNameVariableCommand::ProjectNameVariableCommand(Cola2SessionState& session,
                                                        datastructure::ProjectName& project_name)
   : VariableCommand(session, 18)
   , m_project_name(project_name)
@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 RequiredUserActionVariableCommand::RequiredUserActionVariableCommand(
-  Cola2Session& session, sick::datastructure::RequiredUserAction& required_user_action)
+  Cola2SessionState& session, sick::datastructure::RequiredUserAction& required_user_action)
   : VariableCommand(session, 16)
   , m_required_user_action(required_user_action)
 {
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-SerialNumberVariableCommand::SerialNumberVariableCommand(Cola2Session& session,
+SerialNumberVariableCommand::SerialNumberVariableCommand(Cola2SessionState& session,
                                                          datastructure::SerialNumber& serial_number)
   : VariableCommand(session, 3)
   , m_serial_number(serial_number)
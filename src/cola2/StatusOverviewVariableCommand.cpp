@@ -41,7 +41,7 @@ namespace sick {
 namespace cola2 {
 
 StatusOverviewVariableCommand::StatusOverviewVariableCommand(
-  Cola2Session& session, sick::datastructure::StatusOverview& status_overview)
+  Cola2SessionState& session, sick::datastructure::StatusOverview& status_overview)
   : VariableCommand(session, 23)
   , m_status_overview(status_overview)
 {
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-TypeCodeVariableCommand::TypeCodeVariableCommand(Cola2Session& session,
+TypeCodeVariableCommand::TypeCodeVariableCommand(Cola2SessionState& session,
                                                  sick::datastructure::TypeCode& type_code)
   : VariableCommand(session, 0x000d)
   , m_type_code(type_code)
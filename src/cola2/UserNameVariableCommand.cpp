@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-UserNameVariableCommand::UserNameVariableCommand(Cola2Session& session,
+UserNameVariableCommand::UserNameVariableCommand(Cola2SessionState& session,
                                                  sick::datastructure::UserName& user_name)
   : VariableCommand(session, 35)
   , m_user_name(user_name)
@@ -40,7 +40,7 @@
 namespace sick {
 namespace cola2 {
 
-VariableCommand::VariableCommand(Cola2Session& session, const uint16_t& variable_index)
+VariableCommand::VariableCommand(Cola2SessionState& session, const uint16_t& variable_index)
   : Command(session, 0x52, 0x49) // see cola2 manual 0x52 = 'R' and  0x49 = 'I'
   , m_variable_index(variable_index)
 {
@@ -50,8 +50,8 @@ std::vector<uint8_t> VariableCommand::addTelegramData(const std::vector<uint8_t>
 {
   auto output = expandTelegram(telegram, 2);
   // Add new values after telegram
-  auto new_data_offset_it = output.begin() + telegram.size();
-  read_write_helper::writeUint16LittleEndian(new_data_offset_it, m_variable_index);
+  auto new_data_span = read_write_helper::ByteSpan(output) + telegram.size();
+  read_write_helper::writeUint16LittleEndian(new_data_span, m_variable_index);
   return output;
 }
 
@@ -0,0 +1,161 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file AsyncTCPClient.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/communication/AsyncTCPClient.h"
+#include "sick_safetyscanners_base/Logging.h"
+
+#include <boost/version.hpp>
+
+namespace sick {
+namespace communication {
+
+using boost::asio::deadline_timer;
+
+namespace {
+
+boost::asio::io_service& getIOService(boost::asio::io_service::strand& strand)
+{
+#if BOOST_VERSION >= 106600
+  return strand.context();
+#else
+  return strand.get_io_service();
+#endif
+}
+
+} // namespace
+
+AsyncTCPClient::AsyncTCPClient(boost::asio::io_service::strand& strand,
+                               sick::types::ip_address_t server_ip,
+                               sick::types::port_t server_port)
+  : m_strand(strand)
+  , m_socket(getIOService(strand))
+  , m_server_ip(server_ip)
+  , m_server_port(server_port)
+  , m_deadline(getIOService(strand))
+  , m_is_deadline_exceeded(false)
+  , m_recv_buffer()
+{
+}
+
+void AsyncTCPClient::connect(sick::types::time_duration_t timeout, Handler handler)
+{
+  auto remote_endpoint = boost::asio::ip::tcp::endpoint(m_server_ip, m_server_port);
+  startDeadline(timeout);
+  m_socket.async_connect(remote_endpoint,
+                         m_strand.wrap([this, handler](const boost::system::error_code& ec) {
+                           handler(stopDeadline(ec));
+                         }));
+}
+
+void AsyncTCPClient::disconnect()
+{
+  boost::system::error_code ec;
+  m_deadline.cancel(ec);
+  m_socket.close(ec);
+  if (ec)
+  {
+    LOG_ERROR("An error occured during disconnecting from the server: %s. This error is internally "
+              "ignored and socket has been closed",
+              ec.message().c_str());
+  }
+}
+
+void AsyncTCPClient::send(std::shared_ptr<const std::vector<uint8_t>> buffer, Handler handler)
+{
+  boost::asio::async_write(
+    m_socket,
+    boost::asio::buffer(*buffer),
+    m_strand.wrap([buffer, handler](const boost::system::error_code& ec, std::size_t) {
+      handler(ec);
+    }));
+}
+
+void AsyncTCPClient::receive(sick::types::time_duration_t timeout, ReceiveHandler handler)
+{
+  startDeadline(timeout);
+  m_socket.async_receive(
+    boost::asio::buffer(m_recv_buffer),
+    m_strand.wrap([this, handler](const boost::system::error_code& ec, std::size_t bytes_recv) {
+      boost::system::error_code result = stopDeadline(ec);
+      if (result)
+      {
+        handler(result, sick::datastructure::PacketBuffer());
+        return;
+      }
+      handler(result, sick::datastructure::PacketBuffer(m_recv_buffer, bytes_recv));
+    }));
+}
+
+bool AsyncTCPClient::isConnected() const
+{
+  return m_socket.is_open();
+}
+
+void AsyncTCPClient::startDeadline(sick::types::time_duration_t timeout)
+{
+  m_is_deadline_exceeded = false;
+  m_deadline.expires_from_now(timeout);
+  m_deadline.async_wait(
+    m_strand.wrap([this](const boost::system::error_code& ec) { handleDeadline(ec); }));
+}
+
+boost::system::error_code AsyncTCPClient::stopDeadline(const boost::system::error_code& ec)
+{
+  boost::system::error_code ignored_ec;
+  m_deadline.cancel(ignored_ec);
+  if (ec && m_is_deadline_exceeded)
+  {
+    return boost::asio::error::timed_out;
+  }
+  return ec;
+}
+
+void AsyncTCPClient::handleDeadline(const boost::system::error_code& ec)
+{
+  // A cancelled deadline may outlive this client, so it must not be touched in that case.
+  if (ec == boost::asio::error::operation_aborted)
+  {
+    return;
+  }
+  // The deadline may have been moved by a new operation before this handler had a chance to run.
+  if (m_deadline.expires_at() <= deadline_timer::traits_type::now())
+  {
+    // Closing the socket aborts the outstanding operation, which then reports the timeout.
+    m_is_deadline_exceeded = true;
+    boost::system::error_code ignored_ec;
+    m_socket.close(ignored_ec);
+  }
+}
+
+} // namespace communication
+} // namespace sick
@@ -44,28 +44,47 @@
 #include <boost/lambda/bind.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/thread.hpp>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 
+#ifdef __linux__
+#  include <sys/socket.h>
+#endif
+
 namespace sick {
 namespace communication {
 
 using boost::asio::deadline_timer;
 using boost::asio::ip::tcp;
 using boost::lambda::_1;
+using boost::lambda::_2;
 using boost::lambda::bind;
 using boost::lambda::var;
 
+const std::size_t UDPClient::MAX_BATCH_SIZE;
+const std::size_t UDPClient::PACKET_POOL_SIZE;
+const std::size_t UDPClient::PACKET_POOL_MAX_SIZE;
+
 UDPClient::UDPClient(boost::asio::io_service& io_service, sick::types::port_t server_port)
   : m_io_service(io_service)
-  , m_socket(boost::ref(io_service),
+  , m_socket(io_service,
              boost::asio::ip::udp::endpoint{boost::asio::ip::udp::v4(), server_port})
   , m_packet_handler()
-  , m_recv_buffer()
+  , m_packet_pool(PACKET_POOL_SIZE, PACKET_POOL_MAX_SIZE)
+  , m_recv_slot()
+  , m_discard_buffer()
+  , m_batch_slots()
+  , m_batch()
   , m_deadline(io_service)
+  , m_num_datagrams(0)
+  , m_num_receive_syscalls(0)
+  , m_num_handler_dispatches(0)
+  , m_num_dropped_datagrams(0)
 {
   m_deadline.expires_at(boost::posix_time::pos_infin);
   checkDeadline();
@@ -98,9 +117,17 @@ void UDPClient::checkDeadline()
 
 void UDPClient::handleReceive(boost::system::error_code ec, std::size_t bytes_recv)
 {
-  if (!ec)
+  ++m_num_handler_dispatches;
+  ++m_num_receive_syscalls;
+  if (!ec && !m_recv_slot)
+  {
+    ++m_num_dropped_datagrams;
+  }
+  else if (!ec)
   {
-    sick::datastructure::PacketBuffer packet_buffer(m_recv_buffer, bytes_recv);
+    ++m_num_datagrams;
+    sick::datastructure::PacketBuffer packet_buffer(m_recv_slot, bytes_recv);
+    m_recv_slot.reset();
     m_packet_handler(packet_buffer);
   }
   else
@@ -112,13 +139,159 @@ void UDPClient::handleReceive(boost::system::error_code ec, std::size_t bytes_re
 
 void UDPClient::beginReceive()
 {
-  m_socket.async_receive_from(boost::asio::buffer(m_recv_buffer),
+  m_recv_slot = m_packet_pool.acquire();
+  // If all slots are still referenced by the consumer, the datagram is received to be dropped.
+  m_socket.async_receive_from(m_recv_slot ? boost::asio::buffer(*m_recv_slot)
+                                          : boost::asio::buffer(m_discard_buffer),
                               m_remote_endpoint,
                               [this](boost::system::error_code ec, std::size_t bytes_recvd) {
                                 this->handleReceive(ec, bytes_recvd);
                               });
 }
 
+void UDPClient::prepareBatchSlots()
+{
+  // The slots are acquired lazily and kept across wakeups, see receivePendingDatagrams().
+  m_batch_slots.resize(MAX_BATCH_SIZE);
+  m_batch.reserve(MAX_BATCH_SIZE);
+}
+
+void UDPClient::beginBatchReceive()
+{
+  // Only wait for the socket to become readable, the datagrams are read in handleBatchReceive.
+  m_socket.async_receive(boost::asio::null_buffers(),
+                         [this](boost::system::error_code ec, std::size_t /*bytes_recvd*/) {
+                           this->handleBatchReceive(ec);
+                         });
+}
+
+void UDPClient::handleBatchReceive(boost::system::error_code ec)
+{
+  ++m_num_handler_dispatches;
+  if (ec)
+  {
+    throw runtime_error(ec.message());
+  }
+
+  // A full batch indicates that more datagrams might be pending, so keep draining.
+  std::size_t num_received = 0;
+  do
+  {
+    num_received = receivePendingDatagrams();
+    if (!m_batch.empty())
+    {
+      m_num_datagrams += m_batch.size();
+      m_packet_batch_handler(m_batch);
+      // Drop our references so the slots can return to the pool once the consumer is done.
+      m_batch.clear();
+    }
+  } while (num_received == MAX_BATCH_SIZE);
+
+  beginBatchReceive();
+}
+
+std::size_t UDPClient::receivePendingDatagrams()
+{
+#ifdef __linux__
+  mmsghdr headers[MAX_BATCH_SIZE];
+  iovec iovecs[MAX_BATCH_SIZE];
+  std::size_t slot_indices[MAX_BATCH_SIZE];
+  std::memset(headers, 0, sizeof(headers));
+  std::size_t num_slots = 0;
+  for (std::size_t i = 0; i < MAX_BATCH_SIZE; ++i)
+  {
+    // Only the slots handed out with a datagram in the previous round have to be replaced.
+    if (!m_batch_slots[i])
+    {
+      m_batch_slots[i] = m_packet_pool.acquire();
+    }
+    if (!m_batch_slots[i])
+    {
+      continue;
+    }
+    slot_indices[num_slots]               = i;
+    iovecs[num_slots].iov_base            = m_batch_slots[i]->data();
+    iovecs[num_slots].iov_len             = m_batch_slots[i]->size();
+    headers[num_slots].msg_hdr.msg_iov    = &iovecs[num_slots];
+    headers[num_slots].msg_hdr.msg_iovlen = 1;
+    ++num_slots;
+  }
+
+  if (num_slots == 0)
+  {
+    // All slots are still referenced by the consumer, drop a datagram to keep up with the socket.
+    ++m_num_receive_syscalls;
+    if (::recv(m_socket.native_handle(),
+               m_discard_buffer.data(),
+               m_discard_buffer.size(),
+               MSG_DONTWAIT) >= 0)
+    {
+      ++m_num_dropped_datagrams;
+    }
+    return 0;
+  }
+
+  ++m_num_receive_syscalls;
+  int num_received =
+    ::recvmmsg(m_socket.native_handle(), headers, num_slots, MSG_DONTWAIT, nullptr);
+  if (num_received < 0)
+  {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+    {
+      return 0;
+    }
+    throw runtime_error(std::strerror(errno));
+  }
+
+  for (int i = 0; i < num_received; ++i)
+  {
+    auto& slot = m_batch_slots[slot_indices[i]];
+    m_batch.push_back(sick::datastructure::PacketBuffer(slot, headers[i].msg_len));
+    slot.reset();
+  }
+  return static_cast<std::size_t>(num_received);
+#else
+  // Without recvmmsg the pending datagrams are still drained within one wakeup, but one system call
+  // per datagram is needed. The socket is only non-blocking while it is drained, so the blocking
+  // receive() keeps its behaviour.
+  m_socket.non_blocking(true);
+  std::size_t num_received = 0;
+  boost::system::error_code ec;
+  while (num_received < MAX_BATCH_SIZE)
+  {
+    if (!m_batch_slots[0])
+    {
+      m_batch_slots[0] = m_packet_pool.acquire();
+    }
+    ++m_num_receive_syscalls;
+    if (!m_batch_slots[0])
+    {
+      // All slots are still referenced by the consumer, drop a datagram to keep up with the socket.
+      m_socket.receive(boost::asio::buffer(m_discard_buffer), 0, ec);
+      if (!ec)
+      {
+        ++m_num_dropped_datagrams;
+      }
+      break;
+    }
+    std::size_t bytes_recv = m_socket.receive(boost::asio::buffer(*m_batch_slots[0]), 0, ec);
+    if (ec)
+    {
+      break;
+    }
+    m_batch.push_back(sick::datastructure::PacketBuffer(m_batch_slots[0], bytes_recv));
+    m_batch_slots[0].reset();
+    ++num_received;
+  }
+  m_socket.non_blocking(false);
+  if (ec && ec != boost::asio::error::would_block && ec != boost::asio::error::try_again)
+  {
+    throw runtime_error(ec.message());
+  }
+  return num_received;
+#endif
+}
+
 void UDPClient::stop()
 {
   m_socket.cancel();
@@ -130,14 +303,19 @@ sick::datastructure::PacketBuffer UDPClient::receive(sick::types::time_duration_
   m_deadline.expires_from_now(timeout);
 
   std::size_t bytes_recv = 0;
+  auto slot              = m_packet_pool.acquire();
+  if (!slot)
+  {
+    throw runtime_error("All receive slots are still referenced by the consumer");
+  }
   m_socket.async_receive_from(
-    boost::asio::buffer(m_recv_buffer),
+    boost::asio::buffer(*slot),
     m_remote_endpoint,
-    boost::bind(&UDPClient::handleReceiveDeadline, _1, _2, &ec, &bytes_recv));
+    bind(&UDPClient::handleReceiveDeadline, _1, _2, &ec, &bytes_recv));
 
   // Block until async_receive_from finishes or the deadline_timer exceeds its timeout.
   do
-    m_socket.get_io_service().run_one();
+    m_io_service.run_one();
   while (ec == boost::asio::error::would_block);
 
   if (ec == boost::asio::error::timed_out || ec == boost::asio::error::operation_aborted)
@@ -149,10 +327,20 @@ sick::datastructure::PacketBuffer UDPClient::receive(sick::types::time_duration_
     throw runtime_error(ec.message());
   }
 
-  auto buffer = sick::datastructure::PacketBuffer(m_recv_buffer, bytes_recv);
+  auto buffer = sick::datastructure::PacketBuffer(slot, bytes_recv);
   return buffer;
 }
 
+UDPClientStatistics UDPClient::getStatistics() const
+{
+  UDPClientStatistics statistics;
+  statistics.datagrams          = m_num_datagrams.load();
+  statistics.receive_syscalls   = m_num_receive_syscalls.load();
+  statistics.handler_dispatches = m_num_handler_dispatches.load();
+  statistics.dropped_datagrams  = m_num_dropped_datagrams.load();
+  return statistics;
+}
+
 bool UDPClient::isDataAvailable() const
 {
   return m_socket.is_open() && m_socket.available() > 0;
@@ -0,0 +1,259 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file BeamDecoder.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/BeamDecoder.h"
+
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
+#if !defined(SICK_DISABLE_SIMD) && defined(__GNUC__) &&                                           \
+  (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) &&                               \
+  (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SICK_BEAM_DECODER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace sick {
+namespace data_processing {
+
+// The kernels are written for this beam record, see data_layout::measurement_data::beam.
+static_assert(BeamDecoder::BEAM_SIZE == data_layout::measurement_data::beam::SIZE &&
+                data_layout::measurement_data::beam::Distance::OFFSET == 0 &&
+                data_layout::measurement_data::beam::Reflectivity::OFFSET == 2 &&
+                data_layout::measurement_data::beam::StatusByte::OFFSET == 3,
+              "The beam decoder does not match the beam layout");
+
+void BeamDecoder::decode(const uint8_t* beams,
+                         std::size_t num_beams,
+                         uint16_t* distances,
+                         uint8_t* reflectivities,
+                         uint8_t* status_bytes)
+{
+  static const InstructionSet instruction_set = getInstructionSet();
+  decode(instruction_set, beams, num_beams, distances, reflectivities, status_bytes);
+}
+
+void BeamDecoder::decode(InstructionSet instruction_set,
+                         const uint8_t* beams,
+                         std::size_t num_beams,
+                         uint16_t* distances,
+                         uint8_t* reflectivities,
+                         uint8_t* status_bytes)
+{
+  if (!isSupported(instruction_set))
+  {
+    instruction_set = SCALAR;
+  }
+  switch (instruction_set)
+  {
+    case AVX2:
+      decodeAvx2(beams, num_beams, distances, reflectivities, status_bytes);
+      break;
+    case SSE2:
+      decodeSse2(beams, num_beams, distances, reflectivities, status_bytes);
+      break;
+    default:
+      decodeScalar(beams, num_beams, distances, reflectivities, status_bytes);
+      break;
+  }
+}
+
+BeamDecoder::InstructionSet BeamDecoder::getInstructionSet()
+{
+  if (isSupported(AVX2))
+  {
+    return AVX2;
+  }
+  if (isSupported(SSE2))
+  {
+    return SSE2;
+  }
+  return SCALAR;
+}
+
+bool BeamDecoder::isSupported(InstructionSet instruction_set)
+{
+  switch (instruction_set)
+  {
+#ifdef SICK_BEAM_DECODER_X86
+    case AVX2:
+      return __builtin_cpu_supports("avx2");
+    case SSE2:
+      return true;
+#endif
+    case SCALAR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void BeamDecoder::decodeScalar(const uint8_t* beams,
+                               std::size_t num_beams,
+                               uint16_t* distances,
+                               uint8_t* reflectivities,
+                               uint8_t* status_bytes)
+{
+  for (std::size_t i = 0; i < num_beams; ++i)
+  {
+    const uint8_t* beam = beams + i * BEAM_SIZE;
+    distances[i]        = static_cast<uint16_t>((beam[1] << 8) + beam[0]);
+    reflectivities[i]   = beam[2];
+    status_bytes[i]     = beam[3];
+  }
+}
+
+#ifdef SICK_BEAM_DECODER_X86
+
+// Each beam record is loaded as one little endian 32 bit lane: the distance occupies the lower 16
+// bits, followed by the reflectivity and the status byte. The lanes are narrowed with the packing
+// instructions, which saturate, so every field is brought into a range where saturation is a no-op
+// first: distances are sign extended for the signed 32 to 16 bit pack, bytes are zero extended.
+
+void BeamDecoder::decodeSse2(const uint8_t* beams,
+                             std::size_t num_beams,
+                             uint16_t* distances,
+                             uint8_t* reflectivities,
+                             uint8_t* status_bytes)
+{
+  const std::size_t beams_per_iteration = 16;
+  std::size_t i                         = 0;
+  for (; i + beams_per_iteration <= num_beams; i += beams_per_iteration)
+  {
+    const __m128i* src = reinterpret_cast<const __m128i*>(beams + i * BEAM_SIZE);
+    __m128i a          = _mm_loadu_si128(src + 0);
+    __m128i b          = _mm_loadu_si128(src + 1);
+    __m128i c          = _mm_loadu_si128(src + 2);
+    __m128i d          = _mm_loadu_si128(src + 3);
+
+    __m128i dist_ab = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                                      _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+    __m128i dist_cd = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(c, 16), 16),
+                                      _mm_srai_epi32(_mm_slli_epi32(d, 16), 16));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(distances + i + 0), dist_ab);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(distances + i + 8), dist_cd);
+
+    __m128i refl_ab = _mm_packs_epi32(_mm_srli_epi32(_mm_slli_epi32(a, 8), 24),
+                                      _mm_srli_epi32(_mm_slli_epi32(b, 8), 24));
+    __m128i refl_cd = _mm_packs_epi32(_mm_srli_epi32(_mm_slli_epi32(c, 8), 24),
+                                      _mm_srli_epi32(_mm_slli_epi32(d, 8), 24));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(reflectivities + i),
+                     _mm_packus_epi16(refl_ab, refl_cd));
+
+    __m128i status_ab = _mm_packs_epi32(_mm_srli_epi32(a, 24), _mm_srli_epi32(b, 24));
+    __m128i status_cd = _mm_packs_epi32(_mm_srli_epi32(c, 24), _mm_srli_epi32(d, 24));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(status_bytes + i),
+                     _mm_packus_epi16(status_ab, status_cd));
+  }
+  decodeScalar(beams + i * BEAM_SIZE,
+               num_beams - i,
+               distances + i,
+               reflectivities + i,
+               status_bytes + i);
+}
+
+// The 256 bit packing instructions operate on each 128 bit half separately, so the 64 bit blocks
+// are put back in order after every pack.
+
+__attribute__((target("avx2"))) void BeamDecoder::decodeAvx2(const uint8_t* beams,
+                                                             std::size_t num_beams,
+                                                             uint16_t* distances,
+                                                             uint8_t* reflectivities,
+                                                             uint8_t* status_bytes)
+{
+  const std::size_t beams_per_iteration = 32;
+  std::size_t i                         = 0;
+  for (; i + beams_per_iteration <= num_beams; i += beams_per_iteration)
+  {
+    const __m256i* src = reinterpret_cast<const __m256i*>(beams + i * BEAM_SIZE);
+    __m256i a          = _mm256_loadu_si256(src + 0);
+    __m256i b          = _mm256_loadu_si256(src + 1);
+    __m256i c          = _mm256_loadu_si256(src + 2);
+    __m256i d          = _mm256_loadu_si256(src + 3);
+
+    __m256i dist_ab = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16),
+                                         _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16));
+    __m256i dist_cd = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(c, 16), 16),
+                                         _mm256_srai_epi32(_mm256_slli_epi32(d, 16), 16));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i + 0),
+                        _mm256_permute4x64_epi64(dist_ab, 0xD8));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i + 16),
+                        _mm256_permute4x64_epi64(dist_cd, 0xD8));
+
+    __m256i refl_ab = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srli_epi32(_mm256_slli_epi32(a, 8), 24),
+                         _mm256_srli_epi32(_mm256_slli_epi32(b, 8), 24)),
+      0xD8);
+    __m256i refl_cd = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srli_epi32(_mm256_slli_epi32(c, 8), 24),
+                         _mm256_srli_epi32(_mm256_slli_epi32(d, 8), 24)),
+      0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(reflectivities + i),
+                        _mm256_permute4x64_epi64(_mm256_packus_epi16(refl_ab, refl_cd), 0xD8));
+
+    __m256i status_ab = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srli_epi32(a, 24), _mm256_srli_epi32(b, 24)), 0xD8);
+    __m256i status_cd = _mm256_permute4x64_epi64(
+      _mm256_packs_epi32(_mm256_srli_epi32(c, 24), _mm256_srli_epi32(d, 24)), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(status_bytes + i),
+                        _mm256_permute4x64_epi64(_mm256_packus_epi16(status_ab, status_cd), 0xD8));
+  }
+  decodeSse2(beams + i * BEAM_SIZE,
+             num_beams - i,
+             distances + i,
+             reflectivities + i,
+             status_bytes + i);
+}
+
+#else
+
+void BeamDecoder::decodeSse2(const uint8_t* beams,
+                             std::size_t num_beams,
+                             uint16_t* distances,
+                             uint8_t* reflectivities,
+                             uint8_t* status_bytes)
+{
+  decodeScalar(beams, num_beams, distances, reflectivities, status_bytes);
+}
+
+void BeamDecoder::decodeAvx2(const uint8_t* beams,
+                             std::size_t num_beams,
+                             uint16_t* distances,
+                             uint8_t* reflectivities,
+                             uint8_t* status_bytes)
+{
+  decodeScalar(beams, num_beams, distances, reflectivities, status_bytes);
+}
+
+#endif
+
+} // namespace data_processing
+} // namespace sick
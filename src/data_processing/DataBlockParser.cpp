@@ -0,0 +1,80 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataBlockParser.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/DataBlockParser.h"
+
+namespace sick {
+namespace data_processing {
+
+DataBlockParser::DataBlockParser()
+  : m_general_system_state_parser_ptr(
+      std::make_shared<sick::data_processing::ParseGeneralSystemState>())
+  , m_measurement_data_parser_ptr(std::make_shared<sick::data_processing::ParseMeasurementData>())
+  , m_intrusion_data_parser_ptr(std::make_shared<sick::data_processing::ParseIntrusionData>())
+  , m_application_data_parser_ptr(std::make_shared<sick::data_processing::ParseApplicationData>())
+{
+}
+
+void DataBlockParser::decodeGeneralSystemState(
+  const datastructure::PacketBuffer& buffer,
+  const datastructure::Data& data,
+  datastructure::GeneralSystemState& general_system_state) const
+{
+  general_system_state = m_general_system_state_parser_ptr->parseUDPSequence(buffer, data);
+}
+
+void DataBlockParser::decodeMeasurementData(const datastructure::PacketBuffer& buffer,
+                                            const datastructure::Data& data,
+                                            datastructure::MeasurementData& measurement_data) const
+{
+  std::lock_guard<std::mutex> lock(m_measurement_data_mutex);
+  m_measurement_data_parser_ptr->parseUDPSequence(buffer, data, measurement_data);
+}
+
+void DataBlockParser::decodeIntrusionData(const datastructure::PacketBuffer& buffer,
+                                          const datastructure::Data& data,
+                                          datastructure::IntrusionData& intrusion_data) const
+{
+  std::lock_guard<std::mutex> lock(m_intrusion_data_mutex);
+  m_intrusion_data_parser_ptr->parseUDPSequence(buffer, data, intrusion_data);
+}
+
+void DataBlockParser::decodeApplicationData(const datastructure::PacketBuffer& buffer,
+                                            const datastructure::Data& data,
+                                            datastructure::ApplicationData& application_data) const
+{
+  application_data = m_application_data_parser_ptr->parseUDPSequence(buffer, data);
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,905 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataView.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/DataView.h"
+
+#include "sick_safetyscanners_base/datastructure/MeasurementData.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sick {
+namespace data_processing {
+
+namespace {
+
+namespace data_header          = data_layout::data_header;
+namespace general_system_state = data_layout::general_system_state;
+namespace derived_values       = data_layout::derived_values;
+namespace measurement_data     = data_layout::measurement_data;
+namespace intrusion_data       = data_layout::intrusion_data;
+namespace application_data     = data_layout::application_data;
+namespace inputs               = data_layout::application_data::inputs;
+namespace outputs              = data_layout::application_data::outputs;
+
+} // namespace
+
+BlockView::BlockView()
+  : m_contiguous(nullptr)
+  , m_fragments(nullptr)
+  , m_offset(0)
+  , m_size(0)
+{
+}
+
+BlockView::BlockView(const uint8_t* contiguous,
+                     const datastructure::PacketBuffer::FragmentVector* fragments,
+                     std::size_t offset,
+                     std::size_t size)
+  : m_contiguous(contiguous)
+  , m_fragments(fragments)
+  , m_offset(offset)
+  , m_size(size)
+{
+}
+
+BlockView BlockView::slice(std::size_t position, std::size_t size) const
+{
+  if (position > m_size || size > m_size - position)
+  {
+    throw sick::runtime_error("Read beyond the end of the data block");
+  }
+  return BlockView(m_contiguous, m_fragments, m_offset + position, size);
+}
+
+bool BlockView::isEmpty() const
+{
+  return m_size == 0;
+}
+
+std::size_t BlockView::getSize() const
+{
+  return m_size;
+}
+
+void BlockView::copyFromFragments(std::size_t offset,
+                                  std::size_t length,
+                                  uint8_t* destination) const
+{
+  std::size_t copied = 0;
+  for (const auto& fragment : *m_fragments)
+  {
+    if (copied == length)
+    {
+      break;
+    }
+    std::size_t position = offset + copied;
+    if (position >= fragment.position + fragment.length)
+    {
+      continue;
+    }
+    std::size_t begin = position - fragment.position;
+    std::size_t count = std::min(fragment.length - begin, length - copied);
+    std::memcpy(destination + copied, fragment.buffer->data() + fragment.offset + begin, count);
+    copied += count;
+  }
+}
+
+DataHeaderView::DataHeaderView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+uint8_t DataHeaderView::getVersionIndicator() const
+{
+  return readField<data_header::VersionIndicator>();
+}
+
+uint8_t DataHeaderView::getVersionMajorVersion() const
+{
+  return readField<data_header::VersionMajorVersion>();
+}
+
+uint8_t DataHeaderView::getVersionMinorVersion() const
+{
+  return readField<data_header::VersionMinorVersion>();
+}
+
+uint8_t DataHeaderView::getVersionRelease() const
+{
+  return readField<data_header::VersionRelease>();
+}
+
+uint32_t DataHeaderView::getSerialNumberOfDevice() const
+{
+  return readField<data_header::SerialNumberOfDevice>();
+}
+
+uint32_t DataHeaderView::getSerialNumberOfSystemPlug() const
+{
+  return readField<data_header::SerialNumberOfSystemPlug>();
+}
+
+uint8_t DataHeaderView::getChannelNumber() const
+{
+  return readField<data_header::ChannelNumber>();
+}
+
+uint32_t DataHeaderView::getSequenceNumber() const
+{
+  return readField<data_header::SequenceNumber>();
+}
+
+uint32_t DataHeaderView::getScanNumber() const
+{
+  return readField<data_header::ScanNumber>();
+}
+
+uint16_t DataHeaderView::getTimestampDate() const
+{
+  return readField<data_header::TimestampDate>();
+}
+
+uint32_t DataHeaderView::getTimestampTime() const
+{
+  return readField<data_header::TimestampTime>();
+}
+
+uint16_t DataHeaderView::getGeneralSystemStateBlockOffset() const
+{
+  return readField<data_header::GeneralSystemStateBlockOffset>();
+}
+
+uint16_t DataHeaderView::getGeneralSystemStateBlockSize() const
+{
+  return readField<data_header::GeneralSystemStateBlockSize>();
+}
+
+uint16_t DataHeaderView::getDerivedValuesBlockOffset() const
+{
+  return readField<data_header::DerivedValuesBlockOffset>();
+}
+
+uint16_t DataHeaderView::getDerivedValuesBlockSize() const
+{
+  return readField<data_header::DerivedValuesBlockSize>();
+}
+
+uint16_t DataHeaderView::getMeasurementDataBlockOffset() const
+{
+  return readField<data_header::MeasurementDataBlockOffset>();
+}
+
+uint16_t DataHeaderView::getMeasurementDataBlockSize() const
+{
+  return readField<data_header::MeasurementDataBlockSize>();
+}
+
+uint16_t DataHeaderView::getIntrusionDataBlockOffset() const
+{
+  return readField<data_header::IntrusionDataBlockOffset>();
+}
+
+uint16_t DataHeaderView::getIntrusionDataBlockSize() const
+{
+  return readField<data_header::IntrusionDataBlockSize>();
+}
+
+uint16_t DataHeaderView::getApplicationDataBlockOffset() const
+{
+  return readField<data_header::ApplicationDataBlockOffset>();
+}
+
+uint16_t DataHeaderView::getApplicationDataBlockSize() const
+{
+  return readField<data_header::ApplicationDataBlockSize>();
+}
+
+GeneralSystemStateView::GeneralSystemStateView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+bool GeneralSystemStateView::getRunModeActive() const
+{
+  return getStatusBit(general_system_state::RUN_MODE_ACTIVE_BIT);
+}
+
+bool GeneralSystemStateView::getStandbyModeActive() const
+{
+  return getStatusBit(general_system_state::STANDBY_MODE_ACTIVE_BIT);
+}
+
+bool GeneralSystemStateView::getContaminationWarning() const
+{
+  return getStatusBit(general_system_state::CONTAMINATION_WARNING_BIT);
+}
+
+bool GeneralSystemStateView::getContaminationError() const
+{
+  return getStatusBit(general_system_state::CONTAMINATION_ERROR_BIT);
+}
+
+bool GeneralSystemStateView::getReferenceContourStatus() const
+{
+  return getStatusBit(general_system_state::REFERENCE_CONTOUR_STATUS_BIT);
+}
+
+bool GeneralSystemStateView::getManipulationStatus() const
+{
+  return getStatusBit(general_system_state::MANIPULATION_STATUS_BIT);
+}
+
+template <typename FieldT>
+datastructure::GeneralSystemState::CutOffPathWord GeneralSystemStateView::readCutOffPath() const
+{
+  // The cut-off paths are transmitted as 24 bit little endian word.
+  static_assert(FieldT::SIZE == 3, "The cut-off paths are transmitted in 3 bytes");
+  uint32_t low  = read<uint16_t>(FieldT::OFFSET);
+  uint32_t high = read<uint8_t>(FieldT::OFFSET + 2);
+  return datastructure::GeneralSystemState::CutOffPathWord(low | (high << 16));
+}
+
+datastructure::GeneralSystemState::CutOffPathWord GeneralSystemStateView::getSafeCutOffPath() const
+{
+  return readCutOffPath<general_system_state::SafeCutOffPath>();
+}
+
+datastructure::GeneralSystemState::CutOffPathWord
+GeneralSystemStateView::getNonSafeCutOffPath() const
+{
+  return readCutOffPath<general_system_state::NonSafeCutOffPath>();
+}
+
+datastructure::GeneralSystemState::CutOffPathWord
+GeneralSystemStateView::getResetRequiredCutOffPath() const
+{
+  return readCutOffPath<general_system_state::ResetRequiredCutOffPath>();
+}
+
+uint8_t GeneralSystemStateView::getCurrentMonitoringCaseNoTable1() const
+{
+  return readField<general_system_state::CurrentMonitoringCaseNoTable1>();
+}
+
+uint8_t GeneralSystemStateView::getCurrentMonitoringCaseNoTable2() const
+{
+  return readField<general_system_state::CurrentMonitoringCaseNoTable2>();
+}
+
+uint8_t GeneralSystemStateView::getCurrentMonitoringCaseNoTable3() const
+{
+  return readField<general_system_state::CurrentMonitoringCaseNoTable3>();
+}
+
+uint8_t GeneralSystemStateView::getCurrentMonitoringCaseNoTable4() const
+{
+  return readField<general_system_state::CurrentMonitoringCaseNoTable4>();
+}
+
+bool GeneralSystemStateView::getApplicationError() const
+{
+  return getErrorBit(general_system_state::APPLICATION_ERROR_BIT);
+}
+
+bool GeneralSystemStateView::getDeviceError() const
+{
+  return getErrorBit(general_system_state::DEVICE_ERROR_BIT);
+}
+
+bool GeneralSystemStateView::getStatusBit(uint8_t bit) const
+{
+  return readField<general_system_state::StatusBits>() & (0x01 << bit);
+}
+
+bool GeneralSystemStateView::getErrorBit(uint8_t bit) const
+{
+  return readField<general_system_state::ErrorBits>() & (0x01 << bit);
+}
+
+DerivedValuesView::DerivedValuesView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+uint16_t DerivedValuesView::getMultiplicationFactor() const
+{
+  return readField<derived_values::MultiplicationFactor>();
+}
+
+uint16_t DerivedValuesView::getNumberOfBeams() const
+{
+  return readField<derived_values::NumberOfBeams>();
+}
+
+uint16_t DerivedValuesView::getScanTime() const
+{
+  return readField<derived_values::ScanTime>();
+}
+
+float DerivedValuesView::getStartAngle() const
+{
+  return static_cast<float>(static_cast<float>(readField<derived_values::StartAngle>()) /
+                            derived_values::ANGLE_RESOLUTION);
+}
+
+float DerivedValuesView::getAngularBeamResolution() const
+{
+  return static_cast<float>(
+    static_cast<float>(readField<derived_values::AngularBeamResolution>()) /
+    derived_values::ANGLE_RESOLUTION);
+}
+
+uint32_t DerivedValuesView::getInterbeamPeriod() const
+{
+  return readField<derived_values::InterbeamPeriod>();
+}
+
+MeasurementDataView::MeasurementDataView()
+  : m_start_angle(0.0f)
+  , m_angular_beam_resolution(0.0f)
+{
+}
+
+MeasurementDataView::MeasurementDataView(
+  const BlockView& block,
+  float start_angle,
+  float angular_beam_resolution,
+  const std::shared_ptr<const datastructure::AngleTable>& angle_table_ptr)
+  : BlockView(block)
+  , m_start_angle(start_angle)
+  , m_angular_beam_resolution(angular_beam_resolution)
+  , m_angle_table_ptr(angle_table_ptr)
+{
+}
+
+uint32_t MeasurementDataView::getNumberOfBeams() const
+{
+  return readField<measurement_data::NumberOfBeams>();
+}
+
+std::size_t MeasurementDataView::getNumberOfScanPoints() const
+{
+  return getNumberOfBeams();
+}
+
+float MeasurementDataView::getAngle(std::size_t index) const
+{
+  if (m_angle_table_ptr && index < m_angle_table_ptr->getNumberOfBeams())
+  {
+    return m_angle_table_ptr->getAnglesVector()[index];
+  }
+  return static_cast<float>(static_cast<double>(m_start_angle) +
+                            static_cast<double>(index) *
+                              static_cast<double>(m_angular_beam_resolution));
+}
+
+uint16_t MeasurementDataView::getDistance(std::size_t index) const
+{
+  return readField<measurement_data::beam::Distance>(getBeamPosition(index));
+}
+
+uint8_t MeasurementDataView::getReflectivity(std::size_t index) const
+{
+  return readField<measurement_data::beam::Reflectivity>(getBeamPosition(index));
+}
+
+uint8_t MeasurementDataView::getStatusByte(std::size_t index) const
+{
+  return readField<measurement_data::beam::StatusByte>(getBeamPosition(index));
+}
+
+datastructure::ScanPoint MeasurementDataView::getScanPoint(std::size_t index) const
+{
+  using datastructure::MeasurementData;
+  std::size_t position       = getBeamPosition(index);
+  uint16_t distance          = readField<measurement_data::beam::Distance>(position);
+  uint8_t reflectivity       = readField<measurement_data::beam::Reflectivity>(position);
+  uint8_t status             = readField<measurement_data::beam::StatusByte>(position);
+  bool valid                 = static_cast<bool>(status & MeasurementData::STATUS_VALID_BIT);
+  bool infinite              = static_cast<bool>(status & MeasurementData::STATUS_INFINITE_BIT);
+  bool glare                 = static_cast<bool>(status & MeasurementData::STATUS_GLARE_BIT);
+  bool reflector             = static_cast<bool>(status & MeasurementData::STATUS_REFLECTOR_BIT);
+  bool contamination =
+    static_cast<bool>(status & MeasurementData::STATUS_CONTAMINATION_BIT);
+  bool contamination_warning =
+    static_cast<bool>(status & MeasurementData::STATUS_CONTAMINATION_WARNING_BIT);
+  return datastructure::ScanPoint(getAngle(index),
+                                  distance,
+                                  reflectivity,
+                                  valid,
+                                  infinite,
+                                  glare,
+                                  reflector,
+                                  contamination,
+                                  contamination_warning);
+}
+
+std::size_t MeasurementDataView::getBeamPosition(std::size_t index) const
+{
+  if (index >= getNumberOfBeams())
+  {
+    throw sick::runtime_error("Beam index out of range");
+  }
+  return measurement_data::BEAMS_OFFSET + index * measurement_data::beam::SIZE;
+}
+
+IntrusionDatumView::IntrusionDatumView()
+  : m_num_scan_points(0)
+{
+}
+
+IntrusionDatumView::IntrusionDatumView(const BlockView& block, std::size_t num_scan_points)
+  : BlockView(block)
+  , m_num_scan_points(num_scan_points)
+{
+}
+
+uint32_t IntrusionDatumView::getSize() const
+{
+  return readField<intrusion_data::datum::Size>();
+}
+
+std::size_t IntrusionDatumView::getNumberOfFlags() const
+{
+  return std::min<std::size_t>(static_cast<std::size_t>(getSize()) * 8, m_num_scan_points);
+}
+
+bool IntrusionDatumView::getFlag(std::size_t index) const
+{
+  if (index >= getNumberOfFlags())
+  {
+    throw sick::runtime_error("Flag index out of range");
+  }
+  return (read<uint8_t>(intrusion_data::datum::FLAGS_OFFSET + index / 8) >> (index % 8)) & 1;
+}
+
+const std::size_t IntrusionDataView::NUM_INTRUSION_DATUMS;
+
+IntrusionDataView::IntrusionDataView()
+  : m_num_scan_points(0)
+  , m_datum_offsets()
+{
+}
+
+IntrusionDataView::IntrusionDataView(const BlockView& block, std::size_t num_scan_points)
+  : BlockView(block)
+  , m_num_scan_points(num_scan_points)
+  , m_datum_offsets()
+{
+  indexIntrusionDatums();
+}
+
+IntrusionDatumView IntrusionDataView::getIntrusionDatum(std::size_t index) const
+{
+  if (index >= NUM_INTRUSION_DATUMS)
+  {
+    throw sick::runtime_error("Intrusion datum index out of range");
+  }
+  std::size_t position = m_datum_offsets[index];
+  std::size_t size =
+    intrusion_data::datum::FLAGS_OFFSET + readField<intrusion_data::datum::Size>(position);
+  return IntrusionDatumView(slice(position, size), m_num_scan_points);
+}
+
+void IntrusionDataView::indexIntrusionDatums()
+{
+  if (isEmpty())
+  {
+    return;
+  }
+  std::size_t position = 0;
+  for (std::size_t i = 0; i < NUM_INTRUSION_DATUMS; ++i)
+  {
+    std::size_t size = readField<intrusion_data::datum::Size>(position);
+    if (size > getSize() - position - intrusion_data::datum::FLAGS_OFFSET)
+    {
+      throw sick::runtime_error("An intrusion datum lies beyond the end of the intrusion data");
+    }
+    m_datum_offsets[i] = static_cast<uint32_t>(position);
+    position += intrusion_data::datum::FLAGS_OFFSET + size;
+  }
+}
+
+ApplicationInputsView::ApplicationInputsView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+datastructure::ApplicationInputs::UnsafeInputsWord
+ApplicationInputsView::getUnsafeInputsInputSources() const
+{
+  return datastructure::ApplicationInputs::UnsafeInputsWord(
+    readField<inputs::UnsafeInputsInputSources>());
+}
+
+datastructure::ApplicationInputs::UnsafeInputsWord
+ApplicationInputsView::getUnsafeInputsFlags() const
+{
+  return datastructure::ApplicationInputs::UnsafeInputsWord(readField<inputs::UnsafeInputsFlags>());
+}
+
+uint16_t ApplicationInputsView::getMonitoringCase(std::size_t index) const
+{
+  if (index >= datastructure::ApplicationInputs::MonitoringCaseArray().size())
+  {
+    throw sick::runtime_error("Monitoring case index out of range");
+  }
+  return readField<inputs::MonitoringCases>(index * inputs::MonitoringCases::SIZE);
+}
+
+datastructure::ApplicationInputs::MonitoringCaseFlagsWord
+ApplicationInputsView::getMonitoringCaseFlags() const
+{
+  return datastructure::ApplicationInputs::MonitoringCaseFlagsWord(
+    readField<inputs::MonitoringCaseFlags>());
+}
+
+int16_t ApplicationInputsView::getVelocity0() const
+{
+  return readField<inputs::Velocity0>();
+}
+
+int16_t ApplicationInputsView::getVelocity1() const
+{
+  return readField<inputs::Velocity1>();
+}
+
+bool ApplicationInputsView::getVelocity0Valid() const
+{
+  return getVelocityFlag(application_data::VELOCITY_0_VALID_BIT);
+}
+
+bool ApplicationInputsView::getVelocity1Valid() const
+{
+  return getVelocityFlag(application_data::VELOCITY_1_VALID_BIT);
+}
+
+bool ApplicationInputsView::getVelocity0TransmittedSafely() const
+{
+  return getVelocityFlag(application_data::VELOCITY_0_TRANSMITTED_SAFELY_BIT);
+}
+
+bool ApplicationInputsView::getVelocity1TransmittedSafely() const
+{
+  return getVelocityFlag(application_data::VELOCITY_1_TRANSMITTED_SAFELY_BIT);
+}
+
+int8_t ApplicationInputsView::getSleepModeInput() const
+{
+  return readField<inputs::SleepModeInput>();
+}
+
+bool ApplicationInputsView::getVelocityFlag(uint8_t bit) const
+{
+  return readField<inputs::VelocityFlags>() & (0x01 << bit);
+}
+
+ApplicationOutputsView::ApplicationOutputsView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+datastructure::ApplicationOutputs::EvalOutWord ApplicationOutputsView::getEvalOut() const
+{
+  return datastructure::ApplicationOutputs::EvalOutWord(readField<outputs::EvalOut>());
+}
+
+datastructure::ApplicationOutputs::EvalOutWord ApplicationOutputsView::getEvalOutIsSafe() const
+{
+  return datastructure::ApplicationOutputs::EvalOutWord(readField<outputs::EvalOutIsSafe>());
+}
+
+datastructure::ApplicationOutputs::EvalOutWord ApplicationOutputsView::getEvalOutIsValid() const
+{
+  return datastructure::ApplicationOutputs::EvalOutWord(readField<outputs::EvalOutIsValid>());
+}
+
+uint16_t ApplicationOutputsView::getMonitoringCase(std::size_t index) const
+{
+  if (index >= datastructure::ApplicationOutputs::MonitoringCaseArray().size())
+  {
+    throw sick::runtime_error("Monitoring case index out of range");
+  }
+  return readField<outputs::MonitoringCases>(index * outputs::MonitoringCases::SIZE);
+}
+
+datastructure::ApplicationOutputs::MonitoringCaseFlagsWord
+ApplicationOutputsView::getMonitoringCaseFlags() const
+{
+  return datastructure::ApplicationOutputs::MonitoringCaseFlagsWord(
+    readField<outputs::MonitoringCaseFlags>());
+}
+
+int8_t ApplicationOutputsView::getSleepModeOutput() const
+{
+  return readField<outputs::SleepModeOutput>();
+}
+
+bool ApplicationOutputsView::getHostErrorFlagContaminationWarning() const
+{
+  return getHostErrorFlag(outputs::CONTAMINATION_WARNING_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlagContaminationError() const
+{
+  return getHostErrorFlag(outputs::CONTAMINATION_ERROR_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlagManipulationError() const
+{
+  return getHostErrorFlag(outputs::MANIPULATION_ERROR_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlagGlare() const
+{
+  return getHostErrorFlag(outputs::GLARE_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlagReferenceContourIntruded() const
+{
+  return getHostErrorFlag(outputs::REFERENCE_CONTOUR_INTRUDED_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlagCriticalError() const
+{
+  return getHostErrorFlag(outputs::CRITICAL_ERROR_BIT);
+}
+
+int16_t ApplicationOutputsView::getVelocity0() const
+{
+  return readField<outputs::Velocity0>();
+}
+
+int16_t ApplicationOutputsView::getVelocity1() const
+{
+  return readField<outputs::Velocity1>();
+}
+
+bool ApplicationOutputsView::getVelocity0Valid() const
+{
+  return getVelocityFlag(application_data::VELOCITY_0_VALID_BIT);
+}
+
+bool ApplicationOutputsView::getVelocity1Valid() const
+{
+  return getVelocityFlag(application_data::VELOCITY_1_VALID_BIT);
+}
+
+bool ApplicationOutputsView::getVelocity0TransmittedSafely() const
+{
+  return getVelocityFlag(application_data::VELOCITY_0_TRANSMITTED_SAFELY_BIT);
+}
+
+bool ApplicationOutputsView::getVelocity1TransmittedSafely() const
+{
+  return getVelocityFlag(application_data::VELOCITY_1_TRANSMITTED_SAFELY_BIT);
+}
+
+int16_t ApplicationOutputsView::getResultingVelocity(std::size_t index) const
+{
+  if (index >= datastructure::ApplicationOutputs::ResultingVelocityArray().size())
+  {
+    throw sick::runtime_error("Resulting velocity index out of range");
+  }
+  return readField<outputs::ResultingVelocities>(index * outputs::ResultingVelocities::SIZE);
+}
+
+datastructure::ApplicationOutputs::ResultingVelocityFlagsWord
+ApplicationOutputsView::getResultingVelocityIsValid() const
+{
+  return datastructure::ApplicationOutputs::ResultingVelocityFlagsWord(
+    readField<outputs::ResultingVelocityFlags>());
+}
+
+bool ApplicationOutputsView::getFlagsSleepModeOutputIsValid() const
+{
+  return readField<outputs::OutputFlags>() & (0x01 << outputs::SLEEP_MODE_OUTPUT_IS_VALID_BIT);
+}
+
+bool ApplicationOutputsView::getFlagsHostErrorFlagsAreValid() const
+{
+  return readField<outputs::OutputFlags>() & (0x01 << outputs::HOST_ERROR_FLAGS_ARE_VALID_BIT);
+}
+
+bool ApplicationOutputsView::getHostErrorFlag(uint8_t bit) const
+{
+  return readField<outputs::HostErrorFlags>() & (0x01 << bit);
+}
+
+bool ApplicationOutputsView::getVelocityFlag(uint8_t bit) const
+{
+  return readField<outputs::VelocityFlags>() & (0x01 << bit);
+}
+
+ApplicationDataView::ApplicationDataView(const BlockView& block)
+  : BlockView(block)
+{
+}
+
+ApplicationInputsView ApplicationDataView::getInputs() const
+{
+  return ApplicationInputsView(*this);
+}
+
+ApplicationOutputsView ApplicationDataView::getOutputs() const
+{
+  return ApplicationOutputsView(*this);
+}
+
+DataView::DataView(const datastructure::PacketBuffer& buffer)
+  : m_contiguous(nullptr)
+  , m_fragments(nullptr)
+  , m_length(buffer.getLength())
+{
+  if (buffer.isFragmented())
+  {
+    m_fragments = &buffer.getFragments();
+  }
+  else
+  {
+    m_contiguous = buffer.getStorage()->data();
+  }
+
+  if (m_length < DataHeaderView::SIZE)
+  {
+    throw sick::runtime_error("The packet buffer is shorter than the data header");
+  }
+  DataHeaderView header = getDataHeader();
+  m_blocks[GENERAL_SYSTEM_STATE] = {header.getGeneralSystemStateBlockOffset(),
+                                    header.getGeneralSystemStateBlockSize()};
+  m_blocks[DERIVED_VALUES]       = {header.getDerivedValuesBlockOffset(),
+                                    header.getDerivedValuesBlockSize()};
+  m_blocks[MEASUREMENT_DATA]     = {header.getMeasurementDataBlockOffset(),
+                                    header.getMeasurementDataBlockSize()};
+  m_blocks[INTRUSION_DATA]       = {header.getIntrusionDataBlockOffset(),
+                                    header.getIntrusionDataBlockSize()};
+  m_blocks[APPLICATION_DATA]     = {header.getApplicationDataBlockOffset(),
+                                    header.getApplicationDataBlockSize()};
+  for (const auto& entry : m_blocks)
+  {
+    if (static_cast<std::size_t>(entry.offset) + entry.size > m_length)
+    {
+      throw sick::runtime_error("A data block lies beyond the end of the packet buffer");
+    }
+  }
+  if (hasIntrusionData())
+  {
+    m_intrusion_data =
+      IntrusionDataView(getBlock(INTRUSION_DATA), getDerivedValues().getNumberOfBeams());
+  }
+}
+
+void DataView::setAngleTablePtr(
+  const std::shared_ptr<const datastructure::AngleTable>& angle_table_ptr)
+{
+  m_angle_table_ptr = angle_table_ptr;
+}
+
+bool DataView::hasDataHeader() const
+{
+  return true;
+}
+
+DataHeaderView DataView::getDataHeader() const
+{
+  return DataHeaderView(getBlock(0, DataHeaderView::SIZE));
+}
+
+bool DataView::hasGeneralSystemState() const
+{
+  return isPublished(GENERAL_SYSTEM_STATE);
+}
+
+GeneralSystemStateView DataView::getGeneralSystemState() const
+{
+  return GeneralSystemStateView(getBlock(GENERAL_SYSTEM_STATE));
+}
+
+bool DataView::hasDerivedValues() const
+{
+  return isPublished(DERIVED_VALUES);
+}
+
+DerivedValuesView DataView::getDerivedValues() const
+{
+  return DerivedValuesView(getBlock(DERIVED_VALUES));
+}
+
+bool DataView::hasMeasurementData() const
+{
+  return isPublished(MEASUREMENT_DATA) && hasDerivedValues();
+}
+
+MeasurementDataView DataView::getMeasurementData() const
+{
+  if (!hasMeasurementData())
+  {
+    return MeasurementDataView();
+  }
+  DerivedValuesView derived_values = getDerivedValues();
+  BlockView block                  = getBlock(MEASUREMENT_DATA);
+  float start_angle                = derived_values.getStartAngle();
+  float angular_beam_resolution    = derived_values.getAngularBeamResolution();
+  MeasurementDataView measurement_data(block, start_angle, angular_beam_resolution);
+  if (m_angle_table_ptr && block.getSize() >= sizeof(uint32_t) &&
+      m_angle_table_ptr->matches(
+        start_angle, angular_beam_resolution, measurement_data.getNumberOfBeams()))
+  {
+    measurement_data =
+      MeasurementDataView(block, start_angle, angular_beam_resolution, m_angle_table_ptr);
+  }
+  return measurement_data;
+}
+
+bool DataView::hasIntrusionData() const
+{
+  return isPublished(INTRUSION_DATA) && hasDerivedValues();
+}
+
+IntrusionDataView DataView::getIntrusionData() const
+{
+  return m_intrusion_data;
+}
+
+bool DataView::hasApplicationData() const
+{
+  return isPublished(APPLICATION_DATA);
+}
+
+ApplicationDataView DataView::getApplicationData() const
+{
+  return ApplicationDataView(getBlock(APPLICATION_DATA));
+}
+
+BlockView DataView::getBlock(std::size_t offset, std::size_t size) const
+{
+  return BlockView(m_contiguous, m_fragments, offset, size);
+}
+
+BlockView DataView::getBlock(Block block) const
+{
+  if (!isPublished(block))
+  {
+    return BlockView();
+  }
+  return getBlock(m_blocks[block].offset, m_blocks[block].size);
+}
+
+bool DataView::isPublished(Block block) const
+{
+  return !(m_blocks[block].offset == 0 && m_blocks[block].size == 0);
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -0,0 +1,134 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PacketBufferCursor.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/PacketBufferCursor.h"
+#include "sick_safetyscanners_base/Exceptions.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace data_processing {
+
+PacketBufferCursor::PacketBufferCursor(const sick::datastructure::PacketBuffer& buffer)
+  : m_contiguous_buffer()
+  , m_fragments(buffer.getFragments())
+  , m_length(buffer.getLength())
+  , m_fragment_index(0)
+  , m_scratch()
+  , m_num_copies(0)
+{
+  if (!buffer.isFragmented())
+  {
+    m_contiguous_buffer = buffer.getStorage();
+  }
+}
+
+std::size_t PacketBufferCursor::getLength() const
+{
+  return m_length;
+}
+
+std::size_t PacketBufferCursor::getNumCopies() const
+{
+  return m_num_copies;
+}
+
+read_write_helper::ConstByteSpan PacketBufferCursor::getContiguous(std::size_t offset,
+                                                                   std::size_t length)
+{
+  if (offset > m_length || length > m_length - offset)
+  {
+    throw sick::runtime_error("Read beyond the end of the packet buffer");
+  }
+  if (m_contiguous_buffer)
+  {
+    return read_write_helper::ConstByteSpan(m_contiguous_buffer->data() + offset, length);
+  }
+  if (length == 0)
+  {
+    return read_write_helper::ConstByteSpan();
+  }
+
+  seekFragment(offset);
+  const auto& fragment = m_fragments[m_fragment_index];
+  if (offset + length <= fragment.position + fragment.length)
+  {
+    return read_write_helper::ConstByteSpan(
+      fragment.buffer->data() + fragment.offset + (offset - fragment.position), length);
+  }
+
+  // The range straddles a fragment boundary and is gathered in the scratch buffer.
+  ++m_num_copies;
+  m_scratch.resize(length);
+  std::size_t copied = 0;
+  for (std::size_t i = m_fragment_index; copied < length; ++i)
+  {
+    const auto& part  = m_fragments[i];
+    std::size_t begin = offset + copied - part.position;
+    std::size_t count = std::min(part.length - begin, length - copied);
+    auto part_begin   = part.buffer->begin() + part.offset + begin;
+    std::copy(part_begin, part_begin + count, m_scratch.begin() + copied);
+    copied += count;
+  }
+  return read_write_helper::ConstByteSpan(m_scratch.data(), length);
+}
+
+std::size_t PacketBufferCursor::getContiguousLength(std::size_t offset)
+{
+  if (offset >= m_length)
+  {
+    return 0;
+  }
+  if (m_contiguous_buffer)
+  {
+    return m_length - offset;
+  }
+  seekFragment(offset);
+  const auto& fragment = m_fragments[m_fragment_index];
+  return fragment.position + fragment.length - offset;
+}
+
+void PacketBufferCursor::seekFragment(std::size_t offset)
+{
+  // Parsers mostly read forward, so the search continues at the previously used fragment.
+  if (m_fragments[m_fragment_index].position > offset)
+  {
+    m_fragment_index = 0;
+  }
+  while (m_fragments[m_fragment_index].position + m_fragments[m_fragment_index].length <= offset)
+  {
+    ++m_fragment_index;
+  }
+}
+
+} // namespace data_processing
+} // namespace sick
@@ -34,14 +34,22 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseApplicationData.h"
 
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
+namespace layout        = data_layout::application_data;
+namespace input_layout  = data_layout::application_data::inputs;
+namespace output_layout = data_layout::application_data::outputs;
+
 ParseApplicationData::ParseApplicationData() {}
 
 datastructure::ApplicationData
 ParseApplicationData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                       datastructure::Data& data) const
+                                       const datastructure::Data& data) const
 {
   datastructure::ApplicationData application_data;
 
@@ -50,10 +58,10 @@ ParseApplicationData::parseUDPSequence(const datastructure::PacketBuffer& buffer
     application_data.setIsEmpty(true);
     return application_data;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
-  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getApplicationDataBlockOffset();
+  PacketBufferCursor cursor(buffer);
+  read_write_helper::ConstByteSpan data_ptr =
+    cursor.getContiguous(data.getDataHeader().getApplicationDataBlockOffset(),
+                         data.getDataHeader().getApplicationDataBlockSize());
 
   setDataInApplicationData(data_ptr, application_data);
   return application_data;
@@ -74,18 +82,18 @@ bool ParseApplicationData::checkIfPreconditionsAreMet(const datastructure::Data&
 
 bool ParseApplicationData::checkIfApplicationDataIsPublished(const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->getApplicationDataBlockOffset() == 0 &&
-           data.getDataHeaderPtr()->getApplicationDataBlockSize() == 0);
+  return !(data.getDataHeader().getApplicationDataBlockOffset() == 0 &&
+           data.getDataHeader().getApplicationDataBlockSize() == 0);
 }
 
 bool ParseApplicationData::checkIfDataContainsNeededParsedBlocks(
   const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->isEmpty());
+  return !(data.getDataHeader().isEmpty());
 }
 
 void ParseApplicationData::setDataInApplicationData(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::ApplicationData& application_data) const
 {
   setApplicationInputsInApplicationData(data_ptr, application_data);
@@ -93,25 +101,25 @@ void ParseApplicationData::setDataInApplicationData(
 }
 
 void ParseApplicationData::setApplicationInputsInApplicationData(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::ApplicationData& application_data) const
 {
   datastructure::ApplicationInputs inputs;
   setDataInApplicationInputs(data_ptr, inputs);
-  application_data.setInputs(inputs);
+  application_data.setInputs(std::move(inputs));
 }
 
 void ParseApplicationData::setApplicationOutputsInApplicationData(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::ApplicationData& application_data) const
 {
   datastructure::ApplicationOutputs outputs;
   setDataInApplicationOutputs(data_ptr, outputs);
-  application_data.setOutputs(outputs);
+  application_data.setOutputs(std::move(outputs));
 }
 
 void ParseApplicationData::setDataInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
   setUnsafeInputsInApplicationInputs(data_ptr, inputs);
   setMonitoringCaseInputsInApplicationInputs(data_ptr, inputs);
@@ -120,7 +128,7 @@ void ParseApplicationData::setDataInApplicationInputs(
 }
 
 void ParseApplicationData::setDataInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
   setEvalutaionPathsOutputsInApplicationOutputs(data_ptr, outputs);
   setMonitoringCaseOutputsInApplicationOutputs(data_ptr, outputs);
@@ -132,70 +140,58 @@ void ParseApplicationData::setDataInApplicationOutputs(
 }
 
 void ParseApplicationData::setUnsafeInputsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
   setUnsafeInputsSourcesInApplicationInputs(data_ptr, inputs);
   setUnsafeInputsFlagsInApplicationInputs(data_ptr, inputs);
 }
 
 void ParseApplicationData::setUnsafeInputsSourcesInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 0);
-  std::vector<bool> input_sources;
-  for (uint8_t i = 0; i < 32; i++)
-  {
-    input_sources.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  inputs.setUnsafeInputsInputSourcesVector(input_sources);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + input_layout::UnsafeInputsInputSources::OFFSET);
+  inputs.setUnsafeInputsInputSources(datastructure::ApplicationInputs::UnsafeInputsWord(word32));
 }
 
 void ParseApplicationData::setUnsafeInputsFlagsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 4);
-  std::vector<bool> input_flags;
-  for (uint8_t i = 0; i < 32; i++)
-  {
-    input_flags.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  inputs.setUnsafeInputsFlagsVector(input_flags);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + input_layout::UnsafeInputsFlags::OFFSET);
+  inputs.setUnsafeInputsFlags(datastructure::ApplicationInputs::UnsafeInputsWord(word32));
 }
 
 void ParseApplicationData::setMonitoringCaseInputsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
   setMonitoringCaseNumbersInApplicationInputs(data_ptr, inputs);
   setMonitoringCaseFlagsInApplicationInputs(data_ptr, inputs);
 }
 
 void ParseApplicationData::setMonitoringCaseNumbersInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  std::vector<uint16_t> monitoring_cases;
-  for (uint8_t i = 0; i < 20; i++)
+  datastructure::ApplicationInputs::MonitoringCaseArray monitoring_cases;
+  for (std::size_t i = 0; i < monitoring_cases.size(); i++)
   {
-    monitoring_cases.push_back(read_write_helper::readUint16LittleEndian(data_ptr + 12 + i * 2));
+    monitoring_cases[i] = read_write_helper::readUint16LittleEndian(
+      data_ptr + input_layout::MonitoringCases::OFFSET + i * input_layout::MonitoringCases::SIZE);
   }
-  inputs.setMonitoringCaseVector(monitoring_cases);
+  inputs.setMonitoringCases(monitoring_cases);
 }
 
 
 void ParseApplicationData::setMonitoringCaseFlagsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 52);
-  std::vector<bool> monitoring_flags;
-  // 20 for each case one
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    monitoring_flags.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  inputs.setMonitoringCaseFlagsVector(monitoring_flags);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + input_layout::MonitoringCaseFlags::OFFSET);
+  inputs.setMonitoringCaseFlags(datastructure::ApplicationInputs::MonitoringCaseFlagsWord(word32));
 }
 
 void ParseApplicationData::setLinearVelocityInputsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
   setLinearVelocity0InApplicationInputs(data_ptr, inputs);
   setLinearVelocity1InApplicationInputs(data_ptr, inputs);
@@ -203,38 +199,44 @@ void ParseApplicationData::setLinearVelocityInputsInApplicationInputs(
 }
 
 void ParseApplicationData::setLinearVelocity0InApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  inputs.setVelocity0(read_write_helper::readUint16LittleEndian(data_ptr + 56));
+  inputs.setVelocity0(read_write_helper::readUint16LittleEndian(
+    data_ptr + input_layout::Velocity0::OFFSET));
 }
 
 void ParseApplicationData::setLinearVelocity1InApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  inputs.setVelocity1(read_write_helper::readUint16LittleEndian(data_ptr + 58));
+  inputs.setVelocity1(read_write_helper::readUint16LittleEndian(
+    data_ptr + input_layout::Velocity1::OFFSET));
 }
 
 void ParseApplicationData::setLinearVelocityFlagsInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  uint8_t word8 = read_write_helper::readUint8LittleEndian(data_ptr + 60);
+  uint8_t word8 = read_write_helper::readUint8LittleEndian(
+    data_ptr + input_layout::VelocityFlags::OFFSET);
 
-  inputs.setVelocity0Valid(static_cast<bool>(word8 & (0x01 << 0)));
-  inputs.setVelocity1Valid(static_cast<bool>(word8 & (0x01 << 1)));
+  inputs.setVelocity0Valid(static_cast<bool>(word8 & (0x01 << layout::VELOCITY_0_VALID_BIT)));
+  inputs.setVelocity1Valid(static_cast<bool>(word8 & (0x01 << layout::VELOCITY_1_VALID_BIT)));
   // reserved bits 2,3
-  inputs.setVelocity0TransmittedSafely(static_cast<bool>(word8 & (0x01 << 4)));
-  inputs.setVelocity1TransmittedSafely(static_cast<bool>(word8 & (0x01 << 5)));
+  inputs.setVelocity0TransmittedSafely(
+    static_cast<bool>(word8 & (0x01 << layout::VELOCITY_0_TRANSMITTED_SAFELY_BIT)));
+  inputs.setVelocity1TransmittedSafely(
+    static_cast<bool>(word8 & (0x01 << layout::VELOCITY_1_TRANSMITTED_SAFELY_BIT)));
 }
 
 void ParseApplicationData::setSleepModeInputInApplicationInputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationInputs& inputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationInputs& inputs) const
 {
-  inputs.setSleepModeInput(read_write_helper::readUint8LittleEndian(data_ptr + 74));
+  inputs.setSleepModeInput(read_write_helper::readUint8LittleEndian(
+    data_ptr + input_layout::SleepModeInput::OFFSET));
 }
 
 
 void ParseApplicationData::setEvalutaionPathsOutputsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
   setEvaluationPathsOutputsEvalOutInApplicationOutputs(data_ptr, outputs);
   setEvaluationPathsOutputsIsSafeInApplicationOutputs(data_ptr, outputs);
@@ -242,101 +244,87 @@ void ParseApplicationData::setEvalutaionPathsOutputsInApplicationOutputs(
 }
 
 void ParseApplicationData::setEvaluationPathsOutputsEvalOutInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 140);
-
-  std::vector<bool> eval_out;
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    eval_out.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  outputs.setEvalOutVector(eval_out);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + output_layout::EvalOut::OFFSET);
+  outputs.setEvalOut(datastructure::ApplicationOutputs::EvalOutWord(word32));
 }
 
 void ParseApplicationData::setEvaluationPathsOutputsIsSafeInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 144);
-
-  std::vector<bool> eval_out_is_safe;
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    eval_out_is_safe.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  outputs.setEvalOutIsSafeVector(eval_out_is_safe);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + output_layout::EvalOutIsSafe::OFFSET);
+  outputs.setEvalOutIsSafe(datastructure::ApplicationOutputs::EvalOutWord(word32));
 }
 
 
 void ParseApplicationData::setEvaluationPathsOutputsValidFlagsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 148);
-
-  std::vector<bool> eval_out_is_valid;
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    eval_out_is_valid.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  outputs.setEvalOutIsValidVector(eval_out_is_valid);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + output_layout::EvalOutIsValid::OFFSET);
+  outputs.setEvalOutIsValid(datastructure::ApplicationOutputs::EvalOutWord(word32));
 }
 
 void ParseApplicationData::setMonitoringCaseOutputsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
   setMonitoringCaseNumbersInApplicationOutputs(data_ptr, outputs);
   setMonitoringCaseFlagsInApplicationOutputs(data_ptr, outputs);
 }
 
 void ParseApplicationData::setMonitoringCaseNumbersInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  std::vector<uint16_t> output_monitoring_cases;
-
-  for (uint8_t i = 0; i < 20; i++)
+  datastructure::ApplicationOutputs::MonitoringCaseArray output_monitoring_cases;
+  for (std::size_t i = 0; i < output_monitoring_cases.size(); i++)
   {
-    output_monitoring_cases.push_back(
-      read_write_helper::readUint16LittleEndian(data_ptr + 152 + i * 2));
+    output_monitoring_cases[i] = read_write_helper::readUint16LittleEndian(
+      data_ptr + output_layout::MonitoringCases::OFFSET + i * output_layout::MonitoringCases::SIZE);
   }
-  outputs.setMonitoringCaseVector(output_monitoring_cases);
+  outputs.setMonitoringCases(output_monitoring_cases);
 }
 
 
 void ParseApplicationData::setMonitoringCaseFlagsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 192);
-
-  std::vector<bool> output_monitoring_flags;
-  // 20 for each case one
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    output_monitoring_flags.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  outputs.setMonitoringCaseFlagsVector(output_monitoring_flags);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + output_layout::MonitoringCaseFlags::OFFSET);
+  outputs.setMonitoringCaseFlags(
+    datastructure::ApplicationOutputs::MonitoringCaseFlagsWord(word32));
 }
 
 void ParseApplicationData::setSleepModeOutputInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  outputs.setSleepModeOutput(read_write_helper::readUint8LittleEndian(data_ptr + 193));
+  outputs.setSleepModeOutput(read_write_helper::readUint8LittleEndian(
+    data_ptr + output_layout::SleepModeOutput::OFFSET));
 }
 
 void ParseApplicationData::setErrorFlagsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint8_t word8 = read_write_helper::readUint8LittleEndian(data_ptr + 194);
+  uint8_t word8 = read_write_helper::readUint8LittleEndian(
+    data_ptr + output_layout::HostErrorFlags::OFFSET);
 
-  outputs.setHostErrorFlagContaminationWarning(static_cast<bool>(word8 & (0x01 << 0)));
-  outputs.setHostErrorFlagContaminationError(static_cast<bool>(word8 & (0x01 << 1)));
-  outputs.setHostErrorFlagManipulationError(static_cast<bool>(word8 & (0x01 << 2)));
-  outputs.setHostErrorFlagGlare(static_cast<bool>(word8 & (0x01 << 3)));
-  outputs.setHostErrorFlagReferenceContourIntruded(static_cast<bool>(word8 & (0x01 << 4)));
-  outputs.setHostErrorFlagCriticalError(static_cast<bool>(word8 & (0x01 << 5)));
+  outputs.setHostErrorFlagContaminationWarning(
+    static_cast<bool>(word8 & (0x01 << output_layout::CONTAMINATION_WARNING_BIT)));
+  outputs.setHostErrorFlagContaminationError(
+    static_cast<bool>(word8 & (0x01 << output_layout::CONTAMINATION_ERROR_BIT)));
+  outputs.setHostErrorFlagManipulationError(
+    static_cast<bool>(word8 & (0x01 << output_layout::MANIPULATION_ERROR_BIT)));
+  outputs.setHostErrorFlagGlare(static_cast<bool>(word8 & (0x01 << output_layout::GLARE_BIT)));
+  outputs.setHostErrorFlagReferenceContourIntruded(
+    static_cast<bool>(word8 & (0x01 << output_layout::REFERENCE_CONTOUR_INTRUDED_BIT)));
+  outputs.setHostErrorFlagCriticalError(
+    static_cast<bool>(word8 & (0x01 << output_layout::CRITICAL_ERROR_BIT)));
 }
 
 void ParseApplicationData::setLinearVelocityOutoutsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
   setLinearVelocity0InApplicationOutputs(data_ptr, outputs);
   setLinearVelocity1InApplicationOutputs(data_ptr, outputs);
@@ -344,70 +332,74 @@ void ParseApplicationData::setLinearVelocityOutoutsInApplicationOutputs(
 }
 
 void ParseApplicationData::setLinearVelocity0InApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  outputs.setVelocity0(read_write_helper::readUint16LittleEndian(data_ptr + 200));
+  outputs.setVelocity0(read_write_helper::readUint16LittleEndian(
+    data_ptr + output_layout::Velocity0::OFFSET));
 }
 
 void ParseApplicationData::setLinearVelocity1InApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  outputs.setVelocity1(read_write_helper::readUint16LittleEndian(data_ptr + 202));
+  outputs.setVelocity1(read_write_helper::readUint16LittleEndian(
+    data_ptr + output_layout::Velocity1::OFFSET));
 }
 
 void ParseApplicationData::setLinearVelocityFlagsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint8_t word8 = read_write_helper::readUint8LittleEndian(data_ptr + 204);
+  uint8_t word8 = read_write_helper::readUint8LittleEndian(
+    data_ptr + output_layout::VelocityFlags::OFFSET);
 
-  outputs.setVelocity0Valid(static_cast<bool>(word8 & (0x01 << 0)));
-  outputs.setVelocity1Valid(static_cast<bool>(word8 & (0x01 << 1)));
+  outputs.setVelocity0Valid(static_cast<bool>(word8 & (0x01 << layout::VELOCITY_0_VALID_BIT)));
+  outputs.setVelocity1Valid(static_cast<bool>(word8 & (0x01 << layout::VELOCITY_1_VALID_BIT)));
   // reserved bits 2,3
-  outputs.setVelocity0TransmittedSafely(static_cast<bool>(word8 & (0x01 << 4)));
-  outputs.setVelocity1TransmittedSafely(static_cast<bool>(word8 & (0x01 << 5)));
+  outputs.setVelocity0TransmittedSafely(
+    static_cast<bool>(word8 & (0x01 << layout::VELOCITY_0_TRANSMITTED_SAFELY_BIT)));
+  outputs.setVelocity1TransmittedSafely(
+    static_cast<bool>(word8 & (0x01 << layout::VELOCITY_1_TRANSMITTED_SAFELY_BIT)));
   // reserved bits 6,7
 }
 
 void ParseApplicationData::setResultingVelocityOutputsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
   setResultingVelocityInApplicationOutputs(data_ptr, outputs);
   setResultingVelocityFlagsInApplicationOutputs(data_ptr, outputs);
 }
 
 void ParseApplicationData::setResultingVelocityInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  std::vector<int16_t> resulting_velocities;
-  for (uint8_t i = 0; i < 20; i++)
+  datastructure::ApplicationOutputs::ResultingVelocityArray resulting_velocities;
+  for (std::size_t i = 0; i < resulting_velocities.size(); i++)
   {
-    resulting_velocities.push_back(
-      read_write_helper::readInt16LittleEndian(data_ptr + 208 + i * 2));
+    resulting_velocities[i] = read_write_helper::readInt16LittleEndian(
+      data_ptr + output_layout::ResultingVelocities::OFFSET +
+      i * output_layout::ResultingVelocities::SIZE);
   }
-  outputs.setResultingVelocityVector(resulting_velocities);
+  outputs.setResultingVelocities(resulting_velocities);
 }
 
 void ParseApplicationData::setResultingVelocityFlagsInApplicationOutputs(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint32_t word32 = read_write_helper::readUint32LittleEndian(data_ptr + 248);
-
-  std::vector<bool> resulting_velocities_flags;
-  // 20 for each case one
-  for (uint8_t i = 0; i < 20; i++)
-  {
-    resulting_velocities_flags.push_back(static_cast<bool>(word32 & (0x01 << i)));
-  }
-  outputs.setResultingVelocityIsValidVector(resulting_velocities_flags);
+  uint32_t word32 = read_write_helper::readUint32LittleEndian(
+    data_ptr + output_layout::ResultingVelocityFlags::OFFSET);
+  outputs.setResultingVelocityIsValid(
+    datastructure::ApplicationOutputs::ResultingVelocityFlagsWord(word32));
 }
 
 void ParseApplicationData::setOutputFlagsinApplicationOutput(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::ApplicationOutputs& outputs) const
+  read_write_helper::ConstByteSpan data_ptr, datastructure::ApplicationOutputs& outputs) const
 {
-  uint8_t word8 = read_write_helper::readUint8LittleEndian(data_ptr + 259);
+  uint8_t word8 = read_write_helper::readUint8LittleEndian(
+    data_ptr + output_layout::OutputFlags::OFFSET);
 
-  outputs.setFlagsSleepModeOutputIsValid(static_cast<bool>(word8 & (0x01 << 0)));
-  outputs.setFlagsHostErrorFlagsAreValid(static_cast<bool>(word8 & (0x01 << 1)));
+  outputs.setFlagsSleepModeOutputIsValid(
+    static_cast<bool>(word8 & (0x01 << output_layout::SLEEP_MODE_OUTPUT_IS_VALID_BIT)));
+  outputs.setFlagsHostErrorFlagsAreValid(
+    static_cast<bool>(word8 & (0x01 << output_layout::HOST_ERROR_FLAGS_ARE_VALID_BIT)));
 }
 
 
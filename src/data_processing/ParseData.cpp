@@ -34,10 +34,13 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseData.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
 ParseData::ParseData()
+  : m_parse_mask(sick::SensorDataFeatures::ALL)
 {
   m_data_header_parser_ptr      = std::make_shared<sick::data_processing::ParseDataHeader>();
   m_derived_values_parser_ptr   = std::make_shared<sick::data_processing::ParseDerivedValues>();
@@ -46,6 +49,7 @@ ParseData::ParseData()
     std::make_shared<sick::data_processing::ParseGeneralSystemState>();
   m_intrusion_data_parser_ptr   = std::make_shared<sick::data_processing::ParseIntrusionData>();
   m_application_data_parser_ptr = std::make_shared<sick::data_processing::ParseApplicationData>();
+  m_data_block_parser_ptr       = std::make_shared<sick::data_processing::DataBlockParser>();
 }
 
 sick::datastructure::Data
@@ -56,6 +60,12 @@ ParseData::parseUDPSequence(const datastructure::PacketBuffer& buffer) const
   return data;
 }
 
+void ParseData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                 sick::datastructure::Data& data) const
+{
+  setDataBlocksInData(buffer, data);
+}
+
 bool ParseData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                  sick::datastructure::Data& data) const
 {
@@ -63,66 +73,173 @@ bool ParseData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
   return true;
 }
 
+void ParseData::parseUDPSequenceLazily(datastructure::PacketBuffer&& buffer,
+                                       sick::datastructure::Data& data) const
+{
+  const sick::types::SensorFeatures parse_mask = getParseMask();
+
+  data.clearPendingBlocks();
+  setDataHeaderInData(buffer, data);
+  if (isDerivedValuesRequired(parse_mask))
+  {
+    setDerivedValuesInData(buffer, data);
+  }
+  // Unselected blocks are not left pending, clearing them would decode them otherwise.
+  data.setPendingBlocks(std::move(buffer), m_data_block_parser_ptr, getPendingBlocks(parse_mask));
+  setUnselectedBlocksEmpty(parse_mask, data);
+}
+
+void ParseData::setParseMask(sick::types::SensorFeatures parse_mask)
+{
+  m_parse_mask = parse_mask;
+}
+
+sick::types::SensorFeatures ParseData::getParseMask() const
+{
+  return m_parse_mask;
+}
+
 void ParseData::setDataBlocksInData(const datastructure::PacketBuffer& buffer,
                                     datastructure::Data& data) const
 {
+  const sick::types::SensorFeatures parse_mask = getParseMask();
+
+  data.clearPendingBlocks();
   setDataHeaderInData(buffer, data);
-  setDerivedValuesInData(buffer, data);
-  setMeasurementDataInData(buffer, data);
-  setGeneralSystemStateInData(buffer, data);
-  setIntrusionDataInData(buffer, data);
-  setApplicationDataInData(buffer, data);
+  if (isDerivedValuesRequired(parse_mask))
+  {
+    setDerivedValuesInData(buffer, data);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::MEASUREMENT_DATA))
+  {
+    setMeasurementDataInData(buffer, data);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::GENERAL_SYSTEM_STATE))
+  {
+    setGeneralSystemStateInData(buffer, data);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask, sick::SensorDataFeatures::INTRUSION_DATA))
+  {
+    setIntrusionDataInData(buffer, data);
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::APPLICATION_DATA))
+  {
+    setApplicationDataInData(buffer, data);
+  }
+  setUnselectedBlocksEmpty(parse_mask, data);
+}
+
+bool ParseData::isDerivedValuesRequired(sick::types::SensorFeatures parse_mask)
+{
+  // The measurement and intrusion data can not be parsed without the derived values.
+  return (parse_mask & (sick::SensorDataFeatures::DERIVED_SETTINGS |
+                        sick::SensorDataFeatures::MEASUREMENT_DATA |
+                        sick::SensorDataFeatures::INTRUSION_DATA)) != 0;
+}
+
+uint8_t ParseData::getPendingBlocks(sick::types::SensorFeatures parse_mask)
+{
+  uint8_t blocks = 0;
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::GENERAL_SYSTEM_STATE))
+  {
+    blocks |= datastructure::Data::PENDING_GENERAL_SYSTEM_STATE;
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::MEASUREMENT_DATA))
+  {
+    blocks |= datastructure::Data::PENDING_MEASUREMENT_DATA;
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask, sick::SensorDataFeatures::INTRUSION_DATA))
+  {
+    blocks |= datastructure::Data::PENDING_INTRUSION_DATA;
+  }
+  if (sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                          sick::SensorDataFeatures::APPLICATION_DATA))
+  {
+    blocks |= datastructure::Data::PENDING_APPLICATION_DATA;
+  }
+  return blocks;
+}
+
+void ParseData::setUnselectedBlocksEmpty(sick::types::SensorFeatures parse_mask,
+                                         datastructure::Data& data) const
+{
+  if (!isDerivedValuesRequired(parse_mask))
+  {
+    setBlockEmpty(data.getMutableDerivedValues());
+  }
+  if (!sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                           sick::SensorDataFeatures::MEASUREMENT_DATA))
+  {
+    setBlockEmpty(data.getMutableMeasurementData());
+  }
+  if (!sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                           sick::SensorDataFeatures::GENERAL_SYSTEM_STATE))
+  {
+    setBlockEmpty(data.getMutableGeneralSystemState());
+  }
+  if (!sick::SensorDataFeatures::isFlagSet(parse_mask, sick::SensorDataFeatures::INTRUSION_DATA))
+  {
+    setBlockEmpty(data.getMutableIntrusionData());
+  }
+  if (!sick::SensorDataFeatures::isFlagSet(parse_mask,
+                                           sick::SensorDataFeatures::APPLICATION_DATA))
+  {
+    setBlockEmpty(data.getMutableApplicationData());
+  }
+}
+
+void ParseData::setBlockEmpty(datastructure::MeasurementData& block)
+{
+  block.clearScanPoints();
+  block.setNumberOfBeams(0);
+  block.setIsEmpty(true);
+}
+
+void ParseData::setBlockEmpty(datastructure::IntrusionData& block)
+{
+  block.getMutableIntrusionDataVector().clear();
+  block.setIsEmpty(true);
 }
 
 void ParseData::setDataHeaderInData(const datastructure::PacketBuffer& buffer,
                                     datastructure::Data& data) const
 {
-  sick::datastructure::DataHeader data_header =
-    m_data_header_parser_ptr->parseUDPSequence(buffer, data);
-  data.setDataHeaderPtr(std::make_shared<sick::datastructure::DataHeader>(data_header));
+  data.setDataHeader(m_data_header_parser_ptr->parseUDPSequence(buffer, data));
 }
 
 void ParseData::setDerivedValuesInData(const datastructure::PacketBuffer& buffer,
                                        datastructure::Data& data) const
 {
-  sick::datastructure::DerivedValues derived_values =
-    m_derived_values_parser_ptr->parseUDPSequence(buffer, data);
-  data.setDerivedValuesPtr(std::make_shared<sick::datastructure::DerivedValues>(derived_values));
+  data.setDerivedValues(m_derived_values_parser_ptr->parseUDPSequence(buffer, data));
 }
 
 void ParseData::setMeasurementDataInData(const datastructure::PacketBuffer& buffer,
                                          datastructure::Data& data) const
 {
-  sick::datastructure::MeasurementData measurement_data =
-    m_measurement_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setMeasurementDataPtr(
-    std::make_shared<sick::datastructure::MeasurementData>(measurement_data));
+  m_measurement_data_parser_ptr->parseUDPSequence(buffer, data, data.getMutableMeasurementData());
 }
 
 void ParseData::setGeneralSystemStateInData(const datastructure::PacketBuffer& buffer,
                                             datastructure::Data& data) const
 {
-  sick::datastructure::GeneralSystemState general_system_state =
-    m_general_system_state_parser_ptr->parseUDPSequence(buffer, data);
-  data.setGeneralSystemStatePtr(
-    std::make_shared<sick::datastructure::GeneralSystemState>(general_system_state));
+  data.setGeneralSystemState(m_general_system_state_parser_ptr->parseUDPSequence(buffer, data));
 }
 
 void ParseData::setIntrusionDataInData(const datastructure::PacketBuffer& buffer,
                                        datastructure::Data& data) const
 {
-  sick::datastructure::IntrusionData intrusion_data =
-    m_intrusion_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setIntrusionDataPtr(std::make_shared<sick::datastructure::IntrusionData>(intrusion_data));
+  m_intrusion_data_parser_ptr->parseUDPSequence(buffer, data, data.getMutableIntrusionData());
 }
 
 void ParseData::setApplicationDataInData(const datastructure::PacketBuffer& buffer,
                                          datastructure::Data& data) const
 {
-  sick::datastructure::ApplicationData application_data =
-    m_application_data_parser_ptr->parseUDPSequence(buffer, data);
-  data.setApplicationDataPtr(
-    std::make_shared<sick::datastructure::ApplicationData>(application_data));
+  data.setApplicationData(m_application_data_parser_ptr->parseUDPSequence(buffer, data));
 }
 
 } // namespace data_processing
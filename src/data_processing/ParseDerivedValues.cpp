@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseDerivedValues.h"
 
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
 namespace sick {
 namespace data_processing {
 
@@ -51,10 +53,10 @@ ParseDerivedValues::parseUDPSequence(const datastructure::PacketBuffer& buffer,
     derived_values.setIsEmpty(true);
     return derived_values;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
-  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getDerivedValuesBlockOffset();
+  PacketBufferCursor cursor(buffer);
+  read_write_helper::ConstByteSpan data_ptr =
+    cursor.getContiguous(data.getDataHeader().getDerivedValuesBlockOffset(),
+                         data.getDataHeader().getDerivedValuesBlockSize());
   setDataInDerivedValues(data_ptr, derived_values);
   return derived_values;
 }
@@ -75,61 +77,20 @@ bool ParseDerivedValues::checkIfPreconditionsAreMet(const datastructure::Data& d
 
 bool ParseDerivedValues::checkIfDerivedValuesIsPublished(const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->getDerivedValuesBlockOffset() == 0 &&
-           data.getDataHeaderPtr()->getDerivedValuesBlockSize() == 0);
+  return !(data.getDataHeader().getDerivedValuesBlockOffset() == 0 &&
+           data.getDataHeader().getDerivedValuesBlockSize() == 0);
 }
 
 bool ParseDerivedValues::checkIfDataContainsNeededParsedBlocks(
   const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->isEmpty());
+  return !(data.getDataHeader().isEmpty());
 }
 
-void ParseDerivedValues::setDataInDerivedValues(std::vector<uint8_t>::const_iterator data_ptr,
+void ParseDerivedValues::setDataInDerivedValues(read_write_helper::ConstByteSpan data_ptr,
                                                 datastructure::DerivedValues& derived_values) const
 {
-  setMultiplicationFactorInDerivedValues(data_ptr, derived_values);
-  setNumberOfBeamsInDerivedValues(data_ptr, derived_values);
-  setScanTimeInDerivedValues(data_ptr, derived_values);
-  setStartAngleInDerivedValues(data_ptr, derived_values);
-  setAngularBeamResolutionInDerivedValues(data_ptr, derived_values);
-  setInterbeamPeriodInDerivedValues(data_ptr, derived_values);
-}
-
-void ParseDerivedValues::setMultiplicationFactorInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setMultiplicationFactor(read_write_helper::readUint16LittleEndian(data_ptr + 0));
-}
-
-void ParseDerivedValues::setNumberOfBeamsInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setNumberOfBeams(read_write_helper::readUint16LittleEndian(data_ptr + 2));
-}
-
-void ParseDerivedValues::setScanTimeInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setScanTime(read_write_helper::readUint16LittleEndian(data_ptr + 4));
-}
-
-void ParseDerivedValues::setStartAngleInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setStartAngle(read_write_helper::readInt32LittleEndian(data_ptr + 8));
-}
-
-void ParseDerivedValues::setAngularBeamResolutionInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setAngularBeamResolution(read_write_helper::readInt32LittleEndian(data_ptr + 12));
-}
-
-void ParseDerivedValues::setInterbeamPeriodInDerivedValues(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::DerivedValues& derived_values) const
-{
-  derived_values.setInterbeamPeriod(read_write_helper::readUint32LittleEndian(data_ptr + 16));
+  data_layout::derived_values::Layout::decode(data_ptr, derived_values);
 }
 
 } // namespace data_processing
@@ -36,6 +36,8 @@
 
 #include "sick_safetyscanners_base/cola2/Command.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -45,27 +47,27 @@ ParseFieldGeometryData::ParseFieldGeometryData() {}
 bool ParseFieldGeometryData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                               sick::datastructure::FieldData& field_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   uint32_t array_length                                     = readArrayLength(data_ptr);
   std::vector<uint16_t> geometry_distance_mm;
   for (uint32_t i = 0; i < array_length; i++)
   {
     geometry_distance_mm.push_back(readArrayElement(data_ptr, i));
   }
-  field_data.setBeamDistances(geometry_distance_mm);
+  field_data.setBeamDistances(std::move(geometry_distance_mm));
 
   return true;
 }
 
 uint32_t
-ParseFieldGeometryData::readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseFieldGeometryData::readArrayLength(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
-uint16_t ParseFieldGeometryData::readArrayElement(std::vector<uint8_t>::const_iterator data_ptr,
+uint16_t ParseFieldGeometryData::readArrayElement(read_write_helper::ConstByteSpan data_ptr,
                                                   uint32_t elem_number) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 8 + elem_number * 2);
@@ -45,9 +45,9 @@ ParseFieldHeaderData::ParseFieldHeaderData() {}
 bool ParseFieldHeaderData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                             datastructure::FieldData& field_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   bool valid                                                = isValid(data_ptr);
   field_data.setIsValid(valid);
 
@@ -70,7 +70,7 @@ bool ParseFieldHeaderData::parseTCPSequence(const datastructure::PacketBuffer& b
   return true;
 }
 
-bool ParseFieldHeaderData::isValid(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseFieldHeaderData::isValid(read_write_helper::ConstByteSpan data_ptr) const
 {
   bool res     = false;
   uint8_t byte = read_write_helper::readUint8(data_ptr + 0);
@@ -82,7 +82,7 @@ bool ParseFieldHeaderData::isValid(std::vector<uint8_t>::const_iterator data_ptr
   return res;
 }
 
-void ParseFieldHeaderData::setFieldType(std::vector<uint8_t>::const_iterator data_ptr,
+void ParseFieldHeaderData::setFieldType(read_write_helper::ConstByteSpan data_ptr,
                                         datastructure::FieldData& field_data) const
 {
   uint8_t field_type = readEvalMethod(data_ptr);
@@ -99,65 +99,65 @@ void ParseFieldHeaderData::setFieldType(std::vector<uint8_t>::const_iterator dat
 }
 
 std::string
-ParseFieldHeaderData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseFieldHeaderData::readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseFieldHeaderData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseFieldHeaderData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseFieldHeaderData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-bool ParseFieldHeaderData::readIsDefined(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseFieldHeaderData::readIsDefined(read_write_helper::ConstByteSpan data_ptr) const
 {
   // TODO
   return read_write_helper::readUint8(data_ptr + 72);
 }
 
-uint8_t ParseFieldHeaderData::readEvalMethod(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldHeaderData::readEvalMethod(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 73);
 }
 
 
 uint16_t
-ParseFieldHeaderData::readMultiSampling(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseFieldHeaderData::readMultiSampling(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 74);
 }
 
 uint16_t
-ParseFieldHeaderData::readObjectResolution(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseFieldHeaderData::readObjectResolution(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 78);
 }
 
-uint16_t ParseFieldHeaderData::readSetIndex(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseFieldHeaderData::readSetIndex(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 82);
 }
 
 
-uint32_t ParseFieldHeaderData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseFieldHeaderData::readNameLength(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 84);
 }
 
 
-std::string ParseFieldHeaderData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseFieldHeaderData::readFieldName(read_write_helper::ConstByteSpan data_ptr) const
 {
   uint32_t name_length = read_write_helper::readUint32LittleEndian(data_ptr + 84);
   std::string name;
@@ -36,6 +36,8 @@
 
 #include "sick_safetyscanners_base/cola2/Command.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -45,9 +47,9 @@ ParseFieldSetsData::ParseFieldSetsData() {}
 bool ParseFieldSetsData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                           sick::datastructure::FieldSets& field_sets) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   field_sets.setVersionCVersion(readVersionIndicator(data_ptr));
   field_sets.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   field_sets.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -60,36 +62,36 @@ bool ParseFieldSetsData::parseTCPSequence(const datastructure::PacketBuffer& buf
 }
 
 std::string
-ParseFieldSetsData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseFieldSetsData::readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseFieldSetsData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseFieldSetsData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseFieldSetsData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseFieldSetsData::readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-uint32_t ParseFieldSetsData::readArrayLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseFieldSetsData::readArrayLength(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
 
 std::vector<std::string>
-ParseFieldSetsData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
+ParseFieldSetsData::readFieldName(read_write_helper::ConstByteSpan data_ptr,
                                   uint32_t array_length) const
 {
   std::vector<std::string> result;
@@ -101,13 +103,13 @@ ParseFieldSetsData::readFieldName(std::vector<uint8_t>::const_iterator data_ptr,
     {
       name.push_back(read_write_helper::readUint8(data_ptr + 12 + i * 104 + j));
     }
-    result.push_back(name);
+    result.push_back(std::move(name));
   }
   return result;
 }
 
 std::vector<uint32_t>
-ParseFieldSetsData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr,
+ParseFieldSetsData::readNameLength(read_write_helper::ConstByteSpan data_ptr,
                                    uint32_t array_length) const
 {
   std::vector<uint32_t> result;
@@ -117,7 +119,7 @@ ParseFieldSetsData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr
   }
   return result;
 }
-std::vector<bool> ParseFieldSetsData::readIsDefined(std::vector<uint8_t>::const_iterator data_ptr,
+std::vector<bool> ParseFieldSetsData::readIsDefined(read_write_helper::ConstByteSpan data_ptr,
                                                     uint32_t array_length) const
 {
   std::vector<bool> result;
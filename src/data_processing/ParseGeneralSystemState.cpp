@@ -34,14 +34,18 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseGeneralSystemState.h"
 
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
 namespace sick {
 namespace data_processing {
 
+namespace layout = data_layout::general_system_state;
+
 ParseGeneralSystemState::ParseGeneralSystemState() {}
 
 datastructure::GeneralSystemState
 ParseGeneralSystemState::parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                          datastructure::Data& data) const
+                                          const datastructure::Data& data) const
 {
   datastructure::GeneralSystemState general_system_state;
   if (!checkIfPreconditionsAreMet(data))
@@ -49,10 +53,10 @@ ParseGeneralSystemState::parseUDPSequence(const datastructure::PacketBuffer& buf
     general_system_state.setIsEmpty(true);
     return general_system_state;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
-  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getGeneralSystemStateBlockOffset();
+  PacketBufferCursor cursor(buffer);
+  read_write_helper::ConstByteSpan data_ptr =
+    cursor.getContiguous(data.getDataHeader().getGeneralSystemStateBlockOffset(),
+                         data.getDataHeader().getGeneralSystemStateBlockSize());
 
   setDataInGeneralSystemState(data_ptr, general_system_state);
   return general_system_state;
@@ -75,19 +79,19 @@ bool ParseGeneralSystemState::checkIfPreconditionsAreMet(const datastructure::Da
 bool ParseGeneralSystemState::checkIfGeneralSystemStateIsPublished(
   const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->getGeneralSystemStateBlockOffset() == 0 &&
-           data.getDataHeaderPtr()->getGeneralSystemStateBlockSize() == 0);
+  return !(data.getDataHeader().getGeneralSystemStateBlockOffset() == 0 &&
+           data.getDataHeader().getGeneralSystemStateBlockSize() == 0);
 }
 
 bool ParseGeneralSystemState::checkIfDataContainsNeededParsedBlocks(
   const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->isEmpty());
+  return !(data.getDataHeader().isEmpty());
 }
 
 
 void ParseGeneralSystemState::setDataInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
   setStatusBitsInGeneralSystemState(data_ptr, general_system_state);
@@ -99,110 +103,81 @@ void ParseGeneralSystemState::setDataInGeneralSystemState(
 }
 
 void ParseGeneralSystemState::setStatusBitsInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 0);
-
-  general_system_state.setRunModeActive(static_cast<bool>(byte & (0x01 << 0)));
-  general_system_state.setStandbyModeActive(static_cast<bool>(byte & (0x01 << 1)));
-  general_system_state.setContaminationWarning(static_cast<bool>(byte & (0x01 << 2)));
-  general_system_state.setContaminationError(static_cast<bool>(byte & (0x01 << 3)));
-  general_system_state.setReferenceContourStatus(static_cast<bool>(byte & (0x01 << 4)));
-  general_system_state.setManipulationStatus(static_cast<bool>(byte & (0x01 << 5)));
-  // bit 6 and 7 reserved
+  uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + layout::StatusBits::OFFSET);
+
+  general_system_state.setRunModeActive(
+    static_cast<bool>(byte & (0x01 << layout::RUN_MODE_ACTIVE_BIT)));
+  general_system_state.setStandbyModeActive(
+    static_cast<bool>(byte & (0x01 << layout::STANDBY_MODE_ACTIVE_BIT)));
+  general_system_state.setContaminationWarning(
+    static_cast<bool>(byte & (0x01 << layout::CONTAMINATION_WARNING_BIT)));
+  general_system_state.setContaminationError(
+    static_cast<bool>(byte & (0x01 << layout::CONTAMINATION_ERROR_BIT)));
+  general_system_state.setReferenceContourStatus(
+    static_cast<bool>(byte & (0x01 << layout::REFERENCE_CONTOUR_STATUS_BIT)));
+  general_system_state.setManipulationStatus(
+    static_cast<bool>(byte & (0x01 << layout::MANIPULATION_STATUS_BIT)));
 }
 
 void ParseGeneralSystemState::setSafeCutOffPathInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  std::vector<bool> safe_cut_off_path;
-
-  for (uint8_t i = 0; i < 3; i++)
-  {
-    uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 1 + i);
-
-    for (uint8_t j = 0; j < 8; j++)
-    {
-      // as long as there are only 20 instead of 24 cut off paths
-      if (i == 2 && j > 3)
-      {
-        break;
-      }
-      safe_cut_off_path.push_back(static_cast<bool>(byte & (0x01 << j)));
-    }
-  }
-  general_system_state.setSafeCutOffPathvector(safe_cut_off_path);
+  general_system_state.setSafeCutOffPath(
+    readCutOffPathWord(data_ptr + layout::SafeCutOffPath::OFFSET));
 }
 
 void ParseGeneralSystemState::setNonSafeCutOffPathInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  std::vector<bool> non_safe_cut_off_path;
-
-  for (uint8_t i = 0; i < 3; i++)
-  {
-    uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 4 + i);
-
-    for (uint8_t j = 0; j < 8; j++)
-    {
-      // as long as there are only 20 instead of 24 cut off paths
-      if (i == 2 && j > 3)
-      {
-        break;
-      }
-      non_safe_cut_off_path.push_back(static_cast<bool>(byte & (0x01 << j)));
-    }
-  }
-  general_system_state.setNonSafeCutOffPathVector(non_safe_cut_off_path);
+  general_system_state.setNonSafeCutOffPath(
+    readCutOffPathWord(data_ptr + layout::NonSafeCutOffPath::OFFSET));
 }
 
 void ParseGeneralSystemState::setResetRequiredCutOffPathInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  std::vector<bool> reset_required_cutoff_path;
+  general_system_state.setResetRequiredCutOffPath(
+    readCutOffPathWord(data_ptr + layout::ResetRequiredCutOffPath::OFFSET));
+}
 
-  for (uint8_t i = 0; i < 3; i++)
+datastructure::GeneralSystemState::CutOffPathWord ParseGeneralSystemState::readCutOffPathWord(
+  read_write_helper::ConstByteSpan data_ptr) const
+{
+  // The cut-off paths are transmitted as 24 bit little endian word, only 20 of them are used.
+  uint32_t word = 0;
+  for (uint8_t i = 0; i < layout::SafeCutOffPath::SIZE; i++)
   {
-    uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 7 + i);
-
-    for (uint8_t j = 0; j < 8; j++)
-    {
-      // as long as there are only 20 instead of 24 cut off paths
-      if (i == 2 && j > 3)
-      {
-        break;
-      }
-      reset_required_cutoff_path.push_back(static_cast<bool>(byte & (0x01 << j)));
-    }
+    uint32_t byte = read_write_helper::readUint8LittleEndian(data_ptr + i);
+    word |= byte << (i * 8);
   }
-  general_system_state.setResetRequiredCutOffPathVector(reset_required_cutoff_path);
+  return datastructure::GeneralSystemState::CutOffPathWord(word);
 }
 
 void ParseGeneralSystemState::setCurrentMonitoringCasesInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  general_system_state.setCurrentMonitoringCaseNoTable1(
-    read_write_helper::readUint8LittleEndian(data_ptr + 10));
-  general_system_state.setCurrentMonitoringCaseNoTable2(
-    read_write_helper::readUint8LittleEndian(data_ptr + 11));
-  general_system_state.setCurrentMonitoringCaseNoTable3(
-    read_write_helper::readUint8LittleEndian(data_ptr + 12));
-  general_system_state.setCurrentMonitoringCaseNoTable4(
-    read_write_helper::readUint8LittleEndian(data_ptr + 13));
+  FieldLayout<layout::CurrentMonitoringCaseNoTable1,
+              layout::CurrentMonitoringCaseNoTable2,
+              layout::CurrentMonitoringCaseNoTable3,
+              layout::CurrentMonitoringCaseNoTable4>::decode(data_ptr, general_system_state);
 }
 
 void ParseGeneralSystemState::setErrorsInGeneralSystemState(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   datastructure::GeneralSystemState& general_system_state) const
 {
-  uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + 15);
-  general_system_state.setApplicationError(static_cast<bool>(byte & (0x01 << 0)));
-  general_system_state.setDeviceError(static_cast<bool>(byte & (0x01 << 1)));
+  uint8_t byte = read_write_helper::readUint8LittleEndian(data_ptr + layout::ErrorBits::OFFSET);
+  general_system_state.setApplicationError(
+    static_cast<bool>(byte & (0x01 << layout::APPLICATION_ERROR_BIT)));
+  general_system_state.setDeviceError(
+    static_cast<bool>(byte & (0x01 << layout::DEVICE_ERROR_BIT)));
 }
 
 } // namespace data_processing
@@ -34,6 +34,10 @@
 
 #include "sick_safetyscanners_base/data_processing/ParseIntrusionData.h"
 
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
+#include <algorithm>
+
 namespace sick {
 namespace data_processing {
 
@@ -41,22 +45,28 @@ ParseIntrusionData::ParseIntrusionData() {}
 
 datastructure::IntrusionData
 ParseIntrusionData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                     datastructure::Data& data)
+                                     const datastructure::Data& data)
 {
   datastructure::IntrusionData intrusion_data;
+  parseUDPSequence(buffer, data, intrusion_data);
+  return intrusion_data;
+}
+
+void ParseIntrusionData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                          const datastructure::Data& data,
+                                          datastructure::IntrusionData& intrusion_data)
+{
   if (!checkIfPreconditionsAreMet(data))
   {
     intrusion_data.setIsEmpty(true);
-    return intrusion_data;
+    return;
   }
+  intrusion_data.setIsEmpty(false);
 
-  // Keep our own copy of the shared_ptr to keep the iterators valid
-  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getIntrusionDataBlockOffset();
-  setNumScanPoints(data.getDerivedValuesPtr()->getNumberOfBeams());
-  setDataInIntrusionData(data_ptr, intrusion_data);
-  return intrusion_data;
+  PacketBufferCursor cursor(buffer);
+  std::size_t block_offset = data.getDataHeader().getIntrusionDataBlockOffset();
+  setNumScanPoints(data.getDerivedValues().getNumberOfBeams());
+  setDataInIntrusionData(cursor, block_offset, intrusion_data);
 }
 
 bool ParseIntrusionData::checkIfPreconditionsAreMet(const datastructure::Data& data) const
@@ -74,18 +84,18 @@ bool ParseIntrusionData::checkIfPreconditionsAreMet(const datastructure::Data& d
 
 bool ParseIntrusionData::checkIfIntrusionDataIsPublished(const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->getIntrusionDataBlockOffset() == 0 &&
-           data.getDataHeaderPtr()->getIntrusionDataBlockSize() == 0);
+  return !(data.getDataHeader().getIntrusionDataBlockOffset() == 0 &&
+           data.getDataHeader().getIntrusionDataBlockSize() == 0);
 }
 
 bool ParseIntrusionData::checkIfDataContainsNeededParsedBlocks(
   const datastructure::Data& data) const
 {
-  if (data.getDataHeaderPtr()->isEmpty())
+  if (data.getDataHeader().isEmpty())
   {
     return false;
   }
-  if (data.getDerivedValuesPtr()->isEmpty())
+  if (data.getDerivedValues().isEmpty())
   {
     return false;
   }
@@ -102,62 +112,49 @@ void ParseIntrusionData::setNumScanPoints(const uint16_t& num_scan_points)
   m_num_scan_points = num_scan_points;
 }
 
-void ParseIntrusionData::setDataInIntrusionData(std::vector<uint8_t>::const_iterator data_ptr,
-                                                datastructure::IntrusionData& intrusion_data) const
+void ParseIntrusionData::setDataInIntrusionData(PacketBufferCursor& cursor,
+                                                std::size_t block_offset,
+                                                datastructure::IntrusionData& intrusion_data)
 {
-  std::vector<sick::datastructure::IntrusionDatum> intrusion_datums;
-  setDataInIntrusionDatums(data_ptr, intrusion_datums);
-  intrusion_data.setIntrusionDataVector(intrusion_datums);
+  // The datums are decoded in place, which reuses the capacity of the flag words of a recycled
+  // intrusion data block.
+  setDataInIntrusionDatums(cursor, block_offset, intrusion_data.getMutableIntrusionDataVector());
 }
 
 void ParseIntrusionData::setDataInIntrusionDatums(
-  std::vector<uint8_t>::const_iterator data_ptr,
-  std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums) const
+  PacketBufferCursor& cursor,
+  std::size_t block_offset,
+  std::vector<sick::datastructure::IntrusionDatum>& intrusion_datums)
 {
-  uint16_t offset = 0;
+  std::size_t offset = block_offset;
   // Repeats for 24 CutOffPaths
-  for (uint8_t i_set = 0; i_set < 24; ++i_set)
+  intrusion_datums.resize(data_layout::intrusion_data::NUMBER_OF_DATUMS);
+  for (auto& datum : intrusion_datums)
   {
-    sick::datastructure::IntrusionDatum datum;
-    setSizeInIntrusionDatum(offset, data_ptr, datum);
-    offset += 4;
-    setFlagsInIntrusionDatum(offset, data_ptr, datum);
+    setSizeInIntrusionDatum(
+      cursor.getContiguous(offset, data_layout::intrusion_data::datum::FLAGS_OFFSET), datum);
+    offset += data_layout::intrusion_data::datum::FLAGS_OFFSET;
+    setFlagsInIntrusionDatum(cursor.getContiguous(offset, datum.getSize()), datum);
     offset += datum.getSize();
-    intrusion_datums.push_back(datum);
   }
 }
 
 
-uint16_t
-ParseIntrusionData::setSizeInIntrusionDatum(const uint16_t& offset,
-                                            std::vector<uint8_t>::const_iterator data_ptr,
-                                            sick::datastructure::IntrusionDatum& datum) const
+void ParseIntrusionData::setSizeInIntrusionDatum(read_write_helper::ConstByteSpan data_ptr,
+                                                 sick::datastructure::IntrusionDatum& datum) const
 {
-  uint32_t num_bytes_to_read = read_write_helper::readUint32LittleEndian(data_ptr + offset);
+  uint32_t num_bytes_to_read = read_write_helper::readUint32LittleEndian(
+    data_ptr + data_layout::intrusion_data::datum::Size::OFFSET);
   datum.setSize(num_bytes_to_read);
-  return offset;
 }
 
-uint16_t
-ParseIntrusionData::setFlagsInIntrusionDatum(const uint16_t& offset,
-                                             std::vector<uint8_t>::const_iterator data_ptr,
-                                             sick::datastructure::IntrusionDatum& datum) const
+void ParseIntrusionData::setFlagsInIntrusionDatum(read_write_helper::ConstByteSpan data_ptr,
+                                                  sick::datastructure::IntrusionDatum& datum) const
 {
-  uint32_t num_read_flags = 0;
-  std::vector<bool> flags;
-  for (uint16_t num_read_bytes = 0;
-       (num_read_bytes < datum.getSize()) && (num_read_flags < m_num_scan_points);
-       num_read_bytes++)
-  {
-    uint8_t bitset = read_write_helper::readUint8LittleEndian(data_ptr + offset + num_read_bytes);
-    for (uint32_t i_bit = 0; (i_bit < 8) && (num_read_flags < m_num_scan_points);
-         i_bit++, num_read_flags++)
-    {
-      flags.push_back(static_cast<bool>(bitset & (0x01 << i_bit)));
-    }
-  }
-  datum.setFlagsVector(flags);
-  return offset;
+  // The flags are taken over packed, there is one flag per beam at most.
+  std::size_t num_bytes = static_cast<std::size_t>(datum.getSize());
+  std::size_t num_flags = std::min<std::size_t>(num_bytes * 8, m_num_scan_points);
+  datum.setFlags(data_ptr.data(), num_bytes, num_flags);
 }
 
 } // namespace data_processing
@@ -33,6 +33,10 @@
 //----------------------------------------------------------------------
 
 #include "sick_safetyscanners_base/data_processing/ParseMeasurementData.h"
+#include "sick_safetyscanners_base/Exceptions.h"
+#include "sick_safetyscanners_base/data_processing/DataLayout.h"
+
+#include <algorithm>
 
 namespace sick {
 namespace data_processing {
@@ -41,22 +45,29 @@ ParseMeasurementData::ParseMeasurementData() {}
 
 datastructure::MeasurementData
 ParseMeasurementData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
-                                       datastructure::Data& data)
+                                       const datastructure::Data& data)
 {
   datastructure::MeasurementData measurement_data;
+  parseUDPSequence(buffer, data, measurement_data);
+  return measurement_data;
+}
+
+void ParseMeasurementData::parseUDPSequence(const datastructure::PacketBuffer& buffer,
+                                            const datastructure::Data& data,
+                                            datastructure::MeasurementData& measurement_data)
+{
   if (!checkIfPreconditionsAreMet(data))
   {
+    measurement_data.clearScanPoints();
     measurement_data.setIsEmpty(true);
-    return measurement_data;
+    return;
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
-  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr =
-    vec_ptr->begin() + data.getDataHeaderPtr()->getMeasurementDataBlockOffset();
+  measurement_data.setIsEmpty(false);
+  PacketBufferCursor cursor(buffer);
+  std::size_t block_offset = data.getDataHeader().getMeasurementDataBlockOffset();
 
   setStartAngleAndDelta(data);
-  setDataInMeasurementData(data_ptr, measurement_data);
-  return measurement_data;
+  setDataInMeasurementData(cursor, block_offset, measurement_data);
 }
 
 bool ParseMeasurementData::checkIfPreconditionsAreMet(const datastructure::Data& data) const
@@ -74,18 +85,18 @@ bool ParseMeasurementData::checkIfPreconditionsAreMet(const datastructure::Data&
 
 bool ParseMeasurementData::checkIfMeasurementDataIsPublished(const datastructure::Data& data) const
 {
-  return !(data.getDataHeaderPtr()->getMeasurementDataBlockOffset() == 0 &&
-           data.getDataHeaderPtr()->getMeasurementDataBlockSize() == 0);
+  return !(data.getDataHeader().getMeasurementDataBlockOffset() == 0 &&
+           data.getDataHeader().getMeasurementDataBlockSize() == 0);
 }
 
 bool ParseMeasurementData::checkIfDataContainsNeededParsedBlocks(
   const datastructure::Data& data) const
 {
-  if (data.getDataHeaderPtr()->isEmpty())
+  if (data.getDataHeader().isEmpty())
   {
     return false;
   }
-  if (data.getDerivedValuesPtr()->isEmpty())
+  if (data.getDerivedValues().isEmpty())
   {
     return false;
   }
@@ -94,58 +105,81 @@ bool ParseMeasurementData::checkIfDataContainsNeededParsedBlocks(
 
 
 void ParseMeasurementData::setDataInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::MeasurementData& measurement_data)
+  PacketBufferCursor& cursor,
+  std::size_t block_offset,
+  datastructure::MeasurementData& measurement_data)
 {
-  setNumberOfBeamsInMeasurementData(data_ptr, measurement_data);
-  setScanPointsInMeasurementData(data_ptr, measurement_data);
+  setNumberOfBeamsInMeasurementData(cursor, block_offset, measurement_data);
+  // The table is set before the columns are resized, so no angle column is filled in vain.
+  setAngleTableInMeasurementData(measurement_data);
+  measurement_data.resizeScanPoints(measurement_data.getNumberOfBeams());
+  setScanPointsInMeasurementData(cursor, block_offset, measurement_data);
 }
 
 void ParseMeasurementData::setNumberOfBeamsInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  PacketBufferCursor& cursor,
+  std::size_t block_offset,
   datastructure::MeasurementData& measurement_data) const
 {
-  measurement_data.setNumberOfBeams(read_write_helper::readUint32LittleEndian(data_ptr + 0));
+  read_write_helper::ConstByteSpan data_ptr =
+    cursor.getContiguous(block_offset, data_layout::measurement_data::BEAMS_OFFSET);
+  measurement_data.setNumberOfBeams(read_write_helper::readUint32LittleEndian(
+    data_ptr + data_layout::measurement_data::NumberOfBeams::OFFSET));
+  // The number of beams is not trusted beyond what the buffer can hold.
+  std::size_t max_beams =
+    (cursor.getLength() - block_offset - data_layout::measurement_data::BEAMS_OFFSET) /
+    BeamDecoder::BEAM_SIZE;
+  if (measurement_data.getNumberOfBeams() > max_beams)
+  {
+    throw sick::runtime_error("Read beyond the end of the packet buffer");
+  }
 }
 
 void ParseMeasurementData::setStartAngleAndDelta(const datastructure::Data& data)
 {
-  m_angle       = data.getDerivedValuesPtr()->getStartAngle();
-  m_angle_delta = data.getDerivedValuesPtr()->getAngularBeamResolution();
+  m_start_angle = data.getDerivedValues().getStartAngle();
+  m_angle_delta = data.getDerivedValues().getAngularBeamResolution();
 }
 
 void ParseMeasurementData::setScanPointsInMeasurementData(
-  std::vector<uint8_t>::const_iterator data_ptr, datastructure::MeasurementData& measurement_data)
+  PacketBufferCursor& cursor,
+  std::size_t block_offset,
+  datastructure::MeasurementData& measurement_data)
 {
-  for (size_t i = 0; i < measurement_data.getNumberOfBeams(); i++)
+  std::size_t number_of_beams = measurement_data.getNumberOfBeams();
+  std::size_t offset          = block_offset + data_layout::measurement_data::BEAMS_OFFSET;
+  std::size_t beam            = 0;
+  while (beam < number_of_beams)
   {
-    addScanPointToMeasurementData(i, data_ptr, measurement_data);
-    m_angle += m_angle_delta;
+    // All beams lying within the current fragment are decoded at once, a beam straddling a
+    // fragment boundary is gathered by the cursor and decoded on its own.
+    std::size_t count = std::min(number_of_beams - beam,
+                                 cursor.getContiguousLength(offset) / BeamDecoder::BEAM_SIZE);
+    count             = std::max<std::size_t>(count, 1);
+    read_write_helper::ConstByteSpan data_ptr =
+      cursor.getContiguous(offset, count * BeamDecoder::BEAM_SIZE);
+    BeamDecoder::decode(data_ptr.data(),
+                        count,
+                        measurement_data.getMutableDistances() + beam,
+                        measurement_data.getMutableReflectivities() + beam,
+                        measurement_data.getMutableStatusBytes() + beam);
+    beam += count;
+    offset += count * BeamDecoder::BEAM_SIZE;
   }
 }
 
-void ParseMeasurementData::addScanPointToMeasurementData(
-  const uint16_t offset,
-  std::vector<uint8_t>::const_iterator data_ptr,
-  datastructure::MeasurementData& measurement_data) const
+void ParseMeasurementData::setAngleTableInMeasurementData(
+  datastructure::MeasurementData& measurement_data)
 {
-  uint16_t distance    = read_write_helper::readUint16LittleEndian(data_ptr + (4 + offset * 4));
-  uint8_t reflectivity = read_write_helper::readUint8LittleEndian(data_ptr + (6 + offset * 4));
-  uint8_t status       = read_write_helper::readUint8LittleEndian(data_ptr + (7 + offset * 4));
-  bool valid           = static_cast<bool>(status & (0x01 << 0));
-  bool infinite        = static_cast<bool>(status & (0x01 << 1));
-  bool glare           = static_cast<bool>(status & (0x01 << 2));
-  bool reflector       = static_cast<bool>(status & (0x01 << 3));
-  bool contamination   = static_cast<bool>(status & (0x01 << 4));
-  bool contamination_warning = static_cast<bool>(status & (0x01 << 5));
-  measurement_data.addScanPoint(sick::datastructure::ScanPoint(m_angle,
-                                                               distance,
-                                                               reflectivity,
-                                                               valid,
-                                                               infinite,
-                                                               glare,
-                                                               reflector,
-                                                               contamination,
-                                                               contamination_warning));
+  uint32_t number_of_beams = measurement_data.getNumberOfBeams();
+  // The table is shared by all scans until the derived values change.
+  if (!m_angle_table_ptr ||
+      !m_angle_table_ptr->matches(m_start_angle, m_angle_delta, number_of_beams))
+  {
+    m_angle_table_ptr =
+      std::make_shared<datastructure::AngleTable>(m_start_angle, m_angle_delta, number_of_beams);
+  }
+  measurement_data.setAngleTablePtr(m_angle_table_ptr);
 }
 
 } // namespace data_processing
@@ -36,6 +36,8 @@
 
 #include "sick_safetyscanners_base/cola2/Command.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -46,9 +48,9 @@ bool ParseMonitoringCaseData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::MonitoringCaseData& monitoring_case_data) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   bool valid                                                = isValid(data_ptr);
   monitoring_case_data.setIsValid(valid);
   if (valid)
@@ -62,13 +64,13 @@ bool ParseMonitoringCaseData::parseTCPSequence(
       indices.push_back(readFieldIndex(data_ptr, i));
       fields_valid.push_back(readFieldValid(data_ptr, i));
     }
-    monitoring_case_data.setFieldIndices(indices);
-    monitoring_case_data.setFieldsValid(fields_valid);
+    monitoring_case_data.setFieldIndices(std::move(indices));
+    monitoring_case_data.setFieldsValid(std::move(fields_valid));
   }
   return true;
 }
 
-bool ParseMonitoringCaseData::isValid(std::vector<uint8_t>::const_iterator data_ptr) const
+bool ParseMonitoringCaseData::isValid(read_write_helper::ConstByteSpan data_ptr) const
 {
   bool res     = false;
   uint8_t byte = read_write_helper::readUint8(data_ptr + 0);
@@ -80,18 +82,18 @@ bool ParseMonitoringCaseData::isValid(std::vector<uint8_t>::const_iterator data_
 }
 
 uint16_t ParseMonitoringCaseData::readMonitoringCaseNumber(
-  std::vector<uint8_t>::const_iterator data_ptr) const
+  read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 6);
 }
 
-uint16_t ParseMonitoringCaseData::readFieldIndex(std::vector<uint8_t>::const_iterator data_ptr,
+uint16_t ParseMonitoringCaseData::readFieldIndex(read_write_helper::ConstByteSpan data_ptr,
                                                  const uint8_t& index) const
 {
   return read_write_helper::readUint16LittleEndian(data_ptr + 158 + (index * 4));
 }
 
-bool ParseMonitoringCaseData::readFieldValid(std::vector<uint8_t>::const_iterator data_ptr,
+bool ParseMonitoringCaseData::readFieldValid(read_write_helper::ConstByteSpan data_ptr,
                                              const uint8_t& index) const
 {
   uint8_t byte = read_write_helper::readUint8(data_ptr + 157 + (index * 4));
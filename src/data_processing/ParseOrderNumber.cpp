@@ -45,15 +45,15 @@ ParseOrderNumber::ParseOrderNumber() {}
 bool ParseOrderNumber::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                         datastructure::OrderNumber& order_number) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   order_number.setOrderNumber(readOrderNumber(data_ptr));
   return true;
 }
 
 
-std::string ParseOrderNumber::readOrderNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseOrderNumber::readOrderNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   uint16_t string_length = read_write_helper::readUint16LittleEndian(data_ptr + 0);
 
@@ -46,15 +46,15 @@ bool ParseRequiredUserActionData::parseTCPSequence(
   const datastructure::PacketBuffer& buffer,
   sick::datastructure::RequiredUserAction& required_user_action) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   readRequiredUserAction(data_ptr, required_user_action);
   return true;
 }
 
 bool ParseRequiredUserActionData::readRequiredUserAction(
-  std::vector<uint8_t>::const_iterator data_ptr,
+  read_write_helper::ConstByteSpan data_ptr,
   sick::datastructure::RequiredUserAction& required_user_action) const
 {
   uint16_t word = read_write_helper::readUint16LittleEndian(data_ptr + 0);
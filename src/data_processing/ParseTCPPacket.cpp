@@ -43,17 +43,28 @@ ParseTCPPacket::ParseTCPPacket() {}
 
 uint32_t ParseTCPPacket::getExpectedPacketLength(const datastructure::PacketBuffer& buffer)
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
-  return readLength(data_ptr) + 8; // for STX and Length which is not included in length datafield
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
+  return getExpectedPacketLength(data_ptr);
+}
+
+uint32_t ParseTCPPacket::getExpectedPacketLength(read_write_helper::ConstByteSpan data) const
+{
+  // STX and Length are not included in the length datafield
+  const uint32_t length = readLength(data);
+  if (length < MIN_TELEGRAM_LENGTH - 8 || length > MAX_TELEGRAM_LENGTH - 8)
+  {
+    throw sick::runtime_error("Received Cola2 telegram with invalid length");
+  }
+  return length + 8;
 }
 
 uint16_t ParseTCPPacket::getRequestID(const datastructure::PacketBuffer& buffer) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   return readRequestID(data_ptr);
 }
 
@@ -72,52 +83,64 @@ bool ParseTCPPacket::parseTCPSequence(const datastructure::PacketBuffer& buffer,
 void ParseTCPPacket::setCommandValuesFromPacket(const sick::datastructure::PacketBuffer& buffer,
                                                 sick::cola2::Command& command) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   command.setSessionID(readSessionID(data_ptr));
   command.setRequestID(readRequestID(data_ptr));
   command.setCommandType(readCommandType(data_ptr));
   command.setCommandMode(readCommandMode(data_ptr));
 }
 
-uint32_t ParseTCPPacket::readSTx(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseTCPPacket::getErrorCode(const datastructure::PacketBuffer& buffer) const
+{
+  if (buffer.getLength() < 20)
+  {
+    return 0;
+  }
+  // Keep our own copy of the shared_ptr to keep the span valid
+  const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
+  return readErrorCode(data_ptr);
+}
+
+uint32_t ParseTCPPacket::readSTx(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32BigEndian(data_ptr + 0);
 }
 
-uint32_t ParseTCPPacket::readLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseTCPPacket::readLength(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32BigEndian(data_ptr + 4);
 }
 
-uint8_t ParseTCPPacket::readHubCntr(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseTCPPacket::readHubCntr(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8BigEndian(data_ptr + 8);
 }
-uint8_t ParseTCPPacket::readNoC(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseTCPPacket::readNoC(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8BigEndian(data_ptr + 9);
 }
-uint32_t ParseTCPPacket::readSessionID(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseTCPPacket::readSessionID(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32BigEndian(data_ptr + 10);
 }
 
-uint16_t ParseTCPPacket::readRequestID(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseTCPPacket::readRequestID(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16BigEndian(data_ptr + 14);
 }
 
-uint8_t ParseTCPPacket::readCommandType(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseTCPPacket::readCommandType(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8BigEndian(data_ptr + 16);
 }
-uint8_t ParseTCPPacket::readCommandMode(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseTCPPacket::readCommandMode(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8BigEndian(data_ptr + 17);
 }
-uint16_t ParseTCPPacket::readErrorCode(std::vector<uint8_t>::const_iterator data_ptr) const
+uint16_t ParseTCPPacket::readErrorCode(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint16BigEndian(data_ptr + 18);
 }
@@ -128,7 +151,7 @@ std::vector<uint8_t> ParseTCPPacket::readData(const datastructure::PacketBuffer&
   {
     return std::vector<uint8_t>();
   }
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
   return std::vector<uint8_t>(vec_ptr->begin() + 20, vec_ptr->end());
 }
@@ -45,9 +45,9 @@ ParseUserNameData::ParseUserNameData() {}
 bool ParseUserNameData::parseTCPSequence(const datastructure::PacketBuffer& buffer,
                                          sick::datastructure::UserName& user_name) const
 {
-  // Keep our own copy of the shared_ptr to keep the iterators valid
+  // Keep our own copy of the shared_ptr to keep the span valid
   const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = buffer.getBuffer();
-  std::vector<uint8_t>::const_iterator data_ptr             = vec_ptr->begin();
+  read_write_helper::ConstByteSpan data_ptr                 = *vec_ptr;
   user_name.setVersionCVersion(readVersionIndicator(data_ptr));
   user_name.setVersionMajorVersionNumber(readMajorNumber(data_ptr));
   user_name.setVersionMinorVersionNumber(readMinorNumber(data_ptr));
@@ -58,35 +58,35 @@ bool ParseUserNameData::parseTCPSequence(const datastructure::PacketBuffer& buff
 }
 
 std::string
-ParseUserNameData::readVersionIndicator(std::vector<uint8_t>::const_iterator data_ptr) const
+ParseUserNameData::readVersionIndicator(read_write_helper::ConstByteSpan data_ptr) const
 {
   std::string result;
   result.push_back(read_write_helper::readUint8(data_ptr + 0));
   return result;
 }
 
-uint8_t ParseUserNameData::readMajorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseUserNameData::readMajorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 1);
 }
 
-uint8_t ParseUserNameData::readMinorNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseUserNameData::readMinorNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 2);
 }
 
-uint8_t ParseUserNameData::readReleaseNumber(std::vector<uint8_t>::const_iterator data_ptr) const
+uint8_t ParseUserNameData::readReleaseNumber(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint8(data_ptr + 3);
 }
 
-uint32_t ParseUserNameData::readNameLength(std::vector<uint8_t>::const_iterator data_ptr) const
+uint32_t ParseUserNameData::readNameLength(read_write_helper::ConstByteSpan data_ptr) const
 {
   return read_write_helper::readUint32LittleEndian(data_ptr + 4);
 }
 
 
-std::string ParseUserNameData::readUserName(std::vector<uint8_t>::const_iterator data_ptr) const
+std::string ParseUserNameData::readUserName(read_write_helper::ConstByteSpan data_ptr) const
 {
   uint32_t name_length = read_write_helper::readUint32LittleEndian(data_ptr + 4);
   std::string name;
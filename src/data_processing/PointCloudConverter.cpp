@@ -0,0 +1,200 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PointCloudConverter.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+#include "sick_safetyscanners_base/Exceptions.h"
+
+#if !defined(SICK_DISABLE_SIMD) && defined(__SSE2__)
+#define SICK_POINT_CLOUD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace sick {
+namespace data_processing {
+
+PointCloudConverter::PointCloudConverter(const PointCloudOptions& options)
+  : m_options(options)
+  , m_angle_table_ptr()
+{
+}
+
+PointCloudOptions PointCloudConverter::getOptions() const
+{
+  return m_options;
+}
+
+void PointCloudConverter::setOptions(const PointCloudOptions& options)
+{
+  m_options = options;
+}
+
+std::size_t PointCloudConverter::getStride() const
+{
+  return m_options.with_intensity ? 3 : 2;
+}
+
+std::size_t PointCloudConverter::convert(const sick::datastructure::Data& data,
+                                         float* points,
+                                         std::size_t max_points)
+{
+  if (!data.hasMeasurementData() || !data.hasDerivedValues())
+  {
+    throw sick::runtime_error("Measurement data and derived values are required for conversion");
+  }
+  return convert(data.getMeasurementData(), data.getDerivedValues(), points, max_points);
+}
+
+std::size_t
+PointCloudConverter::convert(const sick::datastructure::MeasurementData& measurement_data,
+                             const sick::datastructure::DerivedValues& derived_values,
+                             float* points,
+                             std::size_t max_points)
+{
+  const std::size_t num_beams = measurement_data.getNumberOfScanPoints();
+  if (max_points < num_beams)
+  {
+    throw sick::runtime_error("Point buffer is too small for the number of scanpoints");
+  }
+  const sick::datastructure::AngleTable& angle_table =
+    getAngleTable(measurement_data, derived_values);
+
+  const uint16_t* distances     = measurement_data.getDistancesVector().data();
+  const uint8_t* reflectivities = measurement_data.getReflectivitiesVector().data();
+  const uint8_t* status_bytes   = measurement_data.getStatusBytesVector().data();
+  const float* cosines          = angle_table.getCosinesVector().data();
+  const float* sines            = angle_table.getSinesVector().data();
+  const float scale             = m_options.distance_scale;
+  const uint8_t drop_mask       = getDropMask();
+  const uint8_t required_bits   = getRequiredBits();
+  const bool filter             = drop_mask != 0 || required_bits != 0;
+  const std::size_t stride      = getStride();
+  const bool with_intensity     = m_options.with_intensity;
+  std::size_t num_points        = 0;
+  std::size_t i                 = 0;
+
+#ifdef SICK_POINT_CLOUD_SSE2
+  // Four beams are converted at once. Without filter and intensity the points are interleaved in
+  // registers, otherwise they are written lane by lane.
+  const __m128i zero    = _mm_setzero_si128();
+  const __m128 scale_ps = _mm_set1_ps(scale);
+  alignas(16) float x[4];
+  alignas(16) float y[4];
+  for (; i + 4 <= num_beams; i += 4)
+  {
+    __m128i distances_epi16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(distances + i));
+    __m128 range =
+      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(distances_epi16, zero)), scale_ps);
+    __m128 x_ps = _mm_mul_ps(range, _mm_loadu_ps(cosines + i));
+    __m128 y_ps = _mm_mul_ps(range, _mm_loadu_ps(sines + i));
+    if (!filter && !with_intensity)
+    {
+      _mm_storeu_ps(points + 2 * i + 0, _mm_unpacklo_ps(x_ps, y_ps));
+      _mm_storeu_ps(points + 2 * i + 4, _mm_unpackhi_ps(x_ps, y_ps));
+      num_points += 4;
+      continue;
+    }
+    _mm_store_ps(x, x_ps);
+    _mm_store_ps(y, y_ps);
+    for (std::size_t lane = 0; lane < 4; ++lane)
+    {
+      uint8_t status = status_bytes[i + lane];
+      if ((status & drop_mask) != 0 || (status & required_bits) != required_bits)
+      {
+        continue;
+      }
+      float* point = points + num_points * stride;
+      point[0]     = x[lane];
+      point[1]     = y[lane];
+      if (with_intensity)
+      {
+        point[2] = static_cast<float>(reflectivities[i + lane]);
+      }
+      ++num_points;
+    }
+  }
+#endif
+
+  for (; i < num_beams; ++i)
+  {
+    uint8_t status = status_bytes[i];
+    if ((status & drop_mask) != 0 || (status & required_bits) != required_bits)
+    {
+      continue;
+    }
+    float range  = static_cast<float>(distances[i]) * scale;
+    float* point = points + num_points * stride;
+    point[0]     = range * cosines[i];
+    point[1]     = range * sines[i];
+    if (with_intensity)
+    {
+      point[2] = static_cast<float>(reflectivities[i]);
+    }
+    ++num_points;
+  }
+  return num_points;
+}
+
+const sick::datastructure::AngleTable&
+PointCloudConverter::getAngleTable(const sick::datastructure::MeasurementData& measurement_data,
+                                   const sick::datastructure::DerivedValues& derived_values)
+{
+  float start_angle        = derived_values.getStartAngle();
+  float resolution         = derived_values.getAngularBeamResolution();
+  uint32_t number_of_beams = static_cast<uint32_t>(measurement_data.getNumberOfScanPoints());
+
+  const std::shared_ptr<const sick::datastructure::AngleTable>& measurement_table_ptr =
+    measurement_data.getAngleTablePtr();
+  if (measurement_table_ptr &&
+      measurement_table_ptr->matches(start_angle, resolution, number_of_beams))
+  {
+    return *measurement_table_ptr;
+  }
+  if (!m_angle_table_ptr || !m_angle_table_ptr->matches(start_angle, resolution, number_of_beams))
+  {
+    m_angle_table_ptr =
+      std::make_shared<sick::datastructure::AngleTable>(start_angle, resolution, number_of_beams);
+  }
+  return *m_angle_table_ptr;
+}
+
+uint8_t PointCloudConverter::getDropMask() const
+{
+  return m_options.drop_infinite ? sick::datastructure::MeasurementData::STATUS_INFINITE_BIT : 0;
+}
+
+uint8_t PointCloudConverter::getRequiredBits() const
+{
+  return m_options.drop_invalid ? sick::datastructure::MeasurementData::STATUS_VALID_BIT : 0;
+}
+
+} // namespace data_processing
+} // namespace sick
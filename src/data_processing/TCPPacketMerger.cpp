@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/data_processing/TCPPacketMerger.h"
 
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
@@ -110,7 +112,7 @@ bool TCPPacketMerger::deployPacket()
     headerless_packet_buffer.insert(
       headerless_packet_buffer.end(), vec_ptr->begin(), vec_ptr->end());
   }
-  m_deployed_packet_buffer.setBuffer(headerless_packet_buffer);
+  m_deployed_packet_buffer.setBuffer(std::move(headerless_packet_buffer));
   m_buffer_vector.clear();
   return true;
 }
@@ -34,14 +34,52 @@
 
 #include "sick_safetyscanners_base/data_processing/UDPPacketMerger.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace sick {
 namespace data_processing {
 
 UDPPacketMerger::UDPPacketMerger()
+  : UDPPacketMerger(ReassemblyLimits())
+{
+}
+
+UDPPacketMerger::UDPPacketMerger(const ReassemblyLimits& limits)
   : m_is_complete(false)
+  , m_limits()
+  , m_statistics()
+  , m_slots()
+  , m_spare_fragments()
+  , m_next_sequence(0)
+  , m_memory_in_use(0)
+{
+  setLimits(limits);
+}
+
+void UDPPacketMerger::setLimits(const ReassemblyLimits& limits)
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+
+  m_limits               = limits;
+  m_limits.max_in_flight = std::max<std::size_t>(m_limits.max_in_flight, 1);
+  m_slots.assign(m_limits.max_in_flight, ReassemblySlot());
+  m_spare_fragments.clear();
+  m_spare_fragments.reserve(m_limits.max_in_flight);
+  m_memory_in_use        = 0;
+}
+
+ReassemblyLimits UDPPacketMerger::getLimits() const
 {
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  return m_limits;
 }
 
+ReassemblyStatistics UDPPacketMerger::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  return m_statistics;
+}
 
 bool UDPPacketMerger::isComplete() const
 {
@@ -50,8 +88,34 @@ bool UDPPacketMerger::isComplete() const
 
 sick::datastructure::PacketBuffer UDPPacketMerger::getDeployedPacketBuffer()
 {
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+
   m_is_complete = false;
-  return m_deployed_packet_buffer;
+  sick::datastructure::PacketBuffer deployed_packet_buffer(std::move(m_deployed_packet_buffer));
+  m_deployed_packet_buffer = sick::datastructure::PacketBuffer();
+  return deployed_packet_buffer;
+}
+
+void UDPPacketMerger::releasePacketBuffer(sick::datastructure::PacketBuffer&& buffer)
+{
+  sick::datastructure::PacketBuffer::FragmentVector fragments = buffer.releaseFragments();
+  if (fragments.capacity() == 0)
+  {
+    return;
+  }
+  fragments.clear();
+
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  if (m_spare_fragments.size() < m_limits.max_in_flight)
+  {
+    m_spare_fragments.push_back(std::move(fragments));
+  }
+}
+
+void UDPPacketMerger::evictExpired()
+{
+  std::lock_guard<std::mutex> lock(m_buffer_mutex);
+  evictExpiredSlots(std::chrono::steady_clock::now());
 }
 
 bool UDPPacketMerger::addUDPPacket(const datastructure::PacketBuffer& buffer)
@@ -63,110 +127,205 @@ bool UDPPacketMerger::addUDPPacket(const datastructure::PacketBuffer& buffer)
   {
     m_is_complete = false;
   }
+  if (buffer.getLength() < sick::datastructure::DatagramHeader::HEADER_SIZE)
+  {
+    ++m_statistics.dropped_fragments;
+    return false;
+  }
   sick::datastructure::DatagramHeader datagram_header;
   sick::data_processing::ParseDatagramHeader datagram_header_parser;
   datagram_header_parser.parseUDPSequence(buffer, datagram_header);
-  addToMap(buffer, datagram_header);
-  deployPacketIfComplete(datagram_header);
+
+  const auto now = std::chrono::steady_clock::now();
+  evictExpiredSlots(now);
+
+  ReassemblySlot* slot = findOrAssignSlot(datagram_header, now);
+  if (!slot || !writeFragment(*slot, buffer, datagram_header))
+  {
+    ++m_statistics.dropped_fragments;
+    return false;
+  }
+  if (slot->received_length == slot->total_length)
+  {
+    if (m_limits.evict_superseded)
+    {
+      evictSupersededSlots(*slot);
+    }
+    deploySlot(*slot);
+  }
 
   return isComplete();
 }
 
-bool UDPPacketMerger::addToMap(const datastructure::PacketBuffer& buffer,
-                               const datastructure::DatagramHeader& header)
+void UDPPacketMerger::evictExpiredSlots(const std::chrono::steady_clock::time_point& now)
 {
-  sick::datastructure::ParsedPacketBuffer parsed_packet_buffer(buffer, header);
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
-  if (it != m_parsed_packet_buffer_map.end())
+  for (auto& slot : m_slots)
   {
-    it->second.push_back(parsed_packet_buffer);
+    if (slot.in_use && now - slot.started > m_limits.max_age)
+    {
+      ++m_statistics.evicted_by_age;
+      resetSlot(slot);
+    }
   }
-  else
+}
+
+void UDPPacketMerger::evictSupersededSlots(const ReassemblySlot& completed_slot)
+{
+  for (auto& slot : m_slots)
   {
-    sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec;
-    vec.push_back(parsed_packet_buffer);
-    m_parsed_packet_buffer_map[header.getIdentification()] = vec;
+    if (slot.in_use && slot.sequence < completed_slot.sequence)
+    {
+      ++m_statistics.evicted_superseded;
+      resetSlot(slot);
+    }
   }
-  return true;
 }
 
-bool UDPPacketMerger::deployPacketIfComplete(datastructure::DatagramHeader& header)
+UDPPacketMerger::ReassemblySlot*
+UDPPacketMerger::findOldestSlot(const ReassemblySlot* excluded_slot)
+{
+  ReassemblySlot* oldest_slot = nullptr;
+  for (auto& slot : m_slots)
+  {
+    if (slot.in_use && &slot != excluded_slot &&
+        (!oldest_slot || slot.sequence < oldest_slot->sequence))
+    {
+      oldest_slot = &slot;
+    }
+  }
+  return oldest_slot;
+}
+
+UDPPacketMerger::ReassemblySlot*
+UDPPacketMerger::findOrAssignSlot(const sick::datastructure::DatagramHeader& header,
+                                  const std::chrono::steady_clock::time_point& now)
 {
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
+  ReassemblySlot* free_slot = nullptr;
+  for (auto& slot : m_slots)
+  {
+    if (!slot.in_use)
+    {
+      free_slot = free_slot ? free_slot : &slot;
+      continue;
+    }
+    if (slot.identification == header.getIdentification())
+    {
+      return &slot;
+    }
+  }
 
-  if (it == m_parsed_packet_buffer_map.end())
+  // The fragments pin at least the length of the data packet.
+  if (header.getTotalLength() > m_limits.max_memory)
   {
-    return false;
+    return nullptr;
   }
-  if (!checkIfComplete(header))
+  if (!free_slot)
   {
-    return false;
+    free_slot = findOldestSlot();
+    ++m_statistics.evicted_by_count;
+    resetSlot(*free_slot);
   }
 
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec =
-    getSortedParsedPacketBufferForIdentification(header);
-  std::vector<uint8_t> headerless_packet_buffer = removeHeaderFromParsedPacketBuffer(vec);
-  m_deployed_packet_buffer.setBuffer(headerless_packet_buffer);
-  m_parsed_packet_buffer_map.erase(header.getIdentification());
-  return true;
+  ReassemblySlot& slot = *free_slot;
+  slot.in_use          = true;
+  slot.identification  = header.getIdentification();
+  slot.total_length    = header.getTotalLength();
+  slot.sequence        = m_next_sequence++;
+  slot.started         = now;
+  return &slot;
 }
 
-bool UDPPacketMerger::checkIfComplete(sick::datastructure::DatagramHeader& header)
+void UDPPacketMerger::resetSlot(ReassemblySlot& slot)
 {
-  uint32_t total_length = header.getTotalLength();
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec =
-    getSortedParsedPacketBufferForIdentification(header);
-  uint32_t cur_length = calcualteCurrentLengthOfParsedPacketBuffer(vec);
-  if (cur_length != total_length)
+  m_memory_in_use -= slot.pinned_memory;
+
+  slot.in_use          = false;
+  slot.received_length = 0;
+  slot.pinned_memory   = 0;
+  // Keeps the capacity, so a slot does not allocate again once it has seen a complete data packet.
+  slot.fragments.clear();
+}
+
+bool UDPPacketMerger::writeFragment(ReassemblySlot& slot,
+                                    const sick::datastructure::PacketBuffer& buffer,
+                                    const sick::datastructure::DatagramHeader& header)
+{
+  const uint32_t offset = header.getFragmentOffset();
+  const uint32_t length = buffer.getLength() - sick::datastructure::DatagramHeader::HEADER_SIZE;
+  if (length == 0 || header.getTotalLength() != slot.total_length ||
+      offset > slot.total_length || length > slot.total_length - offset)
   {
     return false;
   }
-  m_is_complete = true;
-  return true;
-}
 
-uint32_t UDPPacketMerger::calcualteCurrentLengthOfParsedPacketBuffer(
-  const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec)
-{
-  uint32_t cur_length = 0;
+  // Duplicated or overlapping fragments must not be counted twice.
+  auto it = slot.fragments.begin();
+  for (; it != slot.fragments.end() && it->position < offset; ++it)
+  {
+    if (it->position + it->length > offset)
+    {
+      return false;
+    }
+  }
+  if (it != slot.fragments.end() && offset + length > it->position)
+  {
+    return false;
+  }
 
-  for (auto& parsed_packet_buffer : vec)
+  sick::datastructure::PacketBuffer::Fragment fragment;
+  fragment.buffer = buffer.getStorage();
+  if (!reserveMemory(slot, fragment.buffer->capacity()))
   {
-    sick::datastructure::PacketBuffer packet_buffer = parsed_packet_buffer.getPacketBuffer();
-    cur_length += (packet_buffer.getLength() - sick::datastructure::DatagramHeader::HEADER_SIZE);
+    return false;
   }
-  return cur_length;
+  fragment.offset   = sick::datastructure::DatagramHeader::HEADER_SIZE;
+  fragment.length   = length;
+  fragment.position = offset;
+  slot.fragments.insert(it, fragment);
+  slot.received_length += length;
+  return true;
 }
 
-sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector
-UDPPacketMerger::getSortedParsedPacketBufferForIdentification(
-  const sick::datastructure::DatagramHeader& header)
+bool UDPPacketMerger::reserveMemory(ReassemblySlot& slot, std::size_t memory)
 {
-  auto it = m_parsed_packet_buffer_map.find(header.getIdentification());
-  sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector vec = it->second;
-  std::sort(
-    vec.begin(), vec.end(), sick::datastructure::ParsedPacketBuffer::sortForIncreasingOffset);
-  return vec;
+  while (m_memory_in_use + memory > m_limits.max_memory)
+  {
+    ReassemblySlot* oldest_slot = findOldestSlot(&slot);
+    ++m_statistics.evicted_by_memory;
+    if (!oldest_slot)
+    {
+      // The data packet cannot be completed within the limit on its own.
+      resetSlot(slot);
+      return false;
+    }
+    resetSlot(*oldest_slot);
+  }
+  m_memory_in_use += memory;
+  slot.pinned_memory += memory;
+  return true;
 }
 
-std::vector<uint8_t> UDPPacketMerger::removeHeaderFromParsedPacketBuffer(
-  const sick::datastructure::ParsedPacketBuffer::ParsedPacketBufferVector& vec)
+void UDPPacketMerger::deploySlot(ReassemblySlot& slot)
 {
-  std::vector<uint8_t> headerless_packet_buffer;
-  for (auto& parsed_packet_buffer : vec)
+  // The fragments are handed over, the slot continues with a fragment list released by an earlier
+  // data packet. Only while none has been released yet, e.g. since the consumer keeps the data
+  // packets, a new one is allocated.
+  const std::size_t capacity = slot.fragments.capacity();
+  m_deployed_packet_buffer   = sick::datastructure::PacketBuffer(std::move(slot.fragments));
+  m_is_complete              = true;
+  ++m_statistics.completed;
+  if (!m_spare_fragments.empty())
   {
-    sick::datastructure::PacketBuffer packet_buffer = parsed_packet_buffer.getPacketBuffer();
-
-    // This insert is memory safe because we constructed the buffer in this function
-    const std::shared_ptr<std::vector<uint8_t> const> vec_ptr = packet_buffer.getBuffer();
-    headerless_packet_buffer.insert(headerless_packet_buffer.end(),
-                                    vec_ptr->begin() +
-                                      sick::datastructure::DatagramHeader::HEADER_SIZE,
-                                    vec_ptr->end());
+    slot.fragments = std::move(m_spare_fragments.back());
+    m_spare_fragments.pop_back();
   }
-  return headerless_packet_buffer;
+  else
+  {
+    slot.fragments = sick::datastructure::PacketBuffer::FragmentVector();
+    slot.fragments.reserve(capacity);
+  }
+  resetSlot(slot);
 }
 
-
 } // namespace data_processing
 } // namespace sick
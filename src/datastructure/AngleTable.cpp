@@ -0,0 +1,98 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file AngleTable.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/AngleTable.h"
+
+#include <cmath>
+
+namespace sick {
+namespace datastructure {
+
+AngleTable::AngleTable(float start_angle, float angular_beam_resolution, uint32_t number_of_beams)
+  : m_start_angle(start_angle)
+  , m_angular_beam_resolution(angular_beam_resolution)
+  , m_number_of_beams(number_of_beams)
+  , m_angles(number_of_beams)
+  , m_sines(number_of_beams)
+  , m_cosines(number_of_beams)
+{
+  const double deg_to_rad = M_PI / 180.0;
+  for (uint32_t i = 0; i < number_of_beams; ++i)
+  {
+    double angle = static_cast<double>(start_angle) +
+                   static_cast<double>(i) * static_cast<double>(angular_beam_resolution);
+    m_angles[i]  = static_cast<float>(angle);
+    m_sines[i]   = static_cast<float>(std::sin(angle * deg_to_rad));
+    m_cosines[i] = static_cast<float>(std::cos(angle * deg_to_rad));
+  }
+}
+
+bool AngleTable::matches(float start_angle,
+                         float angular_beam_resolution,
+                         uint32_t number_of_beams) const
+{
+  return m_start_angle == start_angle && m_angular_beam_resolution == angular_beam_resolution &&
+         m_number_of_beams == number_of_beams;
+}
+
+float AngleTable::getStartAngle() const
+{
+  return m_start_angle;
+}
+
+float AngleTable::getAngularBeamResolution() const
+{
+  return m_angular_beam_resolution;
+}
+
+uint32_t AngleTable::getNumberOfBeams() const
+{
+  return m_number_of_beams;
+}
+
+const std::vector<float>& AngleTable::getAnglesVector() const
+{
+  return m_angles;
+}
+
+const std::vector<float>& AngleTable::getSinesVector() const
+{
+  return m_sines;
+}
+
+const std::vector<float>& AngleTable::getCosinesVector() const
+{
+  return m_cosines;
+}
+
+} // namespace datastructure
+} // namespace sick
@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/ApplicationData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -42,7 +44,7 @@ ApplicationData::ApplicationData()
 {
 }
 
-ApplicationInputs ApplicationData::getInputs() const
+const ApplicationInputs& ApplicationData::getInputs() const
 {
   return m_inputs;
 }
@@ -52,7 +54,12 @@ void ApplicationData::setInputs(const ApplicationInputs& inputs)
   m_inputs = inputs;
 }
 
-ApplicationOutputs ApplicationData::getOutputs() const
+void ApplicationData::setInputs(ApplicationInputs&& inputs)
+{
+  m_inputs = std::move(inputs);
+}
+
+const ApplicationOutputs& ApplicationData::getOutputs() const
 {
   return m_outputs;
 }
@@ -62,6 +69,11 @@ void ApplicationData::setOutputs(const ApplicationOutputs& outputs)
   m_outputs = outputs;
 }
 
+void ApplicationData::setOutputs(ApplicationOutputs&& outputs)
+{
+  m_outputs = std::move(outputs);
+}
+
 bool ApplicationData::isEmpty() const
 {
   return m_is_empty;
@@ -41,45 +41,90 @@ ApplicationInputs::ApplicationInputs() {}
 
 std::vector<bool> ApplicationInputs::getUnsafeInputsInputSourcesVector() const
 {
-  return m_unsafe_inputs_input_sources_vector;
+  return m_unsafe_inputs_input_sources.toVector();
 }
 
 void ApplicationInputs::setUnsafeInputsInputSourcesVector(
   const std::vector<bool>& unsafe_inputs_input_sources_vector)
 {
-  m_unsafe_inputs_input_sources_vector = unsafe_inputs_input_sources_vector;
+  m_unsafe_inputs_input_sources = UnsafeInputsWord::fromVector(unsafe_inputs_input_sources_vector);
+}
+
+ApplicationInputs::UnsafeInputsWord ApplicationInputs::getUnsafeInputsInputSources() const
+{
+  return m_unsafe_inputs_input_sources;
+}
+
+void ApplicationInputs::setUnsafeInputsInputSources(
+  const UnsafeInputsWord& unsafe_inputs_input_sources)
+{
+  m_unsafe_inputs_input_sources = unsafe_inputs_input_sources;
 }
 
 std::vector<bool> ApplicationInputs::getUnsafeInputsFlagsVector() const
 {
-  return m_unsafe_inputs_flags_vector;
+  return m_unsafe_inputs_flags.toVector();
 }
 
 void ApplicationInputs::setUnsafeInputsFlagsVector(
   const std::vector<bool>& unsafe_inputs_flags_vector)
 {
-  m_unsafe_inputs_flags_vector = unsafe_inputs_flags_vector;
+  m_unsafe_inputs_flags = UnsafeInputsWord::fromVector(unsafe_inputs_flags_vector);
+}
+
+ApplicationInputs::UnsafeInputsWord ApplicationInputs::getUnsafeInputsFlags() const
+{
+  return m_unsafe_inputs_flags;
+}
+
+void ApplicationInputs::setUnsafeInputsFlags(const UnsafeInputsWord& unsafe_inputs_flags)
+{
+  m_unsafe_inputs_flags = unsafe_inputs_flags;
 }
 
 std::vector<uint16_t> ApplicationInputs::getMonitoringCasevector() const
 {
-  return m_monitoring_case_vector;
+  return std::vector<uint16_t>(m_monitoring_cases.begin(), m_monitoring_cases.end());
 }
 
 void ApplicationInputs::setMonitoringCaseVector(const std::vector<uint16_t>& monitoring_case_vector)
 {
-  m_monitoring_case_vector = monitoring_case_vector;
+  const std::size_t num_values = std::min(monitoring_case_vector.size(), m_monitoring_cases.size());
+  m_monitoring_cases.fill(0);
+  std::copy(monitoring_case_vector.begin(),
+            monitoring_case_vector.begin() + num_values,
+            m_monitoring_cases.begin());
+}
+
+const ApplicationInputs::MonitoringCaseArray& ApplicationInputs::getMonitoringCases() const
+{
+  return m_monitoring_cases;
+}
+
+void ApplicationInputs::setMonitoringCases(const MonitoringCaseArray& monitoring_cases)
+{
+  m_monitoring_cases = monitoring_cases;
 }
 
 std::vector<bool> ApplicationInputs::getMonitoringCaseFlagsVector() const
 {
-  return m_monitoring_case_flags_vector;
+  return m_monitoring_case_flags.toVector();
 }
 
 void ApplicationInputs::setMonitoringCaseFlagsVector(
   const std::vector<bool>& monitoring_case_flags_vector)
 {
-  m_monitoring_case_flags_vector = monitoring_case_flags_vector;
+  m_monitoring_case_flags = MonitoringCaseFlagsWord::fromVector(monitoring_case_flags_vector);
+}
+
+ApplicationInputs::MonitoringCaseFlagsWord ApplicationInputs::getMonitoringCaseFlags() const
+{
+  return m_monitoring_case_flags;
+}
+
+void ApplicationInputs::setMonitoringCaseFlags(const MonitoringCaseFlagsWord& monitoring_case_flags)
+{
+  m_monitoring_case_flags = monitoring_case_flags;
 }
 
 int16_t ApplicationInputs::getVelocity0() const
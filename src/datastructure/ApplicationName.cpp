@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ApplicationName.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ApplicationName::ApplicationName() {}
 
-std::string ApplicationName::getVersionCVersion() const
+const std::string& ApplicationName::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void ApplicationName::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void ApplicationName::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t ApplicationName::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
@@ -89,7 +96,7 @@ void ApplicationName::setNameLength(const uint32_t& name_length)
   m_name_length = name_length;
 }
 
-std::string ApplicationName::getApplicationName() const
+const std::string& ApplicationName::getApplicationName() const
 {
   return m_application_name;
 }
@@ -99,6 +106,11 @@ void ApplicationName::setApplicationName(const std::string& application_name)
   m_application_name = application_name;
 }
 
+void ApplicationName::setApplicationName(std::string&& application_name)
+{
+  m_application_name = std::move(application_name);
+}
+
 
 } // namespace datastructure
 } // namespace sick
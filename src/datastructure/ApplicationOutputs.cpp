@@ -41,54 +41,109 @@ ApplicationOutputs::ApplicationOutputs() {}
 
 std::vector<bool> ApplicationOutputs::getEvalOutVector() const
 {
-  return m_eval_out_vector;
+  return m_eval_out.toVector();
 }
 
 void ApplicationOutputs::setEvalOutVector(const std::vector<bool>& eval_out_vector)
 {
-  m_eval_out_vector = eval_out_vector;
+  m_eval_out = EvalOutWord::fromVector(eval_out_vector);
+}
+
+ApplicationOutputs::EvalOutWord ApplicationOutputs::getEvalOut() const
+{
+  return m_eval_out;
+}
+
+void ApplicationOutputs::setEvalOut(const EvalOutWord& eval_out)
+{
+  m_eval_out = eval_out;
 }
 
 std::vector<bool> ApplicationOutputs::getEvalOutIsSafeVector() const
 {
-  return m_eval_out_is_safe_vector;
+  return m_eval_out_is_safe.toVector();
 }
 
 void ApplicationOutputs::setEvalOutIsSafeVector(const std::vector<bool>& eval_out_is_safe_vector)
 {
-  m_eval_out_is_safe_vector = eval_out_is_safe_vector;
+  m_eval_out_is_safe = EvalOutWord::fromVector(eval_out_is_safe_vector);
+}
+
+ApplicationOutputs::EvalOutWord ApplicationOutputs::getEvalOutIsSafe() const
+{
+  return m_eval_out_is_safe;
+}
+
+void ApplicationOutputs::setEvalOutIsSafe(const EvalOutWord& eval_out_is_safe)
+{
+  m_eval_out_is_safe = eval_out_is_safe;
 }
 
 std::vector<bool> ApplicationOutputs::getEvalOutIsValidVector() const
 {
-  return m_eval_out_is_valid_vector;
+  return m_eval_out_is_valid.toVector();
 }
 
 void ApplicationOutputs::setEvalOutIsValidVector(const std::vector<bool>& eval_out_is_valid_vector)
 {
-  m_eval_out_is_valid_vector = eval_out_is_valid_vector;
+  m_eval_out_is_valid = EvalOutWord::fromVector(eval_out_is_valid_vector);
+}
+
+ApplicationOutputs::EvalOutWord ApplicationOutputs::getEvalOutIsValid() const
+{
+  return m_eval_out_is_valid;
+}
+
+void ApplicationOutputs::setEvalOutIsValid(const EvalOutWord& eval_out_is_valid)
+{
+  m_eval_out_is_valid = eval_out_is_valid;
 }
 
 std::vector<uint16_t> ApplicationOutputs::getMonitoringCaseVector() const
 {
-  return m_monitoring_case_vector;
+  return std::vector<uint16_t>(m_monitoring_cases.begin(), m_monitoring_cases.end());
 }
 
 void ApplicationOutputs::setMonitoringCaseVector(
   const std::vector<uint16_t>& monitoring_case_vector)
 {
-  m_monitoring_case_vector = monitoring_case_vector;
+  const std::size_t num_values = std::min(monitoring_case_vector.size(), m_monitoring_cases.size());
+  m_monitoring_cases.fill(0);
+  std::copy(monitoring_case_vector.begin(),
+            monitoring_case_vector.begin() + num_values,
+            m_monitoring_cases.begin());
+}
+
+const ApplicationOutputs::MonitoringCaseArray& ApplicationOutputs::getMonitoringCases() const
+{
+  return m_monitoring_cases;
+}
+
+void ApplicationOutputs::setMonitoringCases(const MonitoringCaseArray& monitoring_cases)
+{
+  m_monitoring_cases = monitoring_cases;
 }
 
 std::vector<bool> ApplicationOutputs::getMonitoringCaseFlagsVector() const
 {
-  return m_monitoring_case_flags_vector;
+  return m_monitoring_case_flags.toVector();
 }
 
 void ApplicationOutputs::setMonitoringCaseFlagsVector(
   const std::vector<bool>& monitoring_case_flags_vector)
 {
-  m_monitoring_case_flags_vector = monitoring_case_flags_vector;
+  m_monitoring_case_flags = MonitoringCaseFlagsWord::fromVector(monitoring_case_flags_vector);
+}
+
+ApplicationOutputs::MonitoringCaseFlagsWord ApplicationOutputs::getMonitoringCaseFlags() const
+{
+  return m_monitoring_case_flags;
+}
+
+void ApplicationOutputs::setMonitoringCaseFlags(
+  const MonitoringCaseFlagsWord& monitoring_case_flags)
+{
+  m_monitoring_case_flags = monitoring_case_flags;
 }
 
 int8_t ApplicationOutputs::getSleepModeOutput() const
@@ -226,24 +281,52 @@ void ApplicationOutputs::setVelocity1TransmittedSafely(bool velocity_1_transmitt
 
 std::vector<int16_t> ApplicationOutputs::getResultingVelocityVector() const
 {
-  return m_resulting_velocity_vector;
+  return std::vector<int16_t>(m_resulting_velocities.begin(), m_resulting_velocities.end());
 }
 
 void ApplicationOutputs::setResultingVelocityVector(
   const std::vector<int16_t>& resulting_velocity_vector)
 {
-  m_resulting_velocity_vector = resulting_velocity_vector;
+  const std::size_t num_values =
+    std::min(resulting_velocity_vector.size(), m_resulting_velocities.size());
+  m_resulting_velocities.fill(0);
+  std::copy(resulting_velocity_vector.begin(),
+            resulting_velocity_vector.begin() + num_values,
+            m_resulting_velocities.begin());
+}
+
+const ApplicationOutputs::ResultingVelocityArray& ApplicationOutputs::getResultingVelocities() const
+{
+  return m_resulting_velocities;
+}
+
+void ApplicationOutputs::setResultingVelocities(const ResultingVelocityArray& resulting_velocities)
+{
+  m_resulting_velocities = resulting_velocities;
 }
 
 std::vector<bool> ApplicationOutputs::getResultingVelocityIsValidVector() const
 {
-  return m_resulting_velocity_is_valid_vector;
+  return m_resulting_velocity_is_valid.toVector();
 }
 
 void ApplicationOutputs::setResultingVelocityIsValidVector(
   const std::vector<bool>& resulting_velocity_is_valid_vector)
 {
-  m_resulting_velocity_is_valid_vector = resulting_velocity_is_valid_vector;
+  m_resulting_velocity_is_valid =
+    ResultingVelocityFlagsWord::fromVector(resulting_velocity_is_valid_vector);
+}
+
+ApplicationOutputs::ResultingVelocityFlagsWord
+ApplicationOutputs::getResultingVelocityIsValid() const
+{
+  return m_resulting_velocity_is_valid;
+}
+
+void ApplicationOutputs::setResultingVelocityIsValid(
+  const ResultingVelocityFlagsWord& resulting_velocity_is_valid)
+{
+  m_resulting_velocity_is_valid = resulting_velocity_is_valid;
 }
 
 bool ApplicationOutputs::getFlagsSleepModeOutputIsValid() const
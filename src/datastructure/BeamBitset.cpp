@@ -0,0 +1,278 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file BeamBitset.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/BeamBitset.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace datastructure {
+
+BeamBitset::const_iterator::const_iterator(const BeamBitset* bitset, std::size_t index)
+  : m_bitset(bitset)
+  , m_index(index)
+{
+}
+
+bool BeamBitset::const_iterator::operator*() const
+{
+  return m_bitset->getFlag(m_index);
+}
+
+BeamBitset::const_iterator& BeamBitset::const_iterator::operator++()
+{
+  ++m_index;
+  return *this;
+}
+
+BeamBitset::const_iterator BeamBitset::const_iterator::operator++(int)
+{
+  const_iterator previous = *this;
+  ++m_index;
+  return previous;
+}
+
+bool BeamBitset::const_iterator::operator==(const const_iterator& other) const
+{
+  return m_bitset == other.m_bitset && m_index == other.m_index;
+}
+
+bool BeamBitset::const_iterator::operator!=(const const_iterator& other) const
+{
+  return !(*this == other);
+}
+
+BeamBitset::BeamBitset()
+  : m_size(0)
+  , m_words()
+{
+}
+
+BeamBitset::BeamBitset(std::size_t size)
+  : m_size(size)
+  , m_words(getNumWords(size), 0)
+{
+}
+
+BeamBitset::BeamBitset(const std::vector<bool>& flags_vector)
+  : BeamBitset(flags_vector.size())
+{
+  for (std::size_t i = 0; i < flags_vector.size(); ++i)
+  {
+    setFlag(i, flags_vector[i]);
+  }
+}
+
+void BeamBitset::assign(const uint8_t* bytes, std::size_t num_bytes, std::size_t size)
+{
+  m_size = size;
+  m_words.assign(getNumWords(size), 0);
+  std::size_t num_used_bytes = std::min(num_bytes, (size + 7) / 8);
+  for (std::size_t i = 0; i < num_used_bytes; ++i)
+  {
+    m_words[i / 8] |= static_cast<Word>(bytes[i]) << (8 * (i % 8));
+  }
+  if (size % BITS_PER_WORD != 0)
+  {
+    m_words.back() &= (static_cast<Word>(1) << (size % BITS_PER_WORD)) - 1;
+  }
+}
+
+std::size_t BeamBitset::getSize() const
+{
+  return m_size;
+}
+
+bool BeamBitset::getFlag(std::size_t index) const
+{
+  return (m_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+}
+
+void BeamBitset::setFlag(std::size_t index, bool value)
+{
+  Word bit = static_cast<Word>(1) << (index % BITS_PER_WORD);
+  if (value)
+  {
+    m_words[index / BITS_PER_WORD] |= bit;
+  }
+  else
+  {
+    m_words[index / BITS_PER_WORD] &= ~bit;
+  }
+}
+
+std::size_t BeamBitset::countSetFlags() const
+{
+  std::size_t count = 0;
+  for (Word word : m_words)
+  {
+    count += countBits(word);
+  }
+  return count;
+}
+
+std::size_t BeamBitset::countSetFlags(const BeamBitset& mask) const
+{
+  std::size_t num_words = std::min(m_words.size(), mask.m_words.size());
+  std::size_t count     = 0;
+  for (std::size_t i = 0; i < num_words; ++i)
+  {
+    count += countBits(m_words[i] & mask.m_words[i]);
+  }
+  return count;
+}
+
+bool BeamBitset::isAnySet() const
+{
+  for (Word word : m_words)
+  {
+    if (word != 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::size_t BeamBitset::findFirstSetFlag() const
+{
+  for (std::size_t i = 0; i < m_words.size(); ++i)
+  {
+    if (m_words[i] != 0)
+    {
+      return i * BITS_PER_WORD + findLowestBit(m_words[i]);
+    }
+  }
+  return NPOS;
+}
+
+std::size_t BeamBitset::findNextSetFlag(std::size_t index) const
+{
+  ++index;
+  if (index >= m_size)
+  {
+    return NPOS;
+  }
+  std::size_t i = index / BITS_PER_WORD;
+  Word word     = m_words[i] & (~static_cast<Word>(0) << (index % BITS_PER_WORD));
+  while (word == 0)
+  {
+    if (++i == m_words.size())
+    {
+      return NPOS;
+    }
+    word = m_words[i];
+  }
+  return i * BITS_PER_WORD + findLowestBit(word);
+}
+
+BeamBitset& BeamBitset::operator&=(const BeamBitset& mask)
+{
+  for (std::size_t i = 0; i < m_words.size(); ++i)
+  {
+    m_words[i] &= i < mask.m_words.size() ? mask.m_words[i] : 0;
+  }
+  return *this;
+}
+
+BeamBitset BeamBitset::operator&(const BeamBitset& mask) const
+{
+  BeamBitset result = *this;
+  result &= mask;
+  return result;
+}
+
+bool BeamBitset::operator==(const BeamBitset& other) const
+{
+  return m_size == other.m_size && m_words == other.m_words;
+}
+
+bool BeamBitset::operator!=(const BeamBitset& other) const
+{
+  return !(*this == other);
+}
+
+const std::vector<BeamBitset::Word>& BeamBitset::getWords() const
+{
+  return m_words;
+}
+
+std::vector<bool> BeamBitset::toVector() const
+{
+  return std::vector<bool>(begin(), end());
+}
+
+BeamBitset::const_iterator BeamBitset::begin() const
+{
+  return const_iterator(this, 0);
+}
+
+BeamBitset::const_iterator BeamBitset::end() const
+{
+  return const_iterator(this, m_size);
+}
+
+std::size_t BeamBitset::getNumWords(std::size_t size)
+{
+  return (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+std::size_t BeamBitset::countBits(Word word)
+{
+#ifdef __GNUC__
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+  for (; word != 0; word &= word - 1)
+  {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+std::size_t BeamBitset::findLowestBit(Word word)
+{
+#ifdef __GNUC__
+  return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+  std::size_t index = 0;
+  for (; (word & 1) == 0; word >>= 1)
+  {
+    ++index;
+  }
+  return index;
+#endif
+}
+
+} // namespace datastructure
+} // namespace sick
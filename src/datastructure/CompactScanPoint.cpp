@@ -0,0 +1,154 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file CompactScanPoint.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/CompactScanPoint.h"
+
+namespace sick {
+namespace datastructure {
+
+CompactScanPoint::CompactScanPoint()
+  : m_distance(0)
+  , m_reflectivity(0)
+  , m_status(0)
+  , m_beam_index(0)
+{
+}
+
+CompactScanPoint::CompactScanPoint(uint32_t beam_index,
+                                   uint16_t distance,
+                                   uint8_t reflectivity,
+                                   uint8_t status)
+  : m_distance(distance)
+  , m_reflectivity(reflectivity)
+  , m_status(status)
+  , m_beam_index(beam_index)
+{
+}
+
+CompactScanPoint::CompactScanPoint(const ScanPoint& scan_point, uint32_t beam_index)
+  : m_distance(scan_point.getDistance())
+  , m_reflectivity(scan_point.getReflectivity())
+  , m_status(toStatusByte(scan_point))
+  , m_beam_index(beam_index)
+{
+}
+
+ScanPoint CompactScanPoint::toScanPoint(const AngleTable& angle_table) const
+{
+  uint16_t distance          = m_distance;
+  uint8_t reflectivity       = m_reflectivity;
+  bool valid                 = getValidBit();
+  bool infinite              = getInfiniteBit();
+  bool glare                 = getGlareBit();
+  bool reflector             = getReflectorBit();
+  bool contamination         = getContaminationBit();
+  bool contamination_warning = getContaminationWarningBit();
+  return ScanPoint(getAngle(angle_table),
+                   distance,
+                   reflectivity,
+                   valid,
+                   infinite,
+                   glare,
+                   reflector,
+                   contamination,
+                   contamination_warning);
+}
+
+uint32_t CompactScanPoint::getBeamIndex() const
+{
+  return m_beam_index;
+}
+
+float CompactScanPoint::getAngle(const AngleTable& angle_table) const
+{
+  return angle_table.getAnglesVector()[m_beam_index];
+}
+
+uint16_t CompactScanPoint::getDistance() const
+{
+  return m_distance;
+}
+
+uint8_t CompactScanPoint::getReflectivity() const
+{
+  return m_reflectivity;
+}
+
+uint8_t CompactScanPoint::getStatusByte() const
+{
+  return m_status;
+}
+
+bool CompactScanPoint::getValidBit() const
+{
+  return static_cast<bool>(m_status & STATUS_VALID_BIT);
+}
+
+bool CompactScanPoint::getInfiniteBit() const
+{
+  return static_cast<bool>(m_status & STATUS_INFINITE_BIT);
+}
+
+bool CompactScanPoint::getGlareBit() const
+{
+  return static_cast<bool>(m_status & STATUS_GLARE_BIT);
+}
+
+bool CompactScanPoint::getReflectorBit() const
+{
+  return static_cast<bool>(m_status & STATUS_REFLECTOR_BIT);
+}
+
+bool CompactScanPoint::getContaminationBit() const
+{
+  return static_cast<bool>(m_status & STATUS_CONTAMINATION_BIT);
+}
+
+bool CompactScanPoint::getContaminationWarningBit() const
+{
+  return static_cast<bool>(m_status & STATUS_CONTAMINATION_WARNING_BIT);
+}
+
+uint8_t CompactScanPoint::toStatusByte(const ScanPoint& scan_point)
+{
+  uint8_t status = 0;
+  status |= scan_point.getValidBit() ? STATUS_VALID_BIT : 0;
+  status |= scan_point.getInfiniteBit() ? STATUS_INFINITE_BIT : 0;
+  status |= scan_point.getGlareBit() ? STATUS_GLARE_BIT : 0;
+  status |= scan_point.getReflectorBit() ? STATUS_REFLECTOR_BIT : 0;
+  status |= scan_point.getContaminationBit() ? STATUS_CONTAMINATION_BIT : 0;
+  status |= scan_point.getContaminationWarningBit() ? STATUS_CONTAMINATION_WARNING_BIT : 0;
+  return status;
+}
+
+} // namespace datastructure
+} // namespace sick
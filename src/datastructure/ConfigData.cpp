@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ConfigData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ConfigData::ConfigData() {}
 
-std::string ConfigData::getVersionCVersion() const
+const std::string& ConfigData::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void ConfigData::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void ConfigData::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t ConfigData::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
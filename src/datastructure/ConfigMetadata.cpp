@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ConfigMetadata.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ConfigMetadata::ConfigMetadata() {}
 
-std::string ConfigMetadata::getVersionCVersion() const
+const std::string& ConfigMetadata::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void ConfigMetadata::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void ConfigMetadata::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t ConfigMetadata::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
@@ -139,7 +146,7 @@ void ConfigMetadata::setOverallChecksum(const uint32_t& overall_checksum)
   m_overall_checksum = overall_checksum;
 }
 
-std::vector<uint32_t> ConfigMetadata::getIntegrityHash() const
+const std::vector<uint32_t>& ConfigMetadata::getIntegrityHash() const
 {
   return m_integrity_hash;
 }
@@ -149,6 +156,11 @@ void ConfigMetadata::setIntegrityHash(const std::vector<uint32_t>& integrity_has
   m_integrity_hash = integrity_hash;
 }
 
+void ConfigMetadata::setIntegrityHash(std::vector<uint32_t>&& integrity_hash)
+{
+  m_integrity_hash = std::move(integrity_hash);
+}
+
 
 } // namespace datastructure
 } // namespace sick
@@ -34,73 +34,566 @@
 
 #include "sick_safetyscanners_base/datastructure/Data.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
-Data::Data() {}
+Data::Data()
+  : m_has_data_header(false)
+  , m_has_general_system_state(false)
+  , m_has_derived_values(false)
+  , m_has_measurement_data(false)
+  , m_has_intrusion_data(false)
+  , m_has_application_data(false)
+{
+}
+
+Data::Data(const Data& other)
+  : Data()
+{
+  *this = other;
+}
+
+Data::Data(Data&& other)
+  : Data()
+{
+  *this = std::move(other);
+}
+
+Data& Data::operator=(const Data& other)
+{
+  if (this == &other)
+  {
+    return *this;
+  }
+  // Pending blocks of the source may be decoded concurrently through const accesses.
+  std::lock_guard<std::mutex> lock(other.m_pending_blocks.mutex);
+
+  m_data_header              = other.m_data_header;
+  m_general_system_state     = other.m_general_system_state;
+  m_derived_values           = other.m_derived_values;
+  m_measurement_data         = other.m_measurement_data;
+  m_intrusion_data           = other.m_intrusion_data;
+  m_application_data         = other.m_application_data;
+  m_has_data_header          = other.m_has_data_header;
+  m_has_general_system_state = other.m_has_general_system_state;
+  m_has_derived_values       = other.m_has_derived_values;
+  m_has_measurement_data     = other.m_has_measurement_data;
+  m_has_intrusion_data       = other.m_has_intrusion_data;
+  m_has_application_data     = other.m_has_application_data;
+  m_pending_blocks           = other.m_pending_blocks;
+  return *this;
+}
+
+Data& Data::operator=(Data&& other)
+{
+  if (this == &other)
+  {
+    return *this;
+  }
+  std::lock_guard<std::mutex> lock(other.m_pending_blocks.mutex);
+
+  m_data_header              = std::move(other.m_data_header);
+  m_general_system_state     = std::move(other.m_general_system_state);
+  m_derived_values           = std::move(other.m_derived_values);
+  m_measurement_data         = std::move(other.m_measurement_data);
+  m_intrusion_data           = std::move(other.m_intrusion_data);
+  m_application_data         = std::move(other.m_application_data);
+  m_has_data_header          = other.m_has_data_header;
+  m_has_general_system_state = other.m_has_general_system_state;
+  m_has_derived_values       = other.m_has_derived_values;
+  m_has_measurement_data     = other.m_has_measurement_data;
+  m_has_intrusion_data       = other.m_has_intrusion_data;
+  m_has_application_data     = other.m_has_application_data;
+  m_pending_blocks           = std::move(other.m_pending_blocks);
+  return *this;
+}
+
+bool Data::hasDataHeader() const
+{
+  return m_has_data_header;
+}
+
+const DataHeader& Data::getDataHeader() const
+{
+  return m_data_header;
+}
+
+DataHeader& Data::getMutableDataHeader()
+{
+  m_has_data_header = true;
+  return m_data_header;
+}
+
+void Data::setDataHeader(const DataHeader& data_header)
+{
+  m_data_header     = data_header;
+  m_has_data_header = true;
+}
 
-std::shared_ptr<DataHeader> Data::getDataHeaderPtr() const
+void Data::setDataHeader(DataHeader&& data_header)
 {
-  return m_data_header_ptr;
+  m_data_header     = std::move(data_header);
+  m_has_data_header = true;
 }
 
+std::shared_ptr<const DataHeader> Data::getDataHeaderPtr(const std::shared_ptr<const Data>& data)
+{
+  if (!data)
+  {
+    return nullptr;
+  }
+  // Decodes a pending block, which marks it as present
+  const DataHeader& data_header = data->getDataHeader();
+  if (!data->hasDataHeader())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const DataHeader>(data, &data_header);
+}
 
 void Data::setDataHeaderPtr(const std::shared_ptr<DataHeader>& data_header_ptr)
 {
-  m_data_header_ptr = data_header_ptr;
+  if (!data_header_ptr)
+  {
+    m_has_data_header = false;
+    return;
+  }
+  setDataHeader(*data_header_ptr);
 }
 
-std::shared_ptr<GeneralSystemState> Data::getGeneralSystemStatePtr() const
+bool Data::hasGeneralSystemState() const
 {
-  return m_general_system_state_ptr;
+  return m_has_general_system_state;
+}
+
+const GeneralSystemState& Data::getGeneralSystemState() const
+{
+  decodePendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+  return m_general_system_state;
+}
+
+GeneralSystemState& Data::getMutableGeneralSystemState()
+{
+  decodePendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+  m_has_general_system_state = true;
+  return m_general_system_state;
+}
+
+void Data::setGeneralSystemState(const GeneralSystemState& general_system_state)
+{
+  dropPendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+  m_general_system_state     = general_system_state;
+  m_has_general_system_state = true;
+}
+
+void Data::setGeneralSystemState(GeneralSystemState&& general_system_state)
+{
+  dropPendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+  m_general_system_state     = std::move(general_system_state);
+  m_has_general_system_state = true;
+}
+
+std::shared_ptr<const GeneralSystemState> Data::getGeneralSystemStatePtr(
+  const std::shared_ptr<const Data>& data)
+{
+  if (!data)
+  {
+    return nullptr;
+  }
+  const GeneralSystemState& general_system_state = data->getGeneralSystemState();
+  if (!data->hasGeneralSystemState())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const GeneralSystemState>(data, &general_system_state);
 }
 
 void Data::setGeneralSystemStatePtr(
   const std::shared_ptr<GeneralSystemState>& general_system_state_ptr)
 {
-  m_general_system_state_ptr = general_system_state_ptr;
+  if (!general_system_state_ptr)
+  {
+    dropPendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+    m_has_general_system_state = false;
+    return;
+  }
+  setGeneralSystemState(*general_system_state_ptr);
 }
 
-std::shared_ptr<DerivedValues> Data::getDerivedValuesPtr() const
+bool Data::hasDerivedValues() const
 {
-  return m_derived_values_ptr;
+  return m_has_derived_values;
+}
+
+const DerivedValues& Data::getDerivedValues() const
+{
+  return m_derived_values;
+}
+
+DerivedValues& Data::getMutableDerivedValues()
+{
+  m_has_derived_values = true;
+  return m_derived_values;
+}
+
+void Data::setDerivedValues(const DerivedValues& derived_values)
+{
+  m_derived_values     = derived_values;
+  m_has_derived_values = true;
+}
+
+void Data::setDerivedValues(DerivedValues&& derived_values)
+{
+  m_derived_values     = std::move(derived_values);
+  m_has_derived_values = true;
+}
+
+std::shared_ptr<const DerivedValues> Data::getDerivedValuesPtr(
+  const std::shared_ptr<const Data>& data)
+{
+  if (!data)
+  {
+    return nullptr;
+  }
+  const DerivedValues& derived_values = data->getDerivedValues();
+  if (!data->hasDerivedValues())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const DerivedValues>(data, &derived_values);
 }
 
 void Data::setDerivedValuesPtr(const std::shared_ptr<DerivedValues>& derived_values_ptr)
 {
-  m_derived_values_ptr = derived_values_ptr;
+  if (!derived_values_ptr)
+  {
+    m_has_derived_values = false;
+    return;
+  }
+  setDerivedValues(*derived_values_ptr);
+}
+
+bool Data::hasMeasurementData() const
+{
+  return m_has_measurement_data;
+}
+
+const MeasurementData& Data::getMeasurementData() const
+{
+  decodePendingBlock(PENDING_MEASUREMENT_DATA);
+  return m_measurement_data;
+}
+
+MeasurementData& Data::getMutableMeasurementData()
+{
+  decodePendingBlock(PENDING_MEASUREMENT_DATA);
+  m_has_measurement_data = true;
+  return m_measurement_data;
+}
+
+void Data::setMeasurementData(const MeasurementData& measurement_data)
+{
+  dropPendingBlock(PENDING_MEASUREMENT_DATA);
+  m_measurement_data     = measurement_data;
+  m_has_measurement_data = true;
+}
+
+void Data::setMeasurementData(MeasurementData&& measurement_data)
+{
+  dropPendingBlock(PENDING_MEASUREMENT_DATA);
+  m_measurement_data     = std::move(measurement_data);
+  m_has_measurement_data = true;
 }
 
-std::shared_ptr<MeasurementData> Data::getMeasurementDataPtr() const
+std::shared_ptr<const MeasurementData> Data::getMeasurementDataPtr(
+  const std::shared_ptr<const Data>& data)
 {
-  return m_measurement_data_ptr;
+  if (!data)
+  {
+    return nullptr;
+  }
+  const MeasurementData& measurement_data = data->getMeasurementData();
+  if (!data->hasMeasurementData())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const MeasurementData>(data, &measurement_data);
 }
 
 void Data::setMeasurementDataPtr(const std::shared_ptr<MeasurementData>& measurement_data_ptr)
 {
-  m_measurement_data_ptr = measurement_data_ptr;
+  if (!measurement_data_ptr)
+  {
+    dropPendingBlock(PENDING_MEASUREMENT_DATA);
+    m_has_measurement_data = false;
+    return;
+  }
+  setMeasurementData(*measurement_data_ptr);
+}
+
+bool Data::hasIntrusionData() const
+{
+  return m_has_intrusion_data;
+}
+
+const IntrusionData& Data::getIntrusionData() const
+{
+  decodePendingBlock(PENDING_INTRUSION_DATA);
+  return m_intrusion_data;
+}
+
+IntrusionData& Data::getMutableIntrusionData()
+{
+  decodePendingBlock(PENDING_INTRUSION_DATA);
+  m_has_intrusion_data = true;
+  return m_intrusion_data;
+}
+
+void Data::setIntrusionData(const IntrusionData& intrusion_data)
+{
+  dropPendingBlock(PENDING_INTRUSION_DATA);
+  m_intrusion_data     = intrusion_data;
+  m_has_intrusion_data = true;
+}
+
+void Data::setIntrusionData(IntrusionData&& intrusion_data)
+{
+  dropPendingBlock(PENDING_INTRUSION_DATA);
+  m_intrusion_data     = std::move(intrusion_data);
+  m_has_intrusion_data = true;
 }
 
-std::shared_ptr<IntrusionData> Data::getIntrusionDataPtr() const
+std::shared_ptr<const IntrusionData> Data::getIntrusionDataPtr(
+  const std::shared_ptr<const Data>& data)
 {
-  return m_intrusion_data_ptr;
+  if (!data)
+  {
+    return nullptr;
+  }
+  const IntrusionData& intrusion_data = data->getIntrusionData();
+  if (!data->hasIntrusionData())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const IntrusionData>(data, &intrusion_data);
 }
 
 void Data::setIntrusionDataPtr(const std::shared_ptr<IntrusionData>& intrusion_data_ptr)
 {
-  m_intrusion_data_ptr = intrusion_data_ptr;
+  if (!intrusion_data_ptr)
+  {
+    dropPendingBlock(PENDING_INTRUSION_DATA);
+    m_has_intrusion_data = false;
+    return;
+  }
+  setIntrusionData(*intrusion_data_ptr);
+}
+
+bool Data::hasApplicationData() const
+{
+  return m_has_application_data;
+}
+
+const ApplicationData& Data::getApplicationData() const
+{
+  decodePendingBlock(PENDING_APPLICATION_DATA);
+  return m_application_data;
+}
+
+ApplicationData& Data::getMutableApplicationData()
+{
+  decodePendingBlock(PENDING_APPLICATION_DATA);
+  m_has_application_data = true;
+  return m_application_data;
+}
+
+void Data::setApplicationData(const ApplicationData& application_data)
+{
+  dropPendingBlock(PENDING_APPLICATION_DATA);
+  m_application_data     = application_data;
+  m_has_application_data = true;
 }
 
-std::shared_ptr<ApplicationData> Data::getApplicationDataPtr() const
+void Data::setApplicationData(ApplicationData&& application_data)
 {
-  return m_application_data_ptr;
+  dropPendingBlock(PENDING_APPLICATION_DATA);
+  m_application_data     = std::move(application_data);
+  m_has_application_data = true;
+}
+
+std::shared_ptr<const ApplicationData> Data::getApplicationDataPtr(
+  const std::shared_ptr<const Data>& data)
+{
+  if (!data)
+  {
+    return nullptr;
+  }
+  const ApplicationData& application_data = data->getApplicationData();
+  if (!data->hasApplicationData())
+  {
+    return nullptr;
+  }
+  return std::shared_ptr<const ApplicationData>(data, &application_data);
 }
 
 void Data::setApplicationDataPtr(const std::shared_ptr<ApplicationData>& application_data_ptr)
 {
-  m_application_data_ptr = application_data_ptr;
+  if (!application_data_ptr)
+  {
+    dropPendingBlock(PENDING_APPLICATION_DATA);
+    m_has_application_data = false;
+    return;
+  }
+  setApplicationData(*application_data_ptr);
 }
 
+void Data::setPendingBlocks(PacketBuffer&& buffer,
+                            const std::shared_ptr<const DataBlockDecoder>& decoder,
+                            uint8_t blocks)
+{
+  blocks &= PENDING_ALL_BLOCKS;
+  if (blocks == 0)
+  {
+    return;
+  }
+  std::swap(m_pending_blocks.buffer, buffer);
+  m_pending_blocks.decoder = decoder;
+  m_pending_blocks.mask.store(blocks, std::memory_order_release);
+
+  m_has_general_system_state =
+    m_has_general_system_state || (blocks & PENDING_GENERAL_SYSTEM_STATE) != 0;
+  m_has_measurement_data = m_has_measurement_data || (blocks & PENDING_MEASUREMENT_DATA) != 0;
+  m_has_intrusion_data   = m_has_intrusion_data || (blocks & PENDING_INTRUSION_DATA) != 0;
+  m_has_application_data = m_has_application_data || (blocks & PENDING_APPLICATION_DATA) != 0;
+}
+
+bool Data::hasPendingBlocks() const
+{
+  return m_pending_blocks.mask.load(std::memory_order_acquire) != 0;
+}
+
+void Data::decodePendingBlocks() const
+{
+  decodePendingBlock(PENDING_GENERAL_SYSTEM_STATE);
+  decodePendingBlock(PENDING_MEASUREMENT_DATA);
+  decodePendingBlock(PENDING_INTRUSION_DATA);
+  decodePendingBlock(PENDING_APPLICATION_DATA);
+}
+
+void Data::clearPendingBlocks()
+{
+  uint8_t mask = m_pending_blocks.mask.load(std::memory_order_acquire);
+  m_has_general_system_state =
+    m_has_general_system_state && (mask & PENDING_GENERAL_SYSTEM_STATE) == 0;
+  m_has_measurement_data = m_has_measurement_data && (mask & PENDING_MEASUREMENT_DATA) == 0;
+  m_has_intrusion_data   = m_has_intrusion_data && (mask & PENDING_INTRUSION_DATA) == 0;
+  m_has_application_data = m_has_application_data && (mask & PENDING_APPLICATION_DATA) == 0;
+  dropPendingBlock(mask);
+}
+
+void Data::decodePendingBlock(uint8_t block) const
+{
+  if ((m_pending_blocks.mask.load(std::memory_order_acquire) & block) == 0)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_pending_blocks.mutex);
+  uint8_t mask = m_pending_blocks.mask.load(std::memory_order_relaxed);
+  if ((mask & block) == 0)
+  {
+    // Decoded by another thread in the meantime.
+    return;
+  }
+
+  const PacketBuffer& buffer = m_pending_blocks.buffer;
+  switch (block)
+  {
+    case PENDING_GENERAL_SYSTEM_STATE:
+      m_pending_blocks.decoder->decodeGeneralSystemState(buffer, *this, m_general_system_state);
+      break;
+    case PENDING_MEASUREMENT_DATA:
+      m_pending_blocks.decoder->decodeMeasurementData(buffer, *this, m_measurement_data);
+      break;
+    case PENDING_INTRUSION_DATA:
+      m_pending_blocks.decoder->decodeIntrusionData(buffer, *this, m_intrusion_data);
+      break;
+    case PENDING_APPLICATION_DATA:
+      m_pending_blocks.decoder->decodeApplicationData(buffer, *this, m_application_data);
+      break;
+    default:
+      break;
+  }
+
+  mask &= static_cast<uint8_t>(~block);
+  if (mask == 0)
+  {
+    m_pending_blocks.buffer.clear();
+    m_pending_blocks.decoder = nullptr;
+  }
+  m_pending_blocks.mask.store(mask, std::memory_order_release);
+}
+
+void Data::dropPendingBlock(uint8_t block)
+{
+  uint8_t mask = m_pending_blocks.mask.load(std::memory_order_acquire);
+  if ((mask & block) == 0)
+  {
+    return;
+  }
+  mask &= static_cast<uint8_t>(~block);
+  if (mask == 0)
+  {
+    m_pending_blocks.buffer.clear();
+    m_pending_blocks.decoder = nullptr;
+  }
+  m_pending_blocks.mask.store(mask, std::memory_order_release);
+}
+
+Data::PendingBlocks::PendingBlocks()
+  : mask(0)
+{
+}
+
+Data::PendingBlocks::PendingBlocks(const PendingBlocks& other)
+  : buffer(other.buffer)
+  , decoder(other.decoder)
+  , mask(other.mask.load(std::memory_order_acquire))
+{
+}
+
+Data::PendingBlocks::PendingBlocks(PendingBlocks&& other)
+  : buffer(std::move(other.buffer))
+  , decoder(std::move(other.decoder))
+  , mask(other.mask.exchange(0, std::memory_order_acq_rel))
+{
+  other.buffer = PacketBuffer();
+}
+
+Data::PendingBlocks& Data::PendingBlocks::operator=(const PendingBlocks& other)
+{
+  if (this != &other)
+  {
+    buffer  = other.buffer;
+    decoder = other.decoder;
+    mask.store(other.mask.load(std::memory_order_acquire), std::memory_order_release);
+  }
+  return *this;
+}
+
+Data::PendingBlocks& Data::PendingBlocks::operator=(PendingBlocks&& other)
+{
+  if (this != &other)
+  {
+    buffer       = std::move(other.buffer);
+    decoder      = std::move(other.decoder);
+    other.buffer = PacketBuffer();
+    mask.store(other.mask.exchange(0, std::memory_order_acq_rel), std::memory_order_release);
+  }
+  return *this;
+}
 
 } // namespace datastructure
 } // namespace sick
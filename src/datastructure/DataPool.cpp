@@ -0,0 +1,114 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file DataPool.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/DataPool.h"
+#include "sick_safetyscanners_base/datastructure/PoolControlBlockAllocator.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace datastructure {
+
+const std::size_t DataPool::CONTROL_BLOCK_SIZE;
+
+namespace {
+
+/*!
+ * \brief The objects are owned by the pool, dropping the last reference only releases the object.
+ * The sensor data kept for pending blocks is dropped, so idle objects do not hold on to receive
+ * buffers.
+ */
+struct ReleasingDeleter
+{
+  void operator()(Data* data) const { data->clearPendingBlocks(); }
+};
+
+} // namespace
+
+DataPool::DataPool(std::size_t num_objects, std::size_t max_num_objects)
+  : m_storage(std::make_shared<Storage>())
+  , m_max_num_objects(std::max(num_objects, max_num_objects))
+{
+  // Releasing an object must not allocate, so the free list never outgrows its capacity.
+  m_storage->entries.reserve(m_max_num_objects);
+  m_storage->free_entries.reserve(m_max_num_objects);
+  for (std::size_t i = 0; i < num_objects; ++i)
+  {
+    m_storage->entries.emplace_back(new Entry());
+    m_storage->free_entries.push_back(m_storage->entries.back().get());
+  }
+}
+
+std::shared_ptr<Data> DataPool::acquire()
+{
+  Entry* entry = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+    if (!m_storage->free_entries.empty())
+    {
+      entry = m_storage->free_entries.back();
+      m_storage->free_entries.pop_back();
+    }
+    else if (m_storage->entries.size() < m_max_num_objects)
+    {
+      m_storage->entries.emplace_back(new Entry());
+      entry = m_storage->entries.back().get();
+    }
+    else
+    {
+      return std::shared_ptr<Data>();
+    }
+  }
+  return std::shared_ptr<Data>(&entry->data,
+                               ReleasingDeleter(),
+                               PoolControlBlockAllocator<Entry, Storage, Entry>(m_storage, entry));
+}
+
+std::size_t DataPool::getNumObjects() const
+{
+  std::lock_guard<std::mutex> lock(m_storage->mutex);
+  return m_storage->entries.size();
+}
+
+std::size_t DataPool::getNumAvailableObjects() const
+{
+  std::lock_guard<std::mutex> lock(m_storage->mutex);
+  return m_storage->free_entries.size();
+}
+
+std::size_t DataPool::getMaxNumObjects() const
+{
+  return m_max_num_objects;
+}
+
+} // namespace datastructure
+} // namespace sick
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/DeviceName.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 DeviceName::DeviceName() {}
 
-std::string DeviceName::getDeviceName() const
+const std::string& DeviceName::getDeviceName() const
 {
   return m_device_name;
 }
@@ -49,6 +51,11 @@ void DeviceName::setDeviceName(const std::string& device_name)
   m_device_name = device_name;
 }
 
+void DeviceName::setDeviceName(std::string&& device_name)
+{
+  m_device_name = std::move(device_name);
+}
+
 
 } // namespace datastructure
 } // namespace sick
@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/FieldData.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -49,7 +51,7 @@ void FieldData::setIsValid(bool is_valid)
   m_is_valid = is_valid;
 }
 
-std::string FieldData::getVersionCVersion() const
+const std::string& FieldData::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -59,6 +61,11 @@ void FieldData::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void FieldData::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t FieldData::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
@@ -149,7 +156,7 @@ void FieldData::setNameLength(const uint32_t& name_length)
   m_name_length = name_length;
 }
 
-std::string FieldData::getFieldName() const
+const std::string& FieldData::getFieldName() const
 {
   return m_field_name;
 }
@@ -159,6 +166,11 @@ void FieldData::setFieldName(const std::string& field_name)
   m_field_name = field_name;
 }
 
+void FieldData::setFieldName(std::string&& field_name)
+{
+  m_field_name = std::move(field_name);
+}
+
 
 bool FieldData::getIsWarningField() const
 {
@@ -180,7 +192,7 @@ void FieldData::setIsProtectiveField(bool is_protective_field)
   m_is_protective_field = is_protective_field;
 }
 
-std::vector<uint16_t> FieldData::getBeamDistances() const
+const std::vector<uint16_t>& FieldData::getBeamDistances() const
 {
   return m_beam_distances;
 }
@@ -190,6 +202,11 @@ void FieldData::setBeamDistances(const std::vector<uint16_t>& beam_distances)
   m_beam_distances = beam_distances;
 }
 
+void FieldData::setBeamDistances(std::vector<uint16_t>&& beam_distances)
+{
+  m_beam_distances = std::move(beam_distances);
+}
+
 float FieldData::getStartAngle() const
 {
   return m_start_angle;
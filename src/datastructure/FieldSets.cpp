@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/FieldSets.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 FieldSets::FieldSets() {}
 
-std::string FieldSets::getVersionCVersion() const
+const std::string& FieldSets::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void FieldSets::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void FieldSets::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t FieldSets::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
@@ -79,7 +86,7 @@ void FieldSets::setVersionReleaseNumber(const uint8_t& version_release_number)
   m_version_release_number = version_release_number;
 }
 
-std::vector<uint32_t> FieldSets::getNameLength() const
+const std::vector<uint32_t>& FieldSets::getNameLength() const
 {
   return m_name_length;
 }
@@ -89,7 +96,12 @@ void FieldSets::setNameLength(const std::vector<uint32_t>& name_length)
   m_name_length = name_length;
 }
 
-std::vector<std::string> FieldSets::getFieldName() const
+void FieldSets::setNameLength(std::vector<uint32_t>&& name_length)
+{
+  m_name_length = std::move(name_length);
+}
+
+const std::vector<std::string>& FieldSets::getFieldName() const
 {
   return m_field_name;
 }
@@ -99,7 +111,12 @@ void FieldSets::setFieldName(const std::vector<std::string>& field_name)
   m_field_name = field_name;
 }
 
-std::vector<bool> FieldSets::getIsDefined() const
+void FieldSets::setFieldName(std::vector<std::string>&& field_name)
+{
+  m_field_name = std::move(field_name);
+}
+
+const std::vector<bool>& FieldSets::getIsDefined() const
 {
   return m_is_defined;
 }
@@ -109,5 +126,10 @@ void FieldSets::setIsDefined(const std::vector<bool>& is_defined)
   m_is_defined = is_defined;
 }
 
+void FieldSets::setIsDefined(std::vector<bool>&& is_defined)
+{
+  m_is_defined = std::move(is_defined);
+}
+
 } // namespace datastructure
 } // namespace sick
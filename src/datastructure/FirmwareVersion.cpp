@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/FirmwareVersion.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 FirmwareVersion::FirmwareVersion() {}
 
-std::string FirmwareVersion::getFirmwareVersion() const
+const std::string& FirmwareVersion::getFirmwareVersion() const
 {
   return m_firmware_version;
 }
@@ -49,6 +51,11 @@ void FirmwareVersion::setFirmwareVersion(const std::string& firmware_version)
   m_firmware_version = firmware_version;
 }
 
+void FirmwareVersion::setFirmwareVersion(std::string&& firmware_version)
+{
+  m_firmware_version = std::move(firmware_version);
+}
+
 
 } // namespace datastructure
 } // namespace sick
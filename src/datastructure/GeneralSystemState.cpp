@@ -104,34 +104,65 @@ void GeneralSystemState::setManipulationStatus(bool manipulation_status)
 
 std::vector<bool> GeneralSystemState::getSafeCutOffPathVector() const
 {
-  return m_safe_cut_off_path_vector;
+  return m_safe_cut_off_path.toVector();
 }
 
 void GeneralSystemState::setSafeCutOffPathvector(const std::vector<bool>& safe_cut_off_path_vector)
 {
-  m_safe_cut_off_path_vector = safe_cut_off_path_vector;
+  m_safe_cut_off_path = CutOffPathWord::fromVector(safe_cut_off_path_vector);
+}
+
+GeneralSystemState::CutOffPathWord GeneralSystemState::getSafeCutOffPath() const
+{
+  return m_safe_cut_off_path;
+}
+
+void GeneralSystemState::setSafeCutOffPath(const CutOffPathWord& safe_cut_off_path)
+{
+  m_safe_cut_off_path = safe_cut_off_path;
 }
 
 std::vector<bool> GeneralSystemState::getNonSafeCutOffPathVector() const
 {
-  return m_non_safe_cut_off_path_vector;
+  return m_non_safe_cut_off_path.toVector();
 }
 
 void GeneralSystemState::setNonSafeCutOffPathVector(
   const std::vector<bool>& non_safe_cut_off_path_vector)
 {
-  m_non_safe_cut_off_path_vector = non_safe_cut_off_path_vector;
+  m_non_safe_cut_off_path = CutOffPathWord::fromVector(non_safe_cut_off_path_vector);
+}
+
+GeneralSystemState::CutOffPathWord GeneralSystemState::getNonSafeCutOffPath() const
+{
+  return m_non_safe_cut_off_path;
+}
+
+void GeneralSystemState::setNonSafeCutOffPath(const CutOffPathWord& non_safe_cut_off_path)
+{
+  m_non_safe_cut_off_path = non_safe_cut_off_path;
 }
 
 std::vector<bool> GeneralSystemState::getResetRequiredCutOffPathVector() const
 {
-  return m_reset_required_cut_off_path_vector;
+  return m_reset_required_cut_off_path.toVector();
 }
 
 void GeneralSystemState::setResetRequiredCutOffPathVector(
   const std::vector<bool>& reset_required_cut_off_path_vector)
 {
-  m_reset_required_cut_off_path_vector = reset_required_cut_off_path_vector;
+  m_reset_required_cut_off_path = CutOffPathWord::fromVector(reset_required_cut_off_path_vector);
+}
+
+GeneralSystemState::CutOffPathWord GeneralSystemState::getResetRequiredCutOffPath() const
+{
+  return m_reset_required_cut_off_path;
+}
+
+void GeneralSystemState::setResetRequiredCutOffPath(
+  const CutOffPathWord& reset_required_cut_off_path)
+{
+  m_reset_required_cut_off_path = reset_required_cut_off_path;
 }
 
 uint8_t GeneralSystemState::getCurrentMonitoringCaseNoTable1() const
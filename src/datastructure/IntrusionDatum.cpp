@@ -34,6 +34,8 @@
 
 #include "sick_safetyscanners_base/datastructure/IntrusionDatum.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
@@ -50,14 +52,34 @@ void IntrusionDatum::setSize(const int32_t& size)
   m_size = size;
 }
 
+const BeamBitset& IntrusionDatum::getFlags() const
+{
+  return m_flags;
+}
+
+void IntrusionDatum::setFlags(const BeamBitset& flags)
+{
+  m_flags = flags;
+}
+
+void IntrusionDatum::setFlags(BeamBitset&& flags)
+{
+  m_flags = std::move(flags);
+}
+
+void IntrusionDatum::setFlags(const uint8_t* bytes, std::size_t num_bytes, std::size_t num_flags)
+{
+  m_flags.assign(bytes, num_bytes, num_flags);
+}
+
 std::vector<bool> IntrusionDatum::getFlagsVector() const
 {
-  return m_flags_vector;
+  return m_flags.toVector();
 }
 
 void IntrusionDatum::setFlagsVector(const std::vector<bool>& flags_vector)
 {
-  m_flags_vector = flags_vector;
+  m_flags = BeamBitset(flags_vector);
 }
 
 } // namespace datastructure
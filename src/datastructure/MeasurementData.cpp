@@ -40,6 +40,7 @@ namespace datastructure {
 
 MeasurementData::MeasurementData()
   : m_is_empty(false)
+  , m_number_of_beams(0)
 {
 }
 
@@ -53,14 +54,180 @@ void MeasurementData::setNumberOfBeams(const uint32_t& number_of_beams)
   m_number_of_beams = number_of_beams;
 }
 
+std::size_t MeasurementData::getNumberOfScanPoints() const
+{
+  return m_distances.size();
+}
+
+const std::vector<uint16_t>& MeasurementData::getDistancesVector() const
+{
+  return m_distances;
+}
+
+const std::vector<uint8_t>& MeasurementData::getReflectivitiesVector() const
+{
+  return m_reflectivities;
+}
+
+const std::vector<uint8_t>& MeasurementData::getStatusBytesVector() const
+{
+  return m_status_bytes;
+}
+
+const std::vector<float>& MeasurementData::getAnglesVector() const
+{
+  if (m_angle_table_ptr)
+  {
+    return m_angle_table_ptr->getAnglesVector();
+  }
+  return m_angles;
+}
+
+const std::shared_ptr<const AngleTable>& MeasurementData::getAngleTablePtr() const
+{
+  return m_angle_table_ptr;
+}
+
+void MeasurementData::setAngleTablePtr(const std::shared_ptr<const AngleTable>& angle_table_ptr)
+{
+  m_angle_table_ptr = angle_table_ptr;
+  if (m_angle_table_ptr)
+  {
+    m_angles.clear();
+  }
+}
+
+void MeasurementData::detachAngleTable()
+{
+  if (!m_angle_table_ptr)
+  {
+    return;
+  }
+  const std::vector<float>& angles = m_angle_table_ptr->getAnglesVector();
+  m_angles.assign(angles.begin(), angles.end());
+  m_angles.resize(m_distances.size());
+  m_angle_table_ptr.reset();
+}
+
+ScanPoint MeasurementData::getScanPoint(std::size_t index) const
+{
+  uint16_t distance          = m_distances[index];
+  uint8_t reflectivity       = m_reflectivities[index];
+  uint8_t status             = m_status_bytes[index];
+  bool valid                 = static_cast<bool>(status & STATUS_VALID_BIT);
+  bool infinite              = static_cast<bool>(status & STATUS_INFINITE_BIT);
+  bool glare                 = static_cast<bool>(status & STATUS_GLARE_BIT);
+  bool reflector             = static_cast<bool>(status & STATUS_REFLECTOR_BIT);
+  bool contamination         = static_cast<bool>(status & STATUS_CONTAMINATION_BIT);
+  bool contamination_warning = static_cast<bool>(status & STATUS_CONTAMINATION_WARNING_BIT);
+  return ScanPoint(getAnglesVector()[index],
+                   distance,
+                   reflectivity,
+                   valid,
+                   infinite,
+                   glare,
+                   reflector,
+                   contamination,
+                   contamination_warning);
+}
+
 std::vector<ScanPoint> MeasurementData::getScanPointsVector() const
 {
-  return m_scan_points_vector;
+  std::vector<ScanPoint> scan_points;
+  scan_points.reserve(getNumberOfScanPoints());
+  for (std::size_t i = 0; i < getNumberOfScanPoints(); ++i)
+  {
+    scan_points.push_back(getScanPoint(i));
+  }
+  return scan_points;
+}
+
+CompactScanPoint MeasurementData::getCompactScanPoint(std::size_t index) const
+{
+  return CompactScanPoint(static_cast<uint32_t>(index),
+                          m_distances[index],
+                          m_reflectivities[index],
+                          m_status_bytes[index]);
+}
+
+std::vector<CompactScanPoint> MeasurementData::getCompactScanPointsVector() const
+{
+  std::vector<CompactScanPoint> scan_points;
+  scan_points.reserve(getNumberOfScanPoints());
+  for (std::size_t i = 0; i < getNumberOfScanPoints(); ++i)
+  {
+    scan_points.push_back(getCompactScanPoint(i));
+  }
+  return scan_points;
 }
 
 void MeasurementData::addScanPoint(ScanPoint scan_point)
 {
-  m_scan_points_vector.push_back(scan_point);
+  addScanPoint(scan_point.getAngle(),
+               scan_point.getDistance(),
+               scan_point.getReflectivity(),
+               CompactScanPoint::toStatusByte(scan_point));
+}
+
+void MeasurementData::addScanPoint(float angle,
+                                   uint16_t distance,
+                                   uint8_t reflectivity,
+                                   uint8_t status)
+{
+  detachAngleTable();
+  m_angles.push_back(angle);
+  m_distances.push_back(distance);
+  m_reflectivities.push_back(reflectivity);
+  m_status_bytes.push_back(status);
+}
+
+void MeasurementData::resizeScanPoints(std::size_t number_of_scan_points)
+{
+  if (!m_angle_table_ptr)
+  {
+    m_angles.resize(number_of_scan_points);
+  }
+  m_distances.resize(number_of_scan_points);
+  m_reflectivities.resize(number_of_scan_points);
+  m_status_bytes.resize(number_of_scan_points);
+}
+
+uint16_t* MeasurementData::getMutableDistances()
+{
+  return m_distances.data();
+}
+
+uint8_t* MeasurementData::getMutableReflectivities()
+{
+  return m_reflectivities.data();
+}
+
+uint8_t* MeasurementData::getMutableStatusBytes()
+{
+  return m_status_bytes.data();
+}
+
+float* MeasurementData::getMutableAngles()
+{
+  detachAngleTable();
+  return m_angles.data();
+}
+
+void MeasurementData::reserveScanPoints(std::size_t number_of_scan_points)
+{
+  m_angles.reserve(number_of_scan_points);
+  m_distances.reserve(number_of_scan_points);
+  m_reflectivities.reserve(number_of_scan_points);
+  m_status_bytes.reserve(number_of_scan_points);
+}
+
+void MeasurementData::clearScanPoints()
+{
+  m_angle_table_ptr.reset();
+  m_angles.clear();
+  m_distances.clear();
+  m_reflectivities.clear();
+  m_status_bytes.clear();
 }
 
 bool MeasurementData::isEmpty() const
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/OrderNumber.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 OrderNumber::OrderNumber() {}
 
-std::string OrderNumber::getOrderNumber() const
+const std::string& OrderNumber::getOrderNumber() const
 {
   return m_order_number;
 }
@@ -49,6 +51,11 @@ void OrderNumber::setOrderNumber(const std::string& order_number)
   m_order_number = order_number;
 }
 
+void OrderNumber::setOrderNumber(std::string&& order_number)
+{
+  m_order_number = std::move(order_number);
+}
+
 
 } // namespace datastructure
 } // namespace sick
@@ -34,11 +34,17 @@
 
 #include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 
-PacketBuffer::PacketBuffer() {}
+PacketBuffer::PacketBuffer()
+  : m_length(0)
+{
+}
 
 PacketBuffer::PacketBuffer(const std::vector<uint8_t>& buffer)
 {
@@ -50,25 +56,107 @@ PacketBuffer::PacketBuffer(const PacketBuffer::ArrayBuffer& buffer, const size_t
   setBuffer(buffer, length);
 }
 
+PacketBuffer::PacketBuffer(const std::shared_ptr<std::vector<uint8_t>>& slot, const size_t& length)
+  : m_buffer(slot)
+  , m_length(std::min(length, slot->size()))
+{
+}
+
+PacketBuffer::PacketBuffer(const FragmentVector& fragments)
+  : m_length(0)
+  , m_fragments(fragments)
+{
+}
+
+PacketBuffer::PacketBuffer(FragmentVector&& fragments)
+  : m_length(0)
+  , m_fragments(std::move(fragments))
+{
+}
+
 std::shared_ptr<std::vector<uint8_t> const> PacketBuffer::getBuffer() const
 {
-  // Okay to share since it's a shared_ptr<vector const>
+  if (!isFragmented())
+  {
+    if (!m_buffer || m_buffer->size() == m_length)
+    {
+      // Okay to share since it's a shared_ptr<vector const>
+      return m_buffer;
+    }
+    return std::make_shared<std::vector<uint8_t> const>(m_buffer->begin(),
+                                                        m_buffer->begin() + m_length);
+  }
+
+  auto buffer = std::make_shared<std::vector<uint8_t>>();
+  buffer->reserve(getLength());
+  for (const auto& fragment : m_fragments)
+  {
+    buffer->insert(buffer->end(),
+                   fragment.buffer->begin() + fragment.offset,
+                   fragment.buffer->begin() + fragment.offset + fragment.length);
+  }
+  return buffer;
+}
+
+std::shared_ptr<std::vector<uint8_t> const> PacketBuffer::getStorage() const
+{
   return m_buffer;
 }
 
+bool PacketBuffer::isFragmented() const
+{
+  return !m_fragments.empty();
+}
+
+const PacketBuffer::FragmentVector& PacketBuffer::getFragments() const
+{
+  return m_fragments;
+}
+
+PacketBuffer::FragmentVector PacketBuffer::releaseFragments()
+{
+  FragmentVector fragments(std::move(m_fragments));
+  m_fragments = FragmentVector();
+  m_buffer.reset();
+  m_length = 0;
+  return fragments;
+}
+
+void PacketBuffer::clear()
+{
+  m_fragments.clear();
+  m_buffer.reset();
+  m_length = 0;
+}
+
 void PacketBuffer::setBuffer(const std::vector<uint8_t>& buffer)
 {
   m_buffer = std::make_shared<std::vector<uint8_t> const>(buffer);
+  m_length = m_buffer->size();
+  m_fragments.clear();
+}
+
+void PacketBuffer::setBuffer(std::vector<uint8_t>&& buffer)
+{
+  m_buffer = std::make_shared<std::vector<uint8_t> const>(std::move(buffer));
+  m_length = m_buffer->size();
+  m_fragments.clear();
 }
 
 void PacketBuffer::setBuffer(const PacketBuffer::ArrayBuffer& buffer, const size_t& length)
 {
   m_buffer = std::make_shared<std::vector<uint8_t> const>(buffer.data(), buffer.data() + length);
+  m_length = length;
+  m_fragments.clear();
 }
 
 size_t PacketBuffer::getLength() const
 {
-  return m_buffer->size();
+  if (isFragmented())
+  {
+    return m_fragments.back().position + m_fragments.back().length;
+  }
+  return m_length;
 }
 
 } // namespace datastructure
@@ -0,0 +1,120 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file PacketBufferPool.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/PacketBufferPool.h"
+#include "sick_safetyscanners_base/datastructure/PoolControlBlockAllocator.h"
+
+#include <algorithm>
+
+namespace sick {
+namespace datastructure {
+
+const std::size_t PacketBufferPool::CONTROL_BLOCK_SIZE;
+
+namespace {
+
+/*!
+ * \brief The slots are owned by the pool, dropping the last reference only releases the slot.
+ */
+struct NoopDeleter
+{
+  void operator()(std::vector<uint8_t>*) const {}
+};
+
+} // namespace
+
+PacketBufferPool::PacketBufferPool(std::size_t num_slots,
+                                   std::size_t max_num_slots,
+                                   std::size_t slot_size)
+  : m_storage(std::make_shared<Storage>())
+  , m_max_num_slots(std::max(num_slots, max_num_slots))
+  , m_slot_size(slot_size)
+{
+  // Releasing a slot must not allocate, so the free list never outgrows its capacity.
+  m_storage->entries.reserve(m_max_num_slots);
+  m_storage->free_entries.reserve(m_max_num_slots);
+  for (std::size_t i = 0; i < num_slots; ++i)
+  {
+    m_storage->entries.emplace_back(new Entry(m_slot_size));
+    m_storage->free_entries.push_back(m_storage->entries.back().get());
+  }
+}
+
+PacketBufferPool::Slot PacketBufferPool::acquire()
+{
+  Entry* entry = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+    if (!m_storage->free_entries.empty())
+    {
+      entry = m_storage->free_entries.back();
+      m_storage->free_entries.pop_back();
+    }
+    else if (m_storage->entries.size() < m_max_num_slots)
+    {
+      m_storage->entries.emplace_back(new Entry(m_slot_size));
+      entry = m_storage->entries.back().get();
+    }
+    else
+    {
+      return Slot();
+    }
+  }
+  return Slot(&entry->buffer,
+              NoopDeleter(),
+              PoolControlBlockAllocator<Entry, Storage, Entry>(m_storage, entry));
+}
+
+std::size_t PacketBufferPool::getNumSlots() const
+{
+  std::lock_guard<std::mutex> lock(m_storage->mutex);
+  return m_storage->entries.size();
+}
+
+std::size_t PacketBufferPool::getNumAvailableSlots() const
+{
+  std::lock_guard<std::mutex> lock(m_storage->mutex);
+  return m_storage->free_entries.size();
+}
+
+std::size_t PacketBufferPool::getMaxNumSlots() const
+{
+  return m_max_num_slots;
+}
+
+std::size_t PacketBufferPool::getSlotSize() const
+{
+  return m_slot_size;
+}
+
+} // namespace datastructure
+} // namespace sick
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/ProjectName.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 ProjectName::ProjectName() {}
 
-std::string ProjectName::getProjectName() const
+const std::string& ProjectName::getProjectName() const
 {
   return m_project_name;
 }
@@ -49,6 +51,11 @@ void ProjectName::setProjectName(const std::string& project_name)
   m_project_name = project_name;
 }
 
+void ProjectName::setProjectName(std::string&& project_name)
+{
+  m_project_name = std::move(project_name);
+}
+
 
 } // namespace datastructure
 } // namespace sick
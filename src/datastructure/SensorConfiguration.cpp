@@ -0,0 +1,223 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+//----------------------------------------------------------------------
+/*!
+ * \file SensorConfiguration.cpp
+ *
+ * \date    2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/SensorConfiguration.h"
+
+#include <utility>
+
+namespace sick {
+namespace datastructure {
+
+SensorConfiguration::SensorConfiguration() {}
+
+const SerialNumber& SensorConfiguration::getSerialNumber() const
+{
+  return m_serial_number;
+}
+
+void SensorConfiguration::setSerialNumber(const SerialNumber& serial_number)
+{
+  m_serial_number = serial_number;
+}
+
+void SensorConfiguration::setSerialNumber(SerialNumber&& serial_number)
+{
+  m_serial_number = std::move(serial_number);
+}
+
+const TypeCode& SensorConfiguration::getTypeCode() const
+{
+  return m_type_code;
+}
+
+void SensorConfiguration::setTypeCode(const TypeCode& type_code)
+{
+  m_type_code = type_code;
+}
+
+void SensorConfiguration::setTypeCode(TypeCode&& type_code)
+{
+  m_type_code = std::move(type_code);
+}
+
+const FirmwareVersion& SensorConfiguration::getFirmwareVersion() const
+{
+  return m_firmware_version;
+}
+
+void SensorConfiguration::setFirmwareVersion(const FirmwareVersion& firmware_version)
+{
+  m_firmware_version = firmware_version;
+}
+
+void SensorConfiguration::setFirmwareVersion(FirmwareVersion&& firmware_version)
+{
+  m_firmware_version = std::move(firmware_version);
+}
+
+const OrderNumber& SensorConfiguration::getOrderNumber() const
+{
+  return m_order_number;
+}
+
+void SensorConfiguration::setOrderNumber(const OrderNumber& order_number)
+{
+  m_order_number = order_number;
+}
+
+void SensorConfiguration::setOrderNumber(OrderNumber&& order_number)
+{
+  m_order_number = std::move(order_number);
+}
+
+const DeviceName& SensorConfiguration::getDeviceName() const
+{
+  return m_device_name;
+}
+
+void SensorConfiguration::setDeviceName(const DeviceName& device_name)
+{
+  m_device_name = device_name;
+}
+
+void SensorConfiguration::setDeviceName(DeviceName&& device_name)
+{
+  m_device_name = std::move(device_name);
+}
+
+const ProjectName& SensorConfiguration::getProjectName() const
+{
+  return m_project_name;
+}
+
+void SensorConfiguration::setProjectName(const ProjectName& project_name)
+{
+  m_project_name = project_name;
+}
+
+void SensorConfiguration::setProjectName(ProjectName&& project_name)
+{
+  m_project_name = std::move(project_name);
+}
+
+const ConfigMetadata& SensorConfiguration::getConfigMetadata() const
+{
+  return m_config_metadata;
+}
+
+void SensorConfiguration::setConfigMetadata(const ConfigMetadata& config_metadata)
+{
+  m_config_metadata = config_metadata;
+}
+
+void SensorConfiguration::setConfigMetadata(ConfigMetadata&& config_metadata)
+{
+  m_config_metadata = std::move(config_metadata);
+}
+
+const FieldSets& SensorConfiguration::getFieldSets() const
+{
+  return m_field_sets;
+}
+
+void SensorConfiguration::setFieldSets(const FieldSets& field_sets)
+{
+  m_field_sets = field_sets;
+}
+
+void SensorConfiguration::setFieldSets(FieldSets&& field_sets)
+{
+  m_field_sets = std::move(field_sets);
+}
+
+const ConfigData& SensorConfiguration::getCurrentConfig() const
+{
+  return m_current_config;
+}
+
+void SensorConfiguration::setCurrentConfig(const ConfigData& current_config)
+{
+  m_current_config = current_config;
+}
+
+void SensorConfiguration::setCurrentConfig(ConfigData&& current_config)
+{
+  m_current_config = std::move(current_config);
+}
+
+const ConfigData& SensorConfiguration::getPersistentConfig() const
+{
+  return m_persistent_config;
+}
+
+void SensorConfiguration::setPersistentConfig(const ConfigData& persistent_config)
+{
+  m_persistent_config = persistent_config;
+}
+
+void SensorConfiguration::setPersistentConfig(ConfigData&& persistent_config)
+{
+  m_persistent_config = std::move(persistent_config);
+}
+
+const std::vector<FieldData>& SensorConfiguration::getFieldData() const
+{
+  return m_field_data;
+}
+
+void SensorConfiguration::setFieldData(const std::vector<FieldData>& field_data)
+{
+  m_field_data = field_data;
+}
+
+void SensorConfiguration::setFieldData(std::vector<FieldData>&& field_data)
+{
+  m_field_data = std::move(field_data);
+}
+
+const std::vector<MonitoringCaseData>& SensorConfiguration::getMonitoringCases() const
+{
+  return m_monitoring_cases;
+}
+
+void SensorConfiguration::setMonitoringCases(const std::vector<MonitoringCaseData>& monitoring_cases)
+{
+  m_monitoring_cases = monitoring_cases;
+}
+
+void SensorConfiguration::setMonitoringCases(std::vector<MonitoringCaseData>&& monitoring_cases)
+{
+  m_monitoring_cases = std::move(monitoring_cases);
+}
+
+} // namespace datastructure
+} // namespace sick
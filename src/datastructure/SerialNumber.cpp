@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/SerialNumber.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 SerialNumber::SerialNumber() {}
 
-std::string SerialNumber::getSerialNumber() const
+const std::string& SerialNumber::getSerialNumber() const
 {
   return m_serial_number;
 }
@@ -49,6 +51,11 @@ void SerialNumber::setSerialNumber(const std::string& serial_number)
   m_serial_number = serial_number;
 }
 
+void SerialNumber::setSerialNumber(std::string&& serial_number)
+{
+  m_serial_number = std::move(serial_number);
+}
+
 
 } // namespace datastructure
 } // namespace sick
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/StatusOverview.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 StatusOverview::StatusOverview() {}
 
-std::string StatusOverview::getVersionCVersion() const
+const std::string& StatusOverview::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void StatusOverview::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void StatusOverview::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t StatusOverview::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
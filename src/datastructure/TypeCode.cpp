@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/TypeCode.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 TypeCode::TypeCode() {}
 
-std::string TypeCode::getTypeCode() const
+const std::string& TypeCode::getTypeCode() const
 {
   return m_type_code;
 }
@@ -48,6 +50,11 @@ void TypeCode::setTypeCode(const std::string& type_code)
 {
   m_type_code = type_code;
 }
+
+void TypeCode::setTypeCode(std::string&& type_code)
+{
+  m_type_code = std::move(type_code);
+}
 uint8_t TypeCode::getInterfaceType() const
 {
   return m_interface_type;
@@ -34,12 +34,14 @@
 
 #include "sick_safetyscanners_base/datastructure/UserName.h"
 
+#include <utility>
+
 namespace sick {
 namespace datastructure {
 
 UserName::UserName() {}
 
-std::string UserName::getVersionCVersion() const
+const std::string& UserName::getVersionCVersion() const
 {
   return m_version_c_version;
 }
@@ -49,6 +51,11 @@ void UserName::setVersionCVersion(const std::string& version_c_version)
   m_version_c_version = version_c_version;
 }
 
+void UserName::setVersionCVersion(std::string&& version_c_version)
+{
+  m_version_c_version = std::move(version_c_version);
+}
+
 uint8_t UserName::getVersionMajorVersionNumber() const
 {
   return m_version_major_version_number;
@@ -89,7 +96,7 @@ void UserName::setNameLength(const uint32_t& name_length)
   m_name_length = name_length;
 }
 
-std::string UserName::getUserName() const
+const std::string& UserName::getUserName() const
 {
   return m_user_name;
 }
@@ -99,6 +106,11 @@ void UserName::setUserName(const std::string& user_name)
   m_user_name = user_name;
 }
 
+void UserName::setUserName(std::string&& user_name)
+{
+  m_user_name = std::move(user_name);
+}
+
 
 } // namespace datastructure
 } // namespace sick
@@ -0,0 +1,162 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file BeamDecoderTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/BeamDecoder.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using sick::data_processing::BeamDecoder;
+
+// Written behind the decoded beams to detect writes past the end of the columns.
+const uint16_t DISTANCE_GUARD = 0xA5A5;
+const uint8_t BYTE_GUARD      = 0x5A;
+
+/*!
+ * \brief The columns decoded from a beam block, with one guard value behind the last beam.
+ */
+struct Columns
+{
+  explicit Columns(std::size_t num_beams)
+    : distances(num_beams + 1, DISTANCE_GUARD)
+    , reflectivities(num_beams + 1, BYTE_GUARD)
+    , status_bytes(num_beams + 1, BYTE_GUARD)
+  {
+  }
+
+  std::vector<uint16_t> distances;
+  std::vector<uint8_t> reflectivities;
+  std::vector<uint8_t> status_bytes;
+};
+
+Columns decode(BeamDecoder::InstructionSet instruction_set,
+               const std::vector<uint8_t>& block,
+               std::size_t offset,
+               std::size_t num_beams)
+{
+  Columns columns(num_beams);
+  BeamDecoder::decode(instruction_set,
+                      block.data() + offset,
+                      num_beams,
+                      columns.distances.data(),
+                      columns.reflectivities.data(),
+                      columns.status_bytes.data());
+  return columns;
+}
+
+class BeamDecoderTest : public ::testing::TestWithParam<BeamDecoder::InstructionSet>
+{
+protected:
+  BeamDecoderTest()
+    : m_random_engine(GetParam())
+  {
+  }
+
+  /*!
+   * \brief Decodes a random block with the kernel under test and compares it with the scalar
+   * kernel. The block starts at the given offset to cover unaligned input.
+   */
+  void checkRandomBlock(std::size_t num_beams, std::size_t offset)
+  {
+    std::vector<uint8_t> block(offset + num_beams * BeamDecoder::BEAM_SIZE);
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+    for (std::size_t i = 0; i < block.size(); ++i)
+    {
+      block[i] = static_cast<uint8_t>(byte_distribution(m_random_engine));
+    }
+
+    Columns expected = decode(BeamDecoder::SCALAR, block, offset, num_beams);
+    Columns actual   = decode(GetParam(), block, offset, num_beams);
+
+    SCOPED_TRACE(testing::Message() << num_beams << " beams at offset " << offset);
+    EXPECT_EQ(expected.distances, actual.distances);
+    EXPECT_EQ(expected.reflectivities, actual.reflectivities);
+    EXPECT_EQ(expected.status_bytes, actual.status_bytes);
+  }
+
+  std::mt19937 m_random_engine;
+};
+
+} // namespace
+
+TEST(BeamDecoderScalarTest, DecodesBeamRecordsIntoColumns)
+{
+  const std::size_t num_beams = 3;
+  std::vector<uint8_t> block  = {
+    0x34, 0x12, 0x56, 0x78, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x80, 0xFE, 0xC1};
+
+  Columns columns = decode(BeamDecoder::SCALAR, block, 0, num_beams);
+
+  EXPECT_EQ(std::vector<uint16_t>({0x1234, 0xFFFF, 0x8000, DISTANCE_GUARD}), columns.distances);
+  EXPECT_EQ(std::vector<uint8_t>({0x56, 0x00, 0xFE, BYTE_GUARD}), columns.reflectivities);
+  EXPECT_EQ(std::vector<uint8_t>({0x78, 0x01, 0xC1, BYTE_GUARD}), columns.status_bytes);
+}
+
+TEST_P(BeamDecoderTest, MatchesScalarKernelForAllShortBlocks)
+{
+  if (!BeamDecoder::isSupported(GetParam()))
+  {
+    GTEST_SKIP() << "The kernel is not supported by this build or CPU";
+  }
+  // Covers the SIMD loops with every possible length of the scalar tail.
+  for (std::size_t num_beams = 0; num_beams <= 100; ++num_beams)
+  {
+    for (std::size_t offset = 0; offset < BeamDecoder::BEAM_SIZE; ++offset)
+    {
+      checkRandomBlock(num_beams, offset);
+    }
+  }
+}
+
+TEST_P(BeamDecoderTest, MatchesScalarKernelForRandomOddBlocks)
+{
+  if (!BeamDecoder::isSupported(GetParam()))
+  {
+    GTEST_SKIP() << "The kernel is not supported by this build or CPU";
+  }
+  std::uniform_int_distribution<std::size_t> length_distribution(0, 1500);
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    checkRandomBlock(2 * length_distribution(m_random_engine) + 1, i % BeamDecoder::BEAM_SIZE);
+  }
+  // A full scan of a microScan3.
+  checkRandomBlock(2751, 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(Kernels,
+                         BeamDecoderTest,
+                         ::testing::Values(BeamDecoder::SSE2, BeamDecoder::AVX2));
@@ -0,0 +1,259 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file Cola2SessionTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/cola2/Cola2Session.h"
+#include "sick_safetyscanners_base/cola2/VariableCommand.h"
+#include "sick_safetyscanners_base/communication/TCPClient.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using boost::asio::ip::tcp;
+
+const uint32_t SESSION_ID = 0x12345678;
+
+/*!
+ * \brief A telegram the fake sensor received.
+ */
+struct Request
+{
+  std::size_t connection;
+  uint8_t command_type;
+  uint16_t variable_index;
+  bool answered;
+};
+
+/*!
+ * \brief Answers Cola2 sessions and variable requests on a local port. The connection is shut down
+ * on a given variable request, it and the requests sent behind it in the same window are left
+ * without a reply.
+ */
+class FakeSensor
+{
+public:
+  explicit FakeSensor(std::size_t drop_at_request)
+    : m_io_service()
+    , m_acceptor(m_io_service,
+                 tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0))
+    , m_drop_at_request(drop_at_request)
+    , m_stopped(false)
+  {
+    m_thread = std::thread([this]() { serve(); });
+  }
+
+  ~FakeSensor()
+  {
+    // Unblocks the pending accept.
+    m_stopped = true;
+    boost::system::error_code ec;
+    tcp::socket socket(m_io_service);
+    socket.connect(m_acceptor.local_endpoint(), ec);
+    m_thread.join();
+  }
+
+  sick::types::port_t getPort() const { return m_acceptor.local_endpoint().port(); }
+
+  std::vector<Request> getRequests() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requests;
+  }
+
+private:
+  boost::asio::io_service m_io_service;
+  tcp::acceptor m_acceptor;
+  std::size_t m_drop_at_request;
+  std::atomic<bool> m_stopped;
+  std::thread m_thread;
+  mutable std::mutex m_mutex;
+  std::vector<Request> m_requests;
+
+  void serve()
+  {
+    std::size_t connection        = 0;
+    std::size_t variable_requests = 0;
+    while (true)
+    {
+      tcp::socket socket(m_io_service);
+      boost::system::error_code ec;
+      m_acceptor.accept(socket, ec);
+      if (ec || m_stopped)
+      {
+        return;
+      }
+      ++connection;
+
+      bool dropped = false;
+      std::vector<uint8_t> telegram;
+      while (readTelegram(socket, telegram))
+      {
+        Request request;
+        request.connection     = connection;
+        request.command_type   = telegram[16];
+        request.variable_index = 0;
+        if (request.command_type == 'R')
+        {
+          request.variable_index = static_cast<uint16_t>(telegram[18] | (telegram[19] << 8));
+          if (!dropped && ++variable_requests == m_drop_at_request)
+          {
+            // The client sees the end of the stream after the replies sent so far.
+            socket.shutdown(tcp::socket::shutdown_send, ec);
+            dropped = true;
+          }
+        }
+        request.answered = !dropped;
+        if (request.answered)
+        {
+          reply(socket, telegram);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requests.push_back(request);
+      }
+    }
+  }
+
+  static bool readTelegram(tcp::socket& socket, std::vector<uint8_t>& telegram)
+  {
+    boost::system::error_code ec;
+    telegram.resize(8);
+    boost::asio::read(socket, boost::asio::buffer(telegram), ec);
+    if (ec)
+    {
+      return false;
+    }
+    std::size_t length =
+      (telegram[4] << 24) | (telegram[5] << 16) | (telegram[6] << 8) | telegram[7];
+    telegram.resize(8 + length);
+    boost::asio::read(socket, boost::asio::buffer(&telegram[8], length), ec);
+    return !ec;
+  }
+
+  static void reply(tcp::socket& socket, const std::vector<uint8_t>& request)
+  {
+    // Same header as the request, acknowledged, followed by the variable index for reads.
+    std::vector<uint8_t> reply(request.begin(), request.begin() + 18);
+    reply[17] = 'A';
+    if (request[16] == 'O')
+    {
+      reply[10] = static_cast<uint8_t>(SESSION_ID >> 24);
+      reply[11] = static_cast<uint8_t>(SESSION_ID >> 16);
+      reply[12] = static_cast<uint8_t>(SESSION_ID >> 8);
+      reply[13] = static_cast<uint8_t>(SESSION_ID);
+    }
+    else if (request[16] == 'R')
+    {
+      reply.insert(reply.end(), request.begin() + 18, request.begin() + 20);
+    }
+    const std::size_t length = reply.size() - 8;
+    reply[4]                 = static_cast<uint8_t>(length >> 24);
+    reply[5]                 = static_cast<uint8_t>(length >> 16);
+    reply[6]                 = static_cast<uint8_t>(length >> 8);
+    reply[7]                 = static_cast<uint8_t>(length);
+    boost::system::error_code ec;
+    boost::asio::write(socket, boost::asio::buffer(reply), ec);
+  }
+};
+
+std::size_t countRequests(const std::vector<Request>& requests,
+                          uint16_t variable_index,
+                          bool answered)
+{
+  std::size_t count = 0;
+  for (const Request& request : requests)
+  {
+    count += request.command_type == 'R' && request.variable_index == variable_index &&
+             request.answered == answered;
+  }
+  return count;
+}
+
+} // namespace
+
+TEST(Cola2SessionTest, RepeatsOnlyUnansweredCommandsOfADroppedWindow)
+{
+  // The first request opens the reused session, the connection drops on the fourth, the third
+  // command of the batch.
+  FakeSensor sensor(4);
+  std::vector<Request> requests;
+  {
+    sick::cola2::Cola2Session session(sick::communication::TCPClientPtr(
+      new sick::communication::TCPClient(boost::asio::ip::address_v4::loopback(),
+                                         sensor.getPort())));
+    session.setSessionReuse(true);
+
+    sick::cola2::VariableCommand first_command(session, 100);
+    session.executeCommand(first_command);
+    ASSERT_TRUE(first_command.wasSuccessful());
+
+    std::vector<std::unique_ptr<sick::cola2::VariableCommand> > commands;
+    std::vector<sick::cola2::Command*> command_ptrs;
+    for (uint16_t i = 1; i <= 6; ++i)
+    {
+      commands.emplace_back(new sick::cola2::VariableCommand(session, i));
+      command_ptrs.push_back(commands.back().get());
+    }
+    session.executeCommands(command_ptrs, 4);
+
+    for (const std::unique_ptr<sick::cola2::VariableCommand>& cmd : commands)
+    {
+      EXPECT_TRUE(cmd->wasSuccessful()) << "variable " << cmd->getVariableIndex();
+    }
+  }
+  requests = sensor.getRequests();
+
+  // Answered before the connection dropped, they must not be executed again.
+  EXPECT_EQ(0u, countRequests(requests, 1, false));
+  EXPECT_EQ(0u, countRequests(requests, 2, false));
+  // Received in the dropped window without a reply. Commands sent behind them before the client
+  // noticed the drop are left without a reply as well, depending on the timing.
+  EXPECT_EQ(1u, countRequests(requests, 3, false));
+  EXPECT_EQ(1u, countRequests(requests, 4, false));
+  // Each command is answered exactly once, the unanswered ones are repeated once in the new
+  // session.
+  for (uint16_t i = 1; i <= 6; ++i)
+  {
+    EXPECT_EQ(1u, countRequests(requests, i, true)) << "variable " << i;
+    EXPECT_GE(1u, countRequests(requests, i, false)) << "variable " << i;
+  }
+  ASSERT_FALSE(requests.empty());
+  EXPECT_EQ(2u, requests.back().connection);
+}
@@ -0,0 +1,126 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataPoolTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/datastructure/DataPool.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using sick::datastructure::Data;
+using sick::datastructure::DataPool;
+
+TEST(DataPoolTest, ReleasedObjectsAreReused)
+{
+  DataPool pool(2, 4);
+  Data* object = nullptr;
+  {
+    std::shared_ptr<Data> data = pool.acquire();
+    ASSERT_TRUE(data);
+    object = data.get();
+    EXPECT_EQ(1u, pool.getNumAvailableObjects());
+  }
+  EXPECT_EQ(2u, pool.getNumAvailableObjects());
+  EXPECT_EQ(object, pool.acquire().get());
+  EXPECT_EQ(2u, pool.getNumObjects());
+}
+
+TEST(DataPoolTest, GrowsUpToTheMaximumNumberOfObjects)
+{
+  DataPool pool(1, 3);
+  std::vector<std::shared_ptr<const Data>> retained;
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    retained.push_back(pool.acquire());
+    ASSERT_TRUE(retained.back());
+  }
+  EXPECT_EQ(3u, pool.getNumObjects());
+  EXPECT_FALSE(pool.acquire());
+
+  retained.pop_back();
+  EXPECT_TRUE(pool.acquire());
+  EXPECT_EQ(3u, pool.getNumObjects());
+}
+
+TEST(DataPoolTest, ObjectsOutliveThePool)
+{
+  std::shared_ptr<const Data> data;
+  {
+    DataPool pool(1, 1);
+    data = pool.acquire();
+  }
+  ASSERT_TRUE(data);
+  EXPECT_EQ(0u, data->getMeasurementData().getNumberOfScanPoints());
+}
+
+TEST(DataPoolTest, ReleasedObjectsDropTheirPendingBlocks)
+{
+  DataPool pool(1, 1);
+  std::weak_ptr<const std::vector<uint8_t>> storage;
+  {
+    std::shared_ptr<Data> data = pool.acquire();
+    ASSERT_TRUE(data);
+    sick::datastructure::PacketBuffer buffer(std::vector<uint8_t>(64, 0u));
+    storage = buffer.getStorage();
+    data->setPendingBlocks(std::move(buffer), nullptr);
+    EXPECT_TRUE(data->hasPendingBlocks());
+    EXPECT_FALSE(storage.expired());
+  }
+  EXPECT_TRUE(storage.expired());
+  std::shared_ptr<Data> data = pool.acquire();
+  ASSERT_TRUE(data);
+  EXPECT_FALSE(data->hasPendingBlocks());
+}
+
+TEST(DataPoolTest, ObjectsAreReleasedFromOtherThreads)
+{
+  DataPool pool(4, 4);
+  for (std::size_t round = 0; round < 100; ++round)
+  {
+    std::vector<std::shared_ptr<const Data>> handed_out;
+    std::shared_ptr<Data> data;
+    while ((data = pool.acquire()))
+    {
+      handed_out.push_back(data);
+    }
+    data.reset();
+    ASSERT_EQ(4u, handed_out.size());
+    std::thread consumer([&handed_out] { handed_out.clear(); });
+    consumer.join();
+    EXPECT_EQ(4u, pool.getNumAvailableObjects());
+  }
+}
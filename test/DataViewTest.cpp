@@ -0,0 +1,267 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file DataViewTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/DataView.h"
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include "ScanBuilder.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+const std::size_t FRAGMENT_LENGTH = 333;
+
+/*!
+ * \brief Splits a scan into fragments so that fields straddle the fragment boundaries.
+ */
+sick::datastructure::PacketBuffer::FragmentVector buildFragments(const std::vector<uint8_t>& scan)
+{
+  sick::datastructure::PacketBuffer::FragmentVector fragments;
+  for (std::size_t position = 0; position < scan.size(); position += FRAGMENT_LENGTH)
+  {
+    std::size_t length = std::min(FRAGMENT_LENGTH, scan.size() - position);
+    sick::datastructure::PacketBuffer::Fragment fragment;
+    fragment.buffer = std::make_shared<const std::vector<uint8_t>>(
+      scan.begin() + position, scan.begin() + position + length);
+    fragment.offset   = 0;
+    fragment.length   = length;
+    fragment.position = position;
+    fragments.push_back(fragment);
+  }
+  return fragments;
+}
+
+void expectViewMatchesData(const sick::data_processing::DataView& view,
+                           const sick::datastructure::Data& data)
+{
+  ASSERT_TRUE(view.hasDataHeader());
+  const sick::datastructure::DataHeader& header     = data.getDataHeader();
+  sick::data_processing::DataHeaderView header_view = view.getDataHeader();
+  EXPECT_EQ(header.getVersionIndicator(), header_view.getVersionIndicator());
+  EXPECT_EQ(header.getVersionMajorVersion(), header_view.getVersionMajorVersion());
+  EXPECT_EQ(header.getVersionMinorVersion(), header_view.getVersionMinorVersion());
+  EXPECT_EQ(header.getVersionRelease(), header_view.getVersionRelease());
+  EXPECT_EQ(header.getSerialNumberOfDevice(), header_view.getSerialNumberOfDevice());
+  EXPECT_EQ(header.getSerialNumberOfSystemPlug(), header_view.getSerialNumberOfSystemPlug());
+  EXPECT_EQ(header.getChannelNumber(), header_view.getChannelNumber());
+  EXPECT_EQ(header.getSequenceNumber(), header_view.getSequenceNumber());
+  EXPECT_EQ(header.getScanNumber(), header_view.getScanNumber());
+  EXPECT_EQ(header.getTimestampDate(), header_view.getTimestampDate());
+  EXPECT_EQ(header.getTimestampTime(), header_view.getTimestampTime());
+  EXPECT_EQ(header.getGeneralSystemStateBlockOffset(),
+            header_view.getGeneralSystemStateBlockOffset());
+  EXPECT_EQ(header.getGeneralSystemStateBlockSize(), header_view.getGeneralSystemStateBlockSize());
+  EXPECT_EQ(header.getDerivedValuesBlockOffset(), header_view.getDerivedValuesBlockOffset());
+  EXPECT_EQ(header.getDerivedValuesBlockSize(), header_view.getDerivedValuesBlockSize());
+  EXPECT_EQ(header.getMeasurementDataBlockOffset(), header_view.getMeasurementDataBlockOffset());
+  EXPECT_EQ(header.getMeasurementDataBlockSize(), header_view.getMeasurementDataBlockSize());
+  EXPECT_EQ(header.getIntrusionDataBlockOffset(), header_view.getIntrusionDataBlockOffset());
+  EXPECT_EQ(header.getIntrusionDataBlockSize(), header_view.getIntrusionDataBlockSize());
+  EXPECT_EQ(header.getApplicationDataBlockOffset(), header_view.getApplicationDataBlockOffset());
+  EXPECT_EQ(header.getApplicationDataBlockSize(), header_view.getApplicationDataBlockSize());
+
+  ASSERT_TRUE(view.hasGeneralSystemState());
+  const sick::datastructure::GeneralSystemState& state = data.getGeneralSystemState();
+  sick::data_processing::GeneralSystemStateView state_view = view.getGeneralSystemState();
+  EXPECT_EQ(state.getRunModeActive(), state_view.getRunModeActive());
+  EXPECT_EQ(state.getStandbyModeActive(), state_view.getStandbyModeActive());
+  EXPECT_EQ(state.getContaminationWarning(), state_view.getContaminationWarning());
+  EXPECT_EQ(state.getContaminationError(), state_view.getContaminationError());
+  EXPECT_EQ(state.getReferenceContourStatus(), state_view.getReferenceContourStatus());
+  EXPECT_EQ(state.getManipulationStatus(), state_view.getManipulationStatus());
+  EXPECT_EQ(state.getSafeCutOffPath().getWord(), state_view.getSafeCutOffPath().getWord());
+  EXPECT_EQ(state.getNonSafeCutOffPath().getWord(), state_view.getNonSafeCutOffPath().getWord());
+  EXPECT_EQ(state.getResetRequiredCutOffPath().getWord(),
+            state_view.getResetRequiredCutOffPath().getWord());
+  EXPECT_EQ(state.getCurrentMonitoringCaseNoTable1(),
+            state_view.getCurrentMonitoringCaseNoTable1());
+  EXPECT_EQ(state.getCurrentMonitoringCaseNoTable2(),
+            state_view.getCurrentMonitoringCaseNoTable2());
+  EXPECT_EQ(state.getCurrentMonitoringCaseNoTable3(),
+            state_view.getCurrentMonitoringCaseNoTable3());
+  EXPECT_EQ(state.getCurrentMonitoringCaseNoTable4(),
+            state_view.getCurrentMonitoringCaseNoTable4());
+  EXPECT_EQ(state.getApplicationError(), state_view.getApplicationError());
+  EXPECT_EQ(state.getDeviceError(), state_view.getDeviceError());
+
+  ASSERT_TRUE(view.hasDerivedValues());
+  const sick::datastructure::DerivedValues& derived_values     = data.getDerivedValues();
+  sick::data_processing::DerivedValuesView derived_values_view = view.getDerivedValues();
+  EXPECT_EQ(derived_values.getMultiplicationFactor(),
+            derived_values_view.getMultiplicationFactor());
+  EXPECT_EQ(derived_values.getNumberOfBeams(), derived_values_view.getNumberOfBeams());
+  EXPECT_EQ(derived_values.getScanTime(), derived_values_view.getScanTime());
+  EXPECT_FLOAT_EQ(derived_values.getStartAngle(), derived_values_view.getStartAngle());
+  EXPECT_FLOAT_EQ(derived_values.getAngularBeamResolution(),
+                  derived_values_view.getAngularBeamResolution());
+  EXPECT_EQ(derived_values.getInterbeamPeriod(), derived_values_view.getInterbeamPeriod());
+
+  ASSERT_TRUE(view.hasMeasurementData());
+  const sick::datastructure::MeasurementData& measurement_data     = data.getMeasurementData();
+  sick::data_processing::MeasurementDataView measurement_data_view = view.getMeasurementData();
+  EXPECT_EQ(measurement_data.getNumberOfBeams(), measurement_data_view.getNumberOfBeams());
+  ASSERT_EQ(measurement_data.getNumberOfScanPoints(),
+            measurement_data_view.getNumberOfScanPoints());
+  for (std::size_t i = 0; i < measurement_data.getNumberOfScanPoints(); ++i)
+  {
+    EXPECT_EQ(measurement_data.getDistancesVector()[i], measurement_data_view.getDistance(i));
+    EXPECT_EQ(measurement_data.getReflectivitiesVector()[i],
+              measurement_data_view.getReflectivity(i));
+    EXPECT_EQ(measurement_data.getStatusBytesVector()[i], measurement_data_view.getStatusByte(i));
+    EXPECT_FLOAT_EQ(measurement_data.getAnglesVector()[i], measurement_data_view.getAngle(i));
+  }
+
+  ASSERT_TRUE(view.hasIntrusionData());
+  const std::vector<sick::datastructure::IntrusionDatum>& intrusion_data =
+    data.getIntrusionData().getIntrusionDataVector();
+  sick::data_processing::IntrusionDataView intrusion_data_view = view.getIntrusionData();
+  ASSERT_EQ(intrusion_data.size(),
+            sick::data_processing::IntrusionDataView::NUM_INTRUSION_DATUMS);
+  for (std::size_t i = 0; i < intrusion_data.size(); ++i)
+  {
+    sick::data_processing::IntrusionDatumView datum_view = intrusion_data_view.getIntrusionDatum(i);
+    const sick::datastructure::BeamBitset& flags         = intrusion_data[i].getFlags();
+    EXPECT_EQ(intrusion_data[i].getSize(), static_cast<int32_t>(datum_view.getSize()));
+    ASSERT_EQ(flags.getSize(), datum_view.getNumberOfFlags());
+    for (std::size_t j = 0; j < flags.getSize(); ++j)
+    {
+      EXPECT_EQ(flags.getFlag(j), datum_view.getFlag(j));
+    }
+  }
+
+  ASSERT_TRUE(view.hasApplicationData());
+  const sick::datastructure::ApplicationInputs& inputs = data.getApplicationData().getInputs();
+  sick::data_processing::ApplicationInputsView inputs_view = view.getApplicationData().getInputs();
+  EXPECT_EQ(inputs.getUnsafeInputsInputSources().getWord(),
+            inputs_view.getUnsafeInputsInputSources().getWord());
+  EXPECT_EQ(inputs.getUnsafeInputsFlags().getWord(), inputs_view.getUnsafeInputsFlags().getWord());
+  for (std::size_t i = 0; i < inputs.getMonitoringCases().size(); ++i)
+  {
+    EXPECT_EQ(inputs.getMonitoringCases()[i], inputs_view.getMonitoringCase(i));
+  }
+  EXPECT_EQ(inputs.getMonitoringCaseFlags().getWord(),
+            inputs_view.getMonitoringCaseFlags().getWord());
+  EXPECT_EQ(inputs.getVelocity0(), inputs_view.getVelocity0());
+  EXPECT_EQ(inputs.getVelocity1(), inputs_view.getVelocity1());
+  EXPECT_EQ(inputs.getVelocity0Valid(), inputs_view.getVelocity0Valid());
+  EXPECT_EQ(inputs.getVelocity1Valid(), inputs_view.getVelocity1Valid());
+  EXPECT_EQ(inputs.getVelocity0TransmittedSafely(), inputs_view.getVelocity0TransmittedSafely());
+  EXPECT_EQ(inputs.getVelocity1TransmittedSafely(), inputs_view.getVelocity1TransmittedSafely());
+  EXPECT_EQ(inputs.getSleepModeInput(), inputs_view.getSleepModeInput());
+
+  const sick::datastructure::ApplicationOutputs& outputs = data.getApplicationData().getOutputs();
+  sick::data_processing::ApplicationOutputsView outputs_view =
+    view.getApplicationData().getOutputs();
+  EXPECT_EQ(outputs.getEvalOut().getWord(), outputs_view.getEvalOut().getWord());
+  EXPECT_EQ(outputs.getEvalOutIsSafe().getWord(), outputs_view.getEvalOutIsSafe().getWord());
+  EXPECT_EQ(outputs.getEvalOutIsValid().getWord(), outputs_view.getEvalOutIsValid().getWord());
+  for (std::size_t i = 0; i < outputs.getMonitoringCases().size(); ++i)
+  {
+    EXPECT_EQ(outputs.getMonitoringCases()[i], outputs_view.getMonitoringCase(i));
+  }
+  EXPECT_EQ(outputs.getMonitoringCaseFlags().getWord(),
+            outputs_view.getMonitoringCaseFlags().getWord());
+  EXPECT_EQ(outputs.getSleepModeOutput(), outputs_view.getSleepModeOutput());
+  EXPECT_EQ(outputs.getHostErrorFlagContaminationWarning(),
+            outputs_view.getHostErrorFlagContaminationWarning());
+  EXPECT_EQ(outputs.getHostErrorFlagContaminationError(),
+            outputs_view.getHostErrorFlagContaminationError());
+  EXPECT_EQ(outputs.getHostErrorFlagManipulationError(),
+            outputs_view.getHostErrorFlagManipulationError());
+  EXPECT_EQ(outputs.getHostErrorFlagGlare(), outputs_view.getHostErrorFlagGlare());
+  EXPECT_EQ(outputs.getHostErrorFlagReferenceContourIntruded(),
+            outputs_view.getHostErrorFlagReferenceContourIntruded());
+  EXPECT_EQ(outputs.getHostErrorFlagCriticalError(),
+            outputs_view.getHostErrorFlagCriticalError());
+  EXPECT_EQ(outputs.getVelocity0(), outputs_view.getVelocity0());
+  EXPECT_EQ(outputs.getVelocity1(), outputs_view.getVelocity1());
+  EXPECT_EQ(outputs.getVelocity0Valid(), outputs_view.getVelocity0Valid());
+  EXPECT_EQ(outputs.getVelocity1Valid(), outputs_view.getVelocity1Valid());
+  EXPECT_EQ(outputs.getVelocity0TransmittedSafely(),
+            outputs_view.getVelocity0TransmittedSafely());
+  EXPECT_EQ(outputs.getVelocity1TransmittedSafely(),
+            outputs_view.getVelocity1TransmittedSafely());
+  for (std::size_t i = 0; i < outputs.getResultingVelocities().size(); ++i)
+  {
+    EXPECT_EQ(outputs.getResultingVelocities()[i], outputs_view.getResultingVelocity(i));
+  }
+  EXPECT_EQ(outputs.getResultingVelocityIsValid().getWord(),
+            outputs_view.getResultingVelocityIsValid().getWord());
+  EXPECT_EQ(outputs.getFlagsSleepModeOutputIsValid(),
+            outputs_view.getFlagsSleepModeOutputIsValid());
+  EXPECT_EQ(outputs.getFlagsHostErrorFlagsAreValid(),
+            outputs_view.getFlagsHostErrorFlagsAreValid());
+}
+
+} // namespace
+
+TEST(DataViewTest, ContiguousViewMatchesParsedData)
+{
+  sick::datastructure::PacketBuffer buffer(sick::test::buildScan());
+  sick::data_processing::ParseData parser;
+  sick::datastructure::Data data = parser.parseUDPSequence(buffer);
+
+  sick::data_processing::DataView view(buffer);
+  expectViewMatchesData(view, data);
+}
+
+TEST(DataViewTest, FragmentedViewMatchesParsedData)
+{
+  std::vector<uint8_t> scan = sick::test::buildScan();
+  sick::datastructure::PacketBuffer contiguous_buffer(scan);
+  sick::datastructure::PacketBuffer fragmented_buffer(buildFragments(scan));
+  sick::data_processing::ParseData parser;
+  sick::datastructure::Data data = parser.parseUDPSequence(contiguous_buffer);
+
+  sick::data_processing::DataView view(fragmented_buffer);
+  expectViewMatchesData(view, data);
+}
+
+TEST(DataViewTest, DerivedValuesAreScaledToDegrees)
+{
+  sick::datastructure::PacketBuffer buffer(sick::test::buildScan());
+  sick::data_processing::DataView view(buffer);
+
+  sick::data_processing::DerivedValuesView derived_values_view = view.getDerivedValues();
+  EXPECT_FLOAT_EQ(-47.5f, derived_values_view.getStartAngle());
+  EXPECT_FLOAT_EQ(0.25f, derived_values_view.getAngularBeamResolution());
+  EXPECT_EQ(sick::test::ScanParameters().multiplication_factor,
+            derived_values_view.getMultiplicationFactor());
+}
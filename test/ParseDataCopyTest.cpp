@@ -0,0 +1,301 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ParseDataCopyTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/ParseData.h"
+#include "sick_safetyscanners_base/datastructure/Data.h"
+#include "sick_safetyscanners_base/datastructure/PacketBuffer.h"
+
+#include "ScanBuilder.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const uint16_t NUMBER_OF_BEAMS = 2750;
+
+sick::test::ScanParameters getScanParameters()
+{
+  sick::test::ScanParameters parameters;
+  parameters.number_of_beams = NUMBER_OF_BEAMS;
+  return parameters;
+}
+
+// Every column of a scan holds at least one byte per beam, so each allocation of at least this
+// size is a copy of a scan column.
+const std::size_t SCAN_SIZED_ALLOCATION = NUMBER_OF_BEAMS;
+
+std::atomic<bool> g_counting(false);
+std::atomic<std::size_t> g_scan_sized_allocations(0);
+
+/*!
+ * \brief Counts the scan sized heap allocations made during its lifetime.
+ */
+class ScanCopyCounter
+{
+public:
+  ScanCopyCounter()
+  {
+    g_scan_sized_allocations = 0;
+    g_counting               = true;
+  }
+
+  ~ScanCopyCounter() { g_counting = false; }
+
+  std::size_t getCount() const { return g_scan_sized_allocations; }
+};
+
+void* allocateNoThrow(std::size_t size) noexcept
+{
+  if (g_counting && size >= SCAN_SIZED_ALLOCATION)
+  {
+    ++g_scan_sized_allocations;
+  }
+  return std::malloc(size ? size : 1);
+}
+
+void* allocate(std::size_t size)
+{
+  void* ptr = allocateNoThrow(size);
+  if (!ptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void deallocate(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+class ParseDataCopyTest : public ::testing::Test
+{
+protected:
+  ParseDataCopyTest()
+    : m_buffer(sick::test::buildScan(getScanParameters()))
+  {
+    // The angle table is shared by all scans, building it is not a copy of the scan.
+    m_parser.parseUDPSequence(m_buffer);
+  }
+
+  sick::datastructure::PacketBuffer m_buffer;
+  sick::data_processing::ParseData m_parser;
+};
+
+} // namespace
+
+// The replacements below form the complete set of the non-aligned allocation functions, so that
+// every allocation of the test and the library is counted and freed by the matching function.
+void* operator new(std::size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocateNoThrow(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocateNoThrow(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+  deallocate(ptr);
+}
+
+TEST_F(ParseDataCopyTest, ParsingIntoNewDataAllocatesEachColumnOnce)
+{
+  ScanCopyCounter counter;
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+
+  // Distances, reflectivities and status bytes, the angles come from the shared table.
+  EXPECT_EQ(3u, counter.getCount());
+  EXPECT_EQ(NUMBER_OF_BEAMS, data.getMeasurementData().getNumberOfScanPoints());
+}
+
+TEST_F(ParseDataCopyTest, ParsingIntoReusedDataDoesNotCopy)
+{
+  sick::datastructure::Data data;
+  m_parser.parseUDPSequence(m_buffer, data);
+
+  ScanCopyCounter counter;
+  m_parser.parseUDPSequence(m_buffer, data);
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_EQ(NUMBER_OF_BEAMS, data.getMeasurementData().getNumberOfScanPoints());
+}
+
+TEST_F(ParseDataCopyTest, ParsedColumnsMatchTheScan)
+{
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+  const sick::datastructure::MeasurementData& measurement_data = data.getMeasurementData();
+
+  ASSERT_EQ(NUMBER_OF_BEAMS, measurement_data.getNumberOfScanPoints());
+  for (std::size_t i = 0; i < NUMBER_OF_BEAMS; ++i)
+  {
+    EXPECT_EQ(sick::test::getBeamDistance(i), measurement_data.getDistancesVector()[i]);
+    EXPECT_EQ(sick::test::getBeamReflectivity(i), measurement_data.getReflectivitiesVector()[i]);
+    EXPECT_EQ(sick::test::getBeamStatus(i), measurement_data.getStatusBytesVector()[i]);
+  }
+  EXPECT_EQ(24u, data.getIntrusionData().getIntrusionDataVector().size());
+}
+
+TEST_F(ParseDataCopyTest, GettersDoNotCopy)
+{
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+
+  ScanCopyCounter counter;
+  const std::vector<uint16_t>& distances = data.getMeasurementData().getDistancesVector();
+  const std::vector<float>& angles       = data.getMeasurementData().getAnglesVector();
+  const std::vector<sick::datastructure::IntrusionDatum>& intrusion_data =
+    data.getIntrusionData().getIntrusionDataVector();
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_EQ(&distances, &data.getMeasurementData().getDistancesVector());
+  EXPECT_EQ(&angles, &data.getMeasurementData().getAnglesVector());
+  EXPECT_EQ(&intrusion_data, &data.getIntrusionData().getIntrusionDataVector());
+}
+
+TEST_F(ParseDataCopyTest, SharedBlocksAliasTheScan)
+{
+  std::shared_ptr<const sick::datastructure::Data> data =
+    std::make_shared<sick::datastructure::Data>(m_parser.parseUDPSequence(m_buffer));
+
+  ScanCopyCounter counter;
+  std::shared_ptr<const sick::datastructure::MeasurementData> measurement_data =
+    sick::datastructure::Data::getMeasurementDataPtr(data);
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_EQ(&data->getMeasurementData(), measurement_data.get());
+  data.reset();
+  EXPECT_EQ(NUMBER_OF_BEAMS, measurement_data->getNumberOfScanPoints());
+}
+
+TEST_F(ParseDataCopyTest, MovingDataDoesNotCopy)
+{
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+  const uint16_t* distances       = data.getMeasurementData().getDistancesVector().data();
+
+  ScanCopyCounter counter;
+  sick::datastructure::Data moved(std::move(data));
+  sick::datastructure::Data assigned;
+  assigned = std::move(moved);
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_EQ(distances, assigned.getMeasurementData().getDistancesVector().data());
+}
+
+TEST_F(ParseDataCopyTest, CopyingDataCopiesEachColumnOnce)
+{
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+
+  ScanCopyCounter counter;
+  sick::datastructure::Data copy(data);
+
+  EXPECT_EQ(3u, counter.getCount());
+  EXPECT_EQ(data.getMeasurementData().getAngleTablePtr(),
+            copy.getMeasurementData().getAngleTablePtr());
+}
+
+TEST_F(ParseDataCopyTest, MoveSettersDoNotCopy)
+{
+  sick::datastructure::Data data = m_parser.parseUDPSequence(m_buffer);
+  sick::datastructure::MeasurementData measurement_data = data.getMeasurementData();
+  std::vector<sick::datastructure::IntrusionDatum> intrusion_data =
+    data.getIntrusionData().getIntrusionDataVector();
+  const uint16_t* distances = measurement_data.getDistancesVector().data();
+  const sick::datastructure::IntrusionDatum* intrusions = intrusion_data.data();
+
+  ScanCopyCounter counter;
+  data.setMeasurementData(std::move(measurement_data));
+  data.getMutableIntrusionData().setIntrusionDataVector(std::move(intrusion_data));
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_EQ(distances, data.getMeasurementData().getDistancesVector().data());
+  EXPECT_EQ(intrusions, data.getIntrusionData().getIntrusionDataVector().data());
+}
+
+TEST_F(ParseDataCopyTest, LazilyParsingSkipsUnselectedBlocks)
+{
+  m_parser.setParseMask(sick::SensorDataFeatures::ALL &
+                        ~sick::SensorDataFeatures::MEASUREMENT_DATA);
+  sick::datastructure::Data data;
+
+  ScanCopyCounter counter;
+  sick::datastructure::PacketBuffer buffer = m_buffer;
+  m_parser.parseUDPSequenceLazily(std::move(buffer), data);
+
+  EXPECT_EQ(0u, counter.getCount());
+  EXPECT_TRUE(data.getMeasurementData().isEmpty());
+  EXPECT_EQ(0u, data.getMeasurementData().getDistancesVector().capacity());
+  EXPECT_EQ(24u, data.getIntrusionData().getIntrusionDataVector().size());
+}
@@ -0,0 +1,190 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file PointCloudConverterTest.cpp
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#include "sick_safetyscanners_base/data_processing/PointCloudConverter.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+using sick::data_processing::PointCloudConverter;
+using sick::data_processing::PointCloudOptions;
+using sick::datastructure::AngleTable;
+using sick::datastructure::DerivedValues;
+using sick::datastructure::MeasurementData;
+
+// Written behind the converted points to detect writes past the number of returned points.
+const float POINT_GUARD = -12345.0f;
+
+// Angles are sent in units of 1 / 4194304 degree.
+const int32_t START_ANGLE             = -47 * 4194304 - 4194304 / 2;
+const int32_t ANGULAR_BEAM_RESOLUTION = 4194304 / 10;
+
+DerivedValues buildDerivedValues(std::size_t num_beams)
+{
+  DerivedValues derived_values;
+  derived_values.setNumberOfBeams(static_cast<uint16_t>(num_beams));
+  derived_values.setStartAngle(START_ANGLE);
+  derived_values.setAngularBeamResolution(ANGULAR_BEAM_RESOLUTION);
+  return derived_values;
+}
+
+/*!
+ * \brief Converts the beams one by one, as the scalar tail of the converter does.
+ */
+std::vector<float> convertScalar(const PointCloudOptions& options,
+                                 const MeasurementData& measurement_data,
+                                 const AngleTable& angle_table)
+{
+  std::vector<float> points;
+  for (std::size_t i = 0; i < measurement_data.getNumberOfScanPoints(); ++i)
+  {
+    uint8_t status = measurement_data.getStatusBytesVector()[i];
+    if ((options.drop_invalid && !(status & MeasurementData::STATUS_VALID_BIT)) ||
+        (options.drop_infinite && (status & MeasurementData::STATUS_INFINITE_BIT)))
+    {
+      continue;
+    }
+    float range =
+      static_cast<float>(measurement_data.getDistancesVector()[i]) * options.distance_scale;
+    points.push_back(range * angle_table.getCosinesVector()[i]);
+    points.push_back(range * angle_table.getSinesVector()[i]);
+    if (options.with_intensity)
+    {
+      points.push_back(static_cast<float>(measurement_data.getReflectivitiesVector()[i]));
+    }
+  }
+  return points;
+}
+
+class PointCloudConverterTest : public ::testing::TestWithParam<PointCloudOptions>
+{
+protected:
+  PointCloudConverterTest()
+    : m_random_engine(42)
+  {
+  }
+
+  /*!
+   * \brief Converts random beams with the converter and compares the points with the scalar
+   * reference. Random status bytes cover all combinations of the valid and the infinite bit.
+   */
+  void checkRandomScan(std::size_t num_beams)
+  {
+    DerivedValues derived_values = buildDerivedValues(num_beams);
+    std::shared_ptr<const AngleTable> angle_table_ptr =
+      std::make_shared<AngleTable>(derived_values.getStartAngle(),
+                                   derived_values.getAngularBeamResolution(),
+                                   static_cast<uint32_t>(num_beams));
+
+    std::uniform_int_distribution<int> distance_distribution(0, 65535);
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+    MeasurementData measurement_data;
+    measurement_data.setNumberOfBeams(static_cast<uint32_t>(num_beams));
+    measurement_data.setAngleTablePtr(angle_table_ptr);
+    measurement_data.resizeScanPoints(num_beams);
+    for (std::size_t i = 0; i < num_beams; ++i)
+    {
+      measurement_data.getMutableDistances()[i] =
+        static_cast<uint16_t>(distance_distribution(m_random_engine));
+      measurement_data.getMutableReflectivities()[i] =
+        static_cast<uint8_t>(byte_distribution(m_random_engine));
+      measurement_data.getMutableStatusBytes()[i] =
+        static_cast<uint8_t>(byte_distribution(m_random_engine));
+    }
+
+    PointCloudConverter converter(GetParam());
+    std::vector<float> points((num_beams + 1) * converter.getStride(), POINT_GUARD);
+    std::size_t num_points =
+      converter.convert(measurement_data, derived_values, points.data(), num_beams);
+
+    std::vector<float> expected = convertScalar(GetParam(), measurement_data, *angle_table_ptr);
+
+    SCOPED_TRACE(testing::Message() << num_beams << " beams");
+    ASSERT_EQ(expected.size(), num_points * converter.getStride());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_FLOAT_EQ(expected[i], points[i]) << "at float " << i;
+    }
+    for (std::size_t i = expected.size(); i < points.size(); ++i)
+    {
+      EXPECT_EQ(POINT_GUARD, points[i]) << "written past the points at float " << i;
+    }
+  }
+
+  std::mt19937 m_random_engine;
+};
+
+PointCloudOptions makeOptions(bool with_intensity,
+                              bool drop_invalid,
+                              bool drop_infinite,
+                              float distance_scale)
+{
+  PointCloudOptions options;
+  options.with_intensity = with_intensity;
+  options.drop_invalid   = drop_invalid;
+  options.drop_infinite  = drop_infinite;
+  options.distance_scale = distance_scale;
+  return options;
+}
+
+} // namespace
+
+TEST_P(PointCloudConverterTest, MatchesScalarReferenceForAllShortScans)
+{
+  // Covers the vectorized loop with every possible length of the scalar tail.
+  for (std::size_t num_beams = 0; num_beams <= 20; ++num_beams)
+  {
+    checkRandomScan(num_beams);
+  }
+}
+
+TEST_P(PointCloudConverterTest, MatchesScalarReferenceForFullScan)
+{
+  // A full scan of a microScan3, which is not a multiple of the vector width.
+  checkRandomScan(2751);
+}
+
+INSTANTIATE_TEST_SUITE_P(Options,
+                         PointCloudConverterTest,
+                         ::testing::Values(makeOptions(false, false, false, 0.001f),
+                                           makeOptions(true, false, false, 0.001f),
+                                           makeOptions(false, true, false, 0.001f),
+                                           makeOptions(false, false, true, 0.001f),
+                                           makeOptions(false, true, true, 1.0f),
+                                           makeOptions(true, true, true, 0.01f),
+                                           makeOptions(false, false, false, 2.5f)));
@@ -0,0 +1,206 @@
+// this is for emacs file handling -*- mode: c++; indent-tabs-mode: nil -*-
+
+// -- BEGIN LICENSE BLOCK ----------------------------------------------
+
+/*!
+*  Copyright (C) 2018, SICK AG, Waldkirch
+*  Copyright (C) 2018, FZI Forschungszentrum Informatik, Karlsruhe, Germany
+*
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*    http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+
+*/
+
+// -- END LICENSE BLOCK ------------------------------------------------
+
+//----------------------------------------------------------------------
+/*!
+ * \file ScanBuilder.h
+ *
+ * \date 2026-10-18
+ */
+//----------------------------------------------------------------------
+
+#ifndef SICK_SAFETYSCANNERS_BASE_TEST_SCANBUILDER_H
+#define SICK_SAFETYSCANNERS_BASE_TEST_SCANBUILDER_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace sick {
+namespace test {
+
+/*!
+ * \brief The field values of a scan built by buildScan().
+ */
+struct ScanParameters
+{
+  uint16_t number_of_beams{275};
+  std::size_t number_of_intrusions{24};
+  uint32_t serial_number_of_device{0x12345678};
+  uint32_t serial_number_of_system_plug{0x9abcdef0};
+  uint8_t channel_number{1};
+  uint32_t sequence_number{4711};
+  uint32_t scan_number{815};
+  uint16_t timestamp_date{12345};
+  uint32_t timestamp_time{86399999};
+  uint16_t multiplication_factor{2};
+  uint16_t scan_time{40};
+  // Angles are sent in units of 1 / 4194304 degree.
+  int32_t start_angle{-47 * 4194304 - 4194304 / 2};
+  int32_t angular_beam_resolution{4194304 / 4};
+  uint32_t interbeam_period{48};
+};
+
+/*!
+ * \brief Distance of a beam in a built scan.
+ */
+inline uint16_t getBeamDistance(std::size_t beam)
+{
+  return static_cast<uint16_t>(beam * 97);
+}
+
+/*!
+ * \brief Reflectivity of a beam in a built scan.
+ */
+inline uint8_t getBeamReflectivity(std::size_t beam)
+{
+  return static_cast<uint8_t>(beam * 7);
+}
+
+/*!
+ * \brief Status byte of a beam in a built scan.
+ */
+inline uint8_t getBeamStatus(std::size_t beam)
+{
+  return static_cast<uint8_t>(beam * 13);
+}
+
+inline void writeUint16LittleEndian(std::vector<uint8_t>& buffer,
+                                    std::size_t offset,
+                                    uint16_t value)
+{
+  buffer[offset]     = static_cast<uint8_t>(value);
+  buffer[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+inline void writeUint32LittleEndian(std::vector<uint8_t>& buffer,
+                                    std::size_t offset,
+                                    uint32_t value)
+{
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    buffer[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+/*!
+ * \brief Builds a scan containing all data blocks as it is sent by the sensor, with distinct values
+ * in every field the views and the parser read.
+ *
+ * \param parameters The field values of the scan.
+ * \return The scan.
+ */
+inline std::vector<uint8_t> buildScan(const ScanParameters& parameters = ScanParameters())
+{
+  const uint32_t flags_size = (parameters.number_of_beams + 7) / 8;
+
+  const uint16_t general_system_state_offset = 60;
+  const uint16_t general_system_state_size   = 20;
+  const uint16_t derived_values_offset = general_system_state_offset + general_system_state_size;
+  const uint16_t derived_values_size   = 24;
+  const uint16_t measurement_data_offset = derived_values_offset + derived_values_size;
+  const uint16_t measurement_data_size   = 4 + 4 * parameters.number_of_beams;
+  const uint16_t intrusion_data_offset   = measurement_data_offset + measurement_data_size;
+  const uint16_t intrusion_data_size =
+    static_cast<uint16_t>(parameters.number_of_intrusions * (4 + flags_size));
+  const uint16_t application_data_offset = intrusion_data_offset + intrusion_data_size;
+  const uint16_t application_data_size   = 264;
+
+  std::vector<uint8_t> scan(application_data_offset + application_data_size, 0);
+
+  scan[0] = 'R';
+  scan[1] = 1;
+  scan[2] = 2;
+  scan[3] = 3;
+  writeUint32LittleEndian(scan, 4, parameters.serial_number_of_device);
+  writeUint32LittleEndian(scan, 8, parameters.serial_number_of_system_plug);
+  scan[12] = parameters.channel_number;
+  writeUint32LittleEndian(scan, 16, parameters.sequence_number);
+  writeUint32LittleEndian(scan, 20, parameters.scan_number);
+  writeUint16LittleEndian(scan, 24, parameters.timestamp_date);
+  writeUint32LittleEndian(scan, 28, parameters.timestamp_time);
+  writeUint16LittleEndian(scan, 32, general_system_state_offset);
+  writeUint16LittleEndian(scan, 34, general_system_state_size);
+  writeUint16LittleEndian(scan, 36, derived_values_offset);
+  writeUint16LittleEndian(scan, 38, derived_values_size);
+  writeUint16LittleEndian(scan, 40, measurement_data_offset);
+  writeUint16LittleEndian(scan, 42, measurement_data_size);
+  writeUint16LittleEndian(scan, 44, intrusion_data_offset);
+  writeUint16LittleEndian(scan, 46, intrusion_data_size);
+  writeUint16LittleEndian(scan, 48, application_data_offset);
+  writeUint16LittleEndian(scan, 50, application_data_size);
+
+  // Status bits and the cut-off paths, which are 24 bit wide each.
+  scan[general_system_state_offset] = 0x2d;
+  for (std::size_t i = 0; i < 9; ++i)
+  {
+    scan[general_system_state_offset + 1 + i] = static_cast<uint8_t>(0x35 * (i + 1));
+  }
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    scan[general_system_state_offset + 10 + i] = static_cast<uint8_t>(10 * (i + 1));
+  }
+  scan[general_system_state_offset + 15] = 0x02;
+
+  writeUint16LittleEndian(scan, derived_values_offset, parameters.multiplication_factor);
+  writeUint16LittleEndian(scan, derived_values_offset + 2, parameters.number_of_beams);
+  writeUint16LittleEndian(scan, derived_values_offset + 4, parameters.scan_time);
+  writeUint32LittleEndian(
+    scan, derived_values_offset + 8, static_cast<uint32_t>(parameters.start_angle));
+  writeUint32LittleEndian(scan,
+                          derived_values_offset + 12,
+                          static_cast<uint32_t>(parameters.angular_beam_resolution));
+  writeUint32LittleEndian(scan, derived_values_offset + 16, parameters.interbeam_period);
+
+  writeUint32LittleEndian(scan, measurement_data_offset, parameters.number_of_beams);
+  for (std::size_t i = 0; i < parameters.number_of_beams; ++i)
+  {
+    std::size_t beam_offset = measurement_data_offset + 4 + 4 * i;
+    writeUint16LittleEndian(scan, beam_offset, getBeamDistance(i));
+    scan[beam_offset + 2] = getBeamReflectivity(i);
+    scan[beam_offset + 3] = getBeamStatus(i);
+  }
+
+  for (std::size_t i = 0; i < parameters.number_of_intrusions; ++i)
+  {
+    std::size_t datum_offset = intrusion_data_offset + i * (4 + flags_size);
+    writeUint32LittleEndian(scan, datum_offset, flags_size);
+    for (std::size_t j = 0; j < flags_size; ++j)
+    {
+      scan[datum_offset + 4 + j] = static_cast<uint8_t>((i + 1) * (j + 3));
+    }
+  }
+
+  for (std::size_t i = 0; i < application_data_size; ++i)
+  {
+    scan[application_data_offset + i] = static_cast<uint8_t>(i * 37 + 11);
+  }
+  return scan;
+}
+
+} // namespace test
+} // namespace sick
+
+#endif // SICK_SAFETYSCANNERS_BASE_TEST_SCANBUILDER_H